@@ -148,6 +148,13 @@ for i = 1,numtargets do
 
    mypackage.files = {
       "src/Metronome.cpp", "src/Metronome.h",
+      "src/SchedulerClock.cpp", "src/SchedulerClock.h",
+      "src/NodePool.cpp", "src/NodePool.h",
+      "src/BinaryHeap.h",
+      "src/OscHookTable.cpp", "src/OscHookTable.h",
+      "src/MidiSequencerQueue.cpp", "src/MidiSequencerQueue.h",
+      "src/MicroTuning.cpp", "src/MicroTuning.h",
+      "src/MidiCapture.cpp", "src/MidiCapture.h",
       "src/Syntax.cpp", "src/Syntax.h",
       "src/CmSupport.cpp", "src/CmSupport.h",
       "src/Console.cpp", "src/Console.h",
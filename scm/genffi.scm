@@ -77,6 +77,7 @@
 
     (ffi_now                   double "cm_now")
     (ffi_sched_sprout          void   "cm_sched_sprout" s7_pointer double int int double)
+    (ffi_sched_sprout_list     void   "cm_sched_sprout_list" s7_pointer s7_pointer s7_pointer int double)
     (ffi_sched_paused_p        bool   "cm_sched_paused_p")
     (ffi_sched_pause           void   "cm_sched_pause")
     (ffi_sched_continue        void   "cm_sched_continue")
@@ -87,6 +88,8 @@
     (ffi_sched_get_score_mode  int    "cm_sched_get_score_mode" )
     (ffi_sched_set_score_mode  void   "cm_sched_set_score_mode" int)
     (ffi_sched_score_time      double "cm_sched_score_time" )
+    (ffi_sched_stats           s7_pointer "cm_sched_stats" bool)
+    (ffi_sched_set_spin        void   "cm_sched_set_spin" double)
     ;; metronome functions
     (ffi_sched_metro_id_valid  bool   "cm_sched_metro_id_valid" int)
     (ffi_sched_make_metro      int    "cm_sched_make_metro" double)
@@ -116,7 +119,7 @@
 
     (ffi_string_hash           int "cm_string_hash" c-string)
 
-    (ffi_midifile_import s7_pointer "cm_midifile_import" c-string int s7_pointer)
+    (ffi_midifile_import s7_pointer "cm_midifile_import" c-string int s7_pointer bool)
     (ffi_midifile_header s7_pointer "cm_midifile_header" c-string s7_pointer)
 
     (ffi_sal_allocate_tokens s7_pointer "sal_allocate_tokens"  )
@@ -133,7 +136,7 @@
 
     (ffi_port_info c-string "cm_port_info" )
 
-    (ffi_mp_open_output bool "mp_open_output" int )
+    (ffi_mp_open_output bool "mp_open_output" int int )
     (ffi_mp_open_input bool "mp_open_input" int )
     (ffi_mp_close_output void "mp_close_output" int )
     (ffi_mp_close_input void "mp_close_input" int )
@@ -141,12 +144,19 @@
     (ffi_mp_open_score void "mp_open_score" c-string s7_pointer)
     (ffi_mp_close_score void "mp_close_score"  )
 
-    (ffi_mp_send_note void "mp_send_note" s7_pointer s7_pointer s7_pointer s7_pointer s7_pointer)
-    (ffi_mp_send_data void "mp_send_data" int double double double double)
+    (ffi_mp_send_note void "mp_send_note" s7_pointer s7_pointer s7_pointer s7_pointer s7_pointer s7_pointer)
+    (ffi_mp_send_data void "mp_send_data" int double double double double int)
     (ffi_mp_set_channel_mask void "mp_set_channel_mask" int)
     (ffi_mp_set_message_mask void "mp_set_message_mask" int)
     (ffi_mp_set_tuning void "mp_set_tuning" int)
+    (ffi_mp_set_lookahead void "mp_set_lookahead" double)
+    (ffi_mp_set_retrigger void "mp_set_retrigger" bool)
+    (ffi_mp_set_extend void "mp_set_extend" bool)
+    (ffi_mp_set_tuning_offsets bool "mp_set_tuning_offsets" s7_pointer)
+    (ffi_mp_set_note_bends void "mp_set_note_bends" bool)
     (ffi_mp_set_instruments void "mp_set_instruments" s7_pointer)
+    (ffi_mp_set_channel_ports void "mp_set_channel_ports" s7_pointer)
+    (ffi_mp_set_output_latency void "mp_set_output_latency" int double)
     (ffi_mp_play_seq void "mp_play_seq")
     (ffi_mp_save_seq void "mp_save_seq")
     (ffi_mp_copy_seq void "mp_copy_seq")
@@ -155,6 +165,7 @@
 
     (ffi_mp_set_midi_hook bool "mp_set_midi_hook" int s7_pointer)
     (ffi_mp_is_midi_hook s7_pointer "mp_is_midi_hook" int)
+    (ffi_mp_set_midi_batch_hook bool "mp_set_midi_batch_hook" s7_pointer bool)
 
     (ffi_cs_open_score void "cs_open_score" c-string)
     (ffi_cs_close_score void "cs_close_score" )
@@ -109,14 +109,20 @@
 	  (in
 	   (mp:open-input in)))))
 
+;; mp:open-output opens a midi output device on an output port, port
+;; 0 (the default) is the main output. each port has its own output
+;; thread so a slow device doesn't hold up the others.
+
 (define (mp:open-output . dev)
   (if (and (pair? dev)
-	   (null? (cdr dev))
 	   (integer? (car dev))
 	   (>= (car dev) 0)
-	   (ffi_mp_open_output (car dev)))
+	   (or (null? (cdr dev))
+	       (and (null? (cddr dev))
+		    (integer? (cadr dev))))
+	   (ffi_mp_open_output (car dev) (if (null? (cdr dev)) 0 (cadr dev))))
       (car dev)
-      (error "~S is not a midi device number" dev)))
+      (error "~S is not a midi device number and port" dev)))
 
 (define (mp:open-input . dev)
   (if (and (pair? dev)
@@ -163,51 +169,106 @@
          (ffi_sched_set_score_mode 0)
          (mp:close-score))))
 
-(define* (mp:midi time dur key amp chan)
-  (ffi_mp_send_note time dur key amp chan))
+(define* (mp:midi time dur key amp chan port)
+  (ffi_mp_send_note time dur key amp chan port))
 
 ;(define (mp:midi . args)
 ;  (with-optkeys (args (time 0) (dur .5) (key 60) (amp .5) (chan 0))
 ;    (ffi_mp_send_note time dur key amp chan)))
 
 (define (mp:off . args)
-  (with-optkeys (args (time 0) (key 60) (chan 0))
-    (ffi_mp_send_data mm:off time chan key 0)))
+  (with-optkeys (args (time 0) (key 60) (chan 0) (port -1))
+    (ffi_mp_send_data mm:off time chan key 0 port)))
 
 (define (mp:on . args)
-  (with-optkeys (args (time 0) (key 60) (vel 64) (chan 0))
-    (ffi_mp_send_data mm:on time chan key vel)))
+  (with-optkeys (args (time 0) (key 60) (vel 64) (chan 0) (port -1))
+    (ffi_mp_send_data mm:on time chan key vel port)))
 
 (define (mp:touch . args)
-  (with-optkeys (args (time 0) (key 0) (val 0) (chan 0))
-    (ffi_mp_send_data mm:touch time chan key val)))
+  (with-optkeys (args (time 0) (key 0) (val 0) (chan 0) (port -1))
+    (ffi_mp_send_data mm:touch time chan key val port)))
 
 (define (mp:ctrl . args)
-  (with-optkeys (args (time 0) (num 0) (val 0) (chan 0))
-    (ffi_mp_send_data mm:ctrl time chan num val)))
+  (with-optkeys (args (time 0) (num 0) (val 0) (chan 0) (port -1))
+    (ffi_mp_send_data mm:ctrl time chan num val port)))
 
 (define (mp:prog . args)
-  (with-optkeys (args (time 0) (val 0) (chan 0))
-    (ffi_mp_send_data mm:prog time chan val 0)))
+  (with-optkeys (args (time 0) (val 0) (chan 0) (port -1))
+    (ffi_mp_send_data mm:prog time chan val 0 port)))
 
 (define (mp:press . args)
-  (with-optkeys (args (time 0) (val 0) (chan 0))
-    (ffi_mp_send_data mm:press time chan val 0)))
+  (with-optkeys (args (time 0) (val 0) (chan 0) (port -1))
+    (ffi_mp_send_data mm:press time chan val 0 port)))
 
 (define (mp:bend . args)
-  (with-optkeys (args (time 0) (val 8192) (chan 0))
-    (ffi_mp_send_data mm:bend time chan val 0)))
+  (with-optkeys (args (time 0) (val 8192) (chan 0) (port -1))
+    (ffi_mp_send_data mm:bend time chan val 0 port)))
+
+;; mp:tuning sets the microtuning. an integer 1 to 16 divides each
+;; semitone equally, a list of cent offsets (like the steps of a scala
+;; file, starting with 0) sets an unequal division and :bend gives
+;; each note its own channel and pitch bend.
 
 (define (mp:tuning . args)
   (let ((arg (if (null? args) 1 (car args))))
-    (if (and (integer? arg)
-	     (< 0 arg 17))
-	(ffi_mp_set_tuning arg)
-	(error "~S is not a tuning division 1 to 16" arg))))
+    (cond ((and (integer? arg)
+		(< 0 arg 17))
+	   (ffi_mp_set_tuning arg))
+	  ((eq? arg :bend)
+	   (ffi_mp_set_note_bends #t))
+	  ((and (pair? arg)
+		(ffi_mp_set_tuning_offsets arg)))
+	  (else
+	   (error "~S is not a tuning division 1 to 16, list of cent offsets or :bend" arg)))))
+
+;; mp:lookahead sets the number of milliseconds ahead of time that
+;; output is handed over with its time stamp. 0 (the default) sends
+;; each message when it is due. on linux the output goes to an alsa
+;; sequencer queue that sends it on time, late messages go out at
+;; once. elsewhere juce's midi output thread sends it, which lowers
+;; the average lateness but not the jitter: it rounds times to a whole
+;; millisecond and drops messages more than 200 ms late.
+
+(define (mp:lookahead . args)
+  (let ((arg (if (null? args) 0 (car args))))
+    (if (and (real? arg) (>= arg 0))
+	(ffi_mp_set_lookahead arg)
+	(error "~S is not a lookahead time in milliseconds >= 0" arg))))
+
+;; mp:retrigger turns retrigger mode on or off. in retrigger mode a
+;; note on for a key that is still sounding sends that key's note off
+;; first, otherwise the earliest note off ends the key.
+
+(define (mp:retrigger . args)
+  (let ((arg (if (null? args) #t (car args))))
+    (ffi_mp_set_retrigger (if arg #t #f))))
+
+;; mp:extend turns extend mode on or off. in extend mode a note on for
+;; a key that is still sounding keeps the key sounding until the later
+;; note ends. retrigger mode takes precedence.
+
+(define (mp:extend . args)
+  (let ((arg (if (null? args) #t (car args))))
+    (ffi_mp_set_extend (if arg #t #f))))
 
 (define (mp:instruments . args)
   (ffi_mp_set_instruments args))
 
+;; mp:ports routes each channel to an output port, like mp:instruments
+;; the first value is for channel 0. messages with an explicit port go
+;; there instead.
+
+(define (mp:ports . args)
+  (ffi_mp_set_channel_ports args))
+
+;; mp:latency sets the latency in milliseconds of the device on an
+;; output port. the other ports are held back so they sound together.
+
+(define (mp:latency port ms)
+  (if (and (integer? port) (>= port 0) (real? ms) (>= ms 0))
+      (ffi_mp_set_output_latency port ms)
+      (error "~S ~S is not an output port and latency in milliseconds >= 0" port ms)))
+
 (define (mp:playseq)
   (ffi_mp_play_seq))
 
@@ -264,6 +325,24 @@
                       (error "mp:receive: invalid receive opcode: ~S" op))
                   (error "mp:receive: too many arguments: ~S" args)))))))
 
+; (mp:receive-batch proc)
+; (mp:receive-batch proc :coalesce #t)
+; (mp:receive-batch #f)
+; proc is called with a vector and a row count. each row is five
+; integers: op chan data1 data2 msec. the vector is reused for every
+; call. while a batch receiver is set it receives all midi input.
+; coalesce keeps only the last value of each controller in a batch.
+
+(define (mp:receive-batch proc . args)
+  (with-optkeys (args (coalesce #f))
+    (if (or (not proc)
+            (and (procedure? proc)
+                 (let ((ar (procedure-arity proc)))
+                   (or (= (car ar) 2) (= (cadr ar) 2)))))
+        (ffi_mp_set_midi_batch_hook proc (if coalesce #t #f))
+        (error "mp:receive-batch: receiver not #f or a procedure of two arguments: ~S"
+               proc))))
+
 (define (mp:receive? . args)
   (if (null? args)
       (ffi_mp_is_midi_hook -1)
@@ -655,18 +734,23 @@
 	     #t)))))))
 
 (define-send-message "mp:open" '(#:optkey out in))
-(define-send-message "mp:midi" '(#:optkey time dur key amp chan))
-(define-send-message "mp:off" '(#:optkey time key chan))
-(define-send-message "mp:on" '(#:optkey time key vel chan))
-(define-send-message "mp:touch" '(#:optkey time key val chan))
-(define-send-message "mp:ctrl" '(#:optkey time num val chan))
-(define-send-message "mp:prog" '(#:optkey time val chan))
-(define-send-message "mp:press" '(#:optkey time val chan))
-(define-send-message "mp:bend" '(#:optkey time val chan))
+(define-send-message "mp:midi" '(#:optkey time dur key amp chan port))
+(define-send-message "mp:off" '(#:optkey time key chan port))
+(define-send-message "mp:on" '(#:optkey time key vel chan port))
+(define-send-message "mp:touch" '(#:optkey time key val chan port))
+(define-send-message "mp:ctrl" '(#:optkey time num val chan port))
+(define-send-message "mp:prog" '(#:optkey time val chan port))
+(define-send-message "mp:press" '(#:optkey time val chan port))
+(define-send-message "mp:bend" '(#:optkey time val chan port))
 (define-send-message "mp:mm"  '(#:optkey mm ))
 (define-send-message "mp:inhook" '(#:optkey func))
 (define-send-message "mp:tuning" '(#:optkey div ))
+(define-send-message "mp:lookahead" '(#:optkey ms ))
+(define-send-message "mp:retrigger" '(#:optkey bool ))
+(define-send-message "mp:extend" '(#:optkey bool ))
 (define-send-message "mp:instruments" '(#:rest args ))
+(define-send-message "mp:ports" '(#:rest args ))
+(define-send-message "mp:latency" '(port ms))
 (define-send-message "mp:recordseq" '(#:optkey rec ))
 (define-send-message "mp:playseq" '())
 (define-send-message "mp:saveseq" '())
@@ -149,13 +149,15 @@
   *sprout-hook*)
 
 (define (sprout proc . args)
-  ;; (sprout {proc|list} [ahead|list] [id|list|file] ...)
+  ;; (sprout {proc|list|vector} [ahead|list|vector] [id|list|vector|file] ...)
   (let ((start 0)
 	(id 0)
 	(file #f)
         (metro 0)
         (startBeat 0)
         )
+    ;; vectors of procs are sprouted like lists
+    (if (vector? proc) (set! proc (vector->list proc)))
     ;; parse args and check for illegal values before sprouting
     ;; anything. first make sure all procs are really procedures...
     (or (procedure? proc)
@@ -195,6 +197,8 @@
             (else
              (error "illegal sprout arguments ~S" args))))
 
+    (if (vector? start) (set! start (vector->list start)))
+    (if (vector? id) (set! id (vector->list id)))
     ;; make sure all starts are valid start times...
     (if (procedure? start)
         (begin
@@ -229,30 +233,18 @@
     ;; open output file or signal error
     (if file (apply open-file file args))
     (if *sprout-hook* (*sprout-hook* file))
-    ;; everything ok, do process sprouting!
-    (let ((nextstart
-	   (lambda ()
-	     (if (pair? start)
-		 (let ((v (car start)))
-		   (set! start (if (null? (cdr start))
-				   (car start) (cdr start)))
-		   v)
-		 start)))
-	  (nextid 
-	   (lambda ()
-	     (if (pair? id)
-		 (let ((v (car id)))
-		   (set! id (if (null? (cdr id))
-				(car id) (cdr id)))
-		   v)
-		 id))))
-      (if (pair? proc)
-	  (do ((p proc (cdr p)))
-	      ((null? p) proc)
-	    (ffi_sched_sprout (car p) (nextstart)
-			      (string-hash (nextid)) metro startBeat))
-	  (ffi_sched_sprout proc (nextstart) (string-hash (nextid)) metro startBeat))
-      (void))))
+    ;; everything ok, do process sprouting! a list of procs is
+    ;; sprouted in one batch, short start and id lists repeat their
+    ;; last value.
+    (if (pair? proc)
+        (ffi_sched_sprout_list proc start
+                               (if (pair? id) (map string-hash id)
+                                   (string-hash id))
+                               metro startBeat)
+        (ffi_sched_sprout proc (if (pair? start) (car start) start)
+                          (string-hash (if (pair? id) (car id) id))
+                          metro startBeat))
+    (void)))
 
 (define (now)
   (ffi_now))
@@ -306,6 +298,36 @@
 (define (busy? )
   (ffi_sched_busy_p))
 
+;; scheduler-stats returns timing statistics for the scheduler and
+;; midi output threads: ((scheme (dispatched . n) ...) (midi-out ...)
+;; (scheme-nodes ...) (midi-nodes ...)). every midi output port that
+;; has been opened has its own entry after midi-out: midi-out-1,
+;; midi-out-2 and so on. lateness, jitter and callback
+;; times are in milliseconds, rate is events dispatched per second,
+;; queue-depth is the number of events waiting and load is the
+;; percentage of time the thread was awake. the histograms are lists
+;; of (bound . count) where bound is the bucket's upper limit in
+;; milliseconds and #t marks the last, open ended bucket. for the
+;; scheme thread callback times are for processes and midi and osc
+;; hooks, for midi-out they are the time spent sending to the device.
+;; the node pool entries give the pool's capacity, nodes in use,
+;; high-water mark and number of allocations that overflowed to the
+;; heap. if reset is true the timing statistics are cleared after
+;; they are returned.
+
+(define* (scheduler-stats (reset #f))
+  (ffi_sched_stats reset))
+
+;; scheduler-spin sets the number of milliseconds the scheduler and
+;; midi output threads busy-wait before each deadline instead of
+;; sleeping. 0 (the default) disables spinning.
+
+(define (scheduler-spin ms)
+  (if (or (not (real? ms)) (< ms 0))
+      (error "spin time ~S is not a number >= 0." ms))
+  (ffi_sched_set_spin ms)
+  (void))
+
 ;;;
 ;;; metronome functions
 ;;;
@@ -1468,6 +1468,7 @@
 ; (midifile-import "foo.mid" 1 '(ctrl2))
 ; (midifile-import "foo.mid" 1 '(:rhythm :dur :vel))
 ; (midifile-import "foo.mid" 1 '(prog "chan"))
+; (midifile-import "foo.mid" 1 '(time key dur) :columns #t)
 
 (define midi-values  
   ;; SEE:  Enumerations.h
@@ -1494,7 +1495,10 @@
     ("keysig"     21)
     ))
 
-(define (midifile-import file track values)
+;; with :columns #t the result is a list of vectors, one for each
+;; value, instead of a list of values for each message.
+
+(define (midifile-import file track values . args)
   (unless (file-exists? file)
     (error "file does not exist: ~S" file))
   (define (getname x)
@@ -1516,7 +1520,8 @@
                             values))
           (set! values (map (lambda (x) (getmidivalue x midi-values)) values)))
       (set! values (list (getmidivalue values midi-values))))
-  (ffi_midifile_import file track values)
+  (with-optkeys (args (columns #f))
+    (ffi_midifile_import file track values (if columns #t #f)))
   )
 
 ; (midifile-import "/Users/hkt/incline/zincline-1.mid" 0 "op")
@@ -0,0 +1,209 @@
+/*=======================================================================*
+  Copyright (C) 2012 Rick Taube.
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the Lisp Lesser Gnu Public License. The text of
+  this agreement is available at http://www.cliki.net/LLGPL
+ *=======================================================================*/
+
+#ifndef BINARYHEAP_H
+#define BINARYHEAP_H
+
+#include "Libraries.h"
+
+/*=======================================================================*
+                                Binary Heap
+ *=======================================================================*/
+
+/** The index callback for heap elements that don't record their
+    position in the heap. **/
+
+template <class ElementType>
+class BinaryHeapNoIndex
+{
+ public:
+  void setIndex(const ElementType&, int) const {}
+};
+
+/** A binary heap with the earliest element first. The comparator's
+    compareElements(e1, e2) returns a value less than 0 if e1 comes
+    before e2, as for Array::sort(). Each time an element moves the
+    index callback's setIndex(element, index) is called, so elements
+    that record their position can be removed from the middle of the
+    heap, or reordered after they change, in O(log n). The comparator
+    and the callback are copied into the heap and may hold state, for
+    example the table that the elements index. Elements must be plain
+    values (pointers, numbers, small structs) that can be moved with
+    memcpy. The storage grows but never shrinks, so a heap that has
+    reserved room for the most elements it will hold never allocates
+    again. **/
+
+template <class ElementType, class ElementComparator,
+          class IndexCallback = BinaryHeapNoIndex<ElementType> >
+class BinaryHeap
+{
+ public:
+  BinaryHeap(const ElementComparator& comp=ElementComparator(),
+             const IndexCallback& callback=IndexCallback())
+    : numused (0),
+      numallocated (0),
+      comparator (comp),
+      indexer (callback)
+  {
+  }
+
+  ~BinaryHeap() {}
+
+  int size() const {return numused;}
+  bool isEmpty() const {return numused==0;}
+
+  /** Returns the earliest element or a default value if the heap is
+      empty. **/
+  ElementType getFirst() const
+  {
+    return (numused>0) ? elements[0] : ElementType();
+  }
+
+  /** Returns the element at index in heap order. **/
+  const ElementType& getUnchecked(int index) const
+  {
+    jassert(index>=0 && index<numused);
+    return elements[index];
+  }
+
+  /** Makes sure the heap can hold num elements without
+      allocating. **/
+  void ensureStorageAllocated(int num)
+  {
+    if (num>numallocated)
+      {
+        numallocated=num;
+        elements.realloc(numallocated);
+      }
+  }
+
+  /** Adds element at its place in the order. **/
+  void add(const ElementType& element)
+  {
+    append(element);
+    siftUp(numused-1);
+  }
+
+  /** Adds element at the end without ordering it, call rebuild()
+      when the batch is added. **/
+  void append(const ElementType& element)
+  {
+    if (numused==numallocated)
+      ensureStorageAllocated(numused+(numused/2)+8);
+    place(element, numused++);
+  }
+
+  /** Removes and returns the earliest element, the heap must not be
+      empty. **/
+  ElementType removeFirst()
+  {
+    jassert(numused>0);
+    ElementType first=elements[0];
+    removeAt(0);
+    return first;
+  }
+
+  /** Removes the element at index. **/
+  void removeAt(int index)
+  {
+    jassert(index>=0 && index<numused);
+    if (index < --numused)
+      {
+        // move the last element into the hole and restore the order
+        place(elements[numused], index);
+        update(index);
+      }
+  }
+
+  /** Removes elements from the end, which leaves the order
+      intact. **/
+  void removeLast(int howMany=1)
+  {
+    jassert(howMany>=0 && howMany<=numused);
+    numused-=howMany;
+  }
+
+  /** Replaces the element at index without ordering it, call
+      update() or rebuild() afterwards. **/
+  void setUnchecked(int index, const ElementType& element)
+  {
+    jassert(index>=0 && index<numused);
+    place(element, index);
+  }
+
+  /** Moves the element at index to its place after it has
+      changed. **/
+  void update(int index)
+  {
+    if (siftUp(index)==index)
+      siftDown(index);
+  }
+
+  /** Reorders the whole heap in O(n), after a batch of appends or
+      after many elements have changed. **/
+  void rebuild()
+  {
+    for (int i=(numused/2)-1; i>=0; i--)
+      siftDown(i);
+  }
+
+  /** Removes every element but keeps the storage. **/
+  void clear() {numused=0;}
+
+ private:
+  HeapBlock<ElementType> elements;
+  int numused;
+  int numallocated;
+  ElementComparator comparator;
+  IndexCallback indexer;
+
+  void place(const ElementType& element, int index)
+  {
+    elements[index]=element;
+    indexer.setIndex(element, index);
+  }
+
+  int siftUp(int index)
+  {
+    ElementType element=elements[index];
+    while (index>0)
+      {
+        int parent=(index-1)/2;
+        if (comparator.compareElements(element, elements[parent])>=0)
+          break;
+        place(elements[parent], index);
+        index=parent;
+      }
+    place(element, index);
+    return index;
+  }
+
+  int siftDown(int index)
+  {
+    ElementType element=elements[index];
+    while (true)
+      {
+        int child=(index*2)+1;
+        if (child>=numused)
+          break;
+        if (child+1<numused &&
+            comparator.compareElements(elements[child+1], elements[child])<0)
+          child++;
+        if (comparator.compareElements(elements[child], element)>=0)
+          break;
+        place(elements[child], index);
+        index=child;
+      }
+    place(element, index);
+    return index;
+  }
+
+  BinaryHeap(const BinaryHeap&);
+  BinaryHeap& operator=(const BinaryHeap&);
+};
+
+#endif
@@ -777,6 +777,42 @@ void cm_sched_sprout(s7_pointer proc, double time, int id, int metroId, double s
   scm->sprout(time, proc, id, metroId, startBeat);
 }
 
+void cm_sched_sprout_list(s7_pointer procs, s7_pointer starts, s7_pointer ids, int metroId, double startBeat)
+{
+  // procs is a list of procedures, starts and ids are either a single
+  // value or a list of values. if a list is shorter than procs its
+  // last value is used for the remaining processes.
+  SchemeThread* scm=SchemeThread::getInstance();
+  Array<s7_pointer> p;
+  Array<double> t;
+  Array<int> d;
+  int num=s7_list_length(scm->scheme, procs);
+  p.ensureStorageAllocated(num);
+  t.ensureStorageAllocated(num);
+  d.ensureStorageAllocated(num);
+  double start=(s7_is_pair(starts)) ? 0.0 : s7_number_to_real(starts);
+  int id=(s7_is_pair(ids)) ? 0 : (int)s7_integer(ids);
+  for ( ; s7_is_pair(procs); procs=s7_cdr(procs))
+    {
+      if (s7_is_pair(starts))
+        {
+          start=s7_number_to_real(s7_car(starts));
+          if (s7_is_pair(s7_cdr(starts)))
+            starts=s7_cdr(starts);
+        }
+      if (s7_is_pair(ids))
+        {
+          id=(int)s7_integer(s7_car(ids));
+          if (s7_is_pair(s7_cdr(ids)))
+            ids=s7_cdr(ids);
+        }
+      p.add(s7_car(procs));
+      t.add(start);
+      d.add(id);
+    }
+  scm->sprout(p, t, d, metroId, startBeat);
+}
+
 bool cm_sched_paused_p()
 {
   return SchemeThread::getInstance()->isPaused();
@@ -835,6 +871,84 @@ double cm_sched_score_time()
   return SchemeThread::getInstance()->getScoreTime();
 }
 
+static s7_pointer histogram_stats(s7_scheme* sc, SchedulerHistogram& hist)
+{
+  // returns ((bound . count) ...) with #t as the last bucket's bound
+  s7_pointer vals=s7_NIL(sc);
+  for (int i=SchedulerHistogram::NumBuckets-1; i>=0; i--)
+    {
+      s7_pointer bound=(i<SchedulerHistogram::NumBuckets-1) ?
+        s7_make_real(sc, SchedulerHistogram::getBound(i)) : s7_t(sc);
+      vals=s7_cons(sc, s7_cons(sc, bound, s7_make_integer(sc, hist.getCount(i))), vals);
+    }
+  return vals;
+}
+
+static s7_pointer clock_stats(s7_scheme* sc, SchedulerClock& clock)
+{
+  // returns (name (key . value) ...) for one clock
+  s7_pointer nil=s7_NIL(sc);
+  s7_pointer vals=nil;
+  vals=s7_cons(sc, s7_cons(sc, s7_make_symbol(sc, "callback-histogram"), histogram_stats(sc, clock.callbackHistogram)), vals);
+  vals=s7_cons(sc, s7_cons(sc, s7_make_symbol(sc, "lateness-histogram"), histogram_stats(sc, clock.latenessHistogram)), vals);
+  vals=s7_cons(sc, s7_cons(sc, s7_make_symbol(sc, "spin"), s7_make_real(sc, clock.getSpinTime())), vals);
+  vals=s7_cons(sc, s7_cons(sc, s7_make_symbol(sc, "load"), s7_make_real(sc, clock.getLoad())), vals);
+  vals=s7_cons(sc, s7_cons(sc, s7_make_symbol(sc, "max-queue-depth"), s7_make_integer(sc, clock.getMaxQueueDepth())), vals);
+  vals=s7_cons(sc, s7_cons(sc, s7_make_symbol(sc, "queue-depth"), s7_make_integer(sc, clock.getQueueDepth())), vals);
+  vals=s7_cons(sc, s7_cons(sc, s7_make_symbol(sc, "max-callback"), s7_make_real(sc, clock.getMaxCallbackTime())), vals);
+  vals=s7_cons(sc, s7_cons(sc, s7_make_symbol(sc, "mean-callback"), s7_make_real(sc, clock.getMeanCallbackTime())), vals);
+  vals=s7_cons(sc, s7_cons(sc, s7_make_symbol(sc, "jitter"), s7_make_real(sc, clock.getJitter())), vals);
+  vals=s7_cons(sc, s7_cons(sc, s7_make_symbol(sc, "max-lateness"), s7_make_real(sc, clock.getMaxLateness())), vals);
+  vals=s7_cons(sc, s7_cons(sc, s7_make_symbol(sc, "mean-lateness"), s7_make_real(sc, clock.getMeanLateness())), vals);
+  vals=s7_cons(sc, s7_cons(sc, s7_make_symbol(sc, "early-wakeups"), s7_make_integer(sc, clock.getNumEarlyWakeups())), vals);
+  vals=s7_cons(sc, s7_cons(sc, s7_make_symbol(sc, "wakeups"), s7_make_integer(sc, clock.getNumWakeups())), vals);
+  vals=s7_cons(sc, s7_cons(sc, s7_make_symbol(sc, "rate"), s7_make_real(sc, clock.getRate())), vals);
+  vals=s7_cons(sc, s7_cons(sc, s7_make_symbol(sc, "dispatched"), s7_make_integer(sc, clock.getNumDispatched())), vals);
+  return s7_cons(sc, s7_make_symbol(sc, clock.name.toUTF8()), vals);
+}
+
+static s7_pointer pool_stats(s7_scheme* sc, NodePool& pool)
+{
+  // returns (name (key . value) ...) for one node pool
+  s7_pointer vals=s7_NIL(sc);
+  vals=s7_cons(sc, s7_cons(sc, s7_make_symbol(sc, "overflows"), s7_make_integer(sc, pool.getNumOverflows())), vals);
+  vals=s7_cons(sc, s7_cons(sc, s7_make_symbol(sc, "high-water"), s7_make_integer(sc, pool.getHighWaterMark())), vals);
+  vals=s7_cons(sc, s7_cons(sc, s7_make_symbol(sc, "in-use"), s7_make_integer(sc, pool.getNumInUse())), vals);
+  vals=s7_cons(sc, s7_cons(sc, s7_make_symbol(sc, "capacity"), s7_make_integer(sc, pool.getCapacity())), vals);
+  return s7_cons(sc, s7_make_symbol(sc, pool.name.toUTF8()), vals);
+}
+
+s7_pointer cm_sched_stats(bool reset)
+{
+  SchemeThread* scm=SchemeThread::getInstance();
+  MidiOutPort* out=MidiOutPort::getInstance();
+  s7_pointer stats=scm->schemeNil;
+  stats=s7_cons(scm->scheme, pool_stats(scm->scheme, MidiNode::pool), stats);
+  stats=s7_cons(scm->scheme, pool_stats(scm->scheme, XSchemeNode::pool), stats);
+  // every midi output has its own thread and clock, port 0 first
+  for (int i=MidiOutPort::NumOutputs-1; i>=0; i--)
+    {
+      MidiOutDevice* dev=out->getOutput(i);
+      if (dev != NULL)
+        {
+          stats=s7_cons(scm->scheme, clock_stats(scm->scheme, dev->clock), stats);
+          if (reset)
+            dev->clock.resetStats();
+        }
+    }
+  stats=s7_cons(scm->scheme, clock_stats(scm->scheme, scm->clock), stats);
+  if (reset)
+    scm->clock.resetStats();
+  return stats;
+}
+
+void cm_sched_set_spin(double ms)
+{
+  // sets the busy-wait window of the scheduler and every midi output
+  SchemeThread::getInstance()->clock.setSpinTime(ms);
+  MidiOutPort::getInstance()->setSpinTime(ms);
+}
+
 //
 // file system and pathname support. CONVERT THESE TO STRINGS or MOve to Lisp
 //
@@ -1333,9 +1447,9 @@ char* cm_port_info()
  * Midi port
  */
 
-bool mp_open_output(int dev)
+bool mp_open_output(int dev, int port)
 {
-  return MidiOutPort::getInstance()->open(dev);
+  return MidiOutPort::getInstance()->openOutput(dev, port);
 }
 
 bool mp_open_input(int dev)
@@ -1355,8 +1469,9 @@ void mp_close_input(int dev)
 
 void mp_open_score(char* path, s7_pointer args)
 {
-  // args is () or a list of keyword options
-  MidiOutPort::getInstance()->performCommand(CommandIDs::MidiSeqSetFile, 0, String(path));
+  // args is () or a list of keyword options. the score is written to
+  // the file as it runs
+  MidiOutPort::getInstance()->openScore(String(path));
 }
 
 void mp_close_score()
@@ -1364,7 +1479,7 @@ void mp_close_score()
   MidiOutPort::getInstance()->performCommand(CommandIDs::SchedulerScoreComplete);
 }
 
-void mp_send_note(s7_pointer time, s7_pointer dur, s7_pointer key, s7_pointer amp, s7_pointer chan) 
+void mp_send_note(s7_pointer time, s7_pointer dur, s7_pointer key, s7_pointer amp, s7_pointer chan, s7_pointer port) 
 {
   SchemeThread* scm=SchemeThread::getInstance();
   // if a Fomus score is open reroute the midi data as an fms:note.
@@ -1487,13 +1602,19 @@ void mp_send_note(s7_pointer time, s7_pointer dur, s7_pointer key, s7_pointer am
       scm->signalSchemeError(T("mp:midi: chan not a number"));
     // if score capture is true AND we are under a process callback
     // then scoretime will be >= 0 else it will be 0
+    // port is #f (route by channel) or an output port number
+    int p=-1;
+    if (s7_is_integer(port))
+      p=(int)s7_integer(port);
+    else if (port!=s7_f(scm->scheme))
+      scm->signalSchemeError(T("mp:midi: port not an integer"));
     if (midifile)
       f0 += scm->scoretime;
-    MidiOutPort::getInstance()->sendNote(f0, f1, f2, f3, f4, midifile);
+    MidiOutPort::getInstance()->sendNote(f0, f1, f2, f3, f4, midifile, p);
   }
 }
 
-void mp_send_data(int type, double time, double chan, double data1, double  data2)
+void mp_send_data(int type, double time, double chan, double data1, double  data2, int port)
 {
   SchemeThread* scm=SchemeThread::getInstance();
   if (scm->scoremode)
@@ -1507,7 +1628,7 @@ void mp_send_data(int type, double time, double chan, double data1, double  data
   else
     {
       MidiOutPort::getInstance()->
-	sendData(type, time, chan, data1, data2, false) ;
+	sendData(type, time, chan, data1, data2, false, port) ;
     }
 }
 
@@ -1517,6 +1638,52 @@ void mp_set_tuning(int div)
 					     div);
 }
 
+void mp_set_lookahead(double ms)
+{
+  MidiOutPort::getInstance()->setLookahead(ms);
+}
+
+void mp_set_retrigger(bool retrig)
+{
+  MidiOutPort::getInstance()->setRetrigger(retrig);
+}
+
+void mp_set_extend(bool ext)
+{
+  MidiOutPort::getInstance()->setExtend(ext);
+}
+
+bool mp_set_tuning_offsets(s7_pointer list)
+{
+  // list is the cent offsets of the tuning's zones
+  Array<double> cents;
+  for (; s7_is_pair(list); list=s7_cdr(list))
+    if (s7_is_real(s7_car(list)))
+      cents.add(s7_number_to_real(s7_car(list)));
+    else
+      return false;
+  return MidiOutPort::getInstance()->setTuningOffsets(cents);
+}
+
+void mp_set_note_bends(bool bends)
+{
+  MidiOutPort::getInstance()->setNoteBends(bends);
+}
+
+void mp_set_channel_ports(s7_pointer list)
+{
+  // list is the output port of each channel, #f leaves a channel alone
+  MidiOutPort* port=MidiOutPort::getInstance();
+  for (int chan=0; s7_is_pair(list) && chan<16; list=s7_cdr(list), chan++)
+    if (s7_is_integer(s7_car(list)))
+      port->setChannelPort(chan, (int)s7_integer(s7_car(list)));
+}
+
+void mp_set_output_latency(int port, double ms)
+{
+  MidiOutPort::getInstance()->setOutputLatency(port, ms);
+}
+
 void mp_set_instruments(s7_pointer list)
 {
   MidiOutPort* port=MidiOutPort::getInstance();
@@ -1581,204 +1748,237 @@ void mp_set_message_mask(int mask)
 }
 
 
-s7_pointer getMidiValue(s7_scheme* sc, MidiMessageSequence::MidiEventHolder* hold, int midival, int opcode, 
+s7_pointer getMidiValue(s7_scheme* sc, const MidiMessage& msg, double offtime, int midival, int opcode, 
                         double lasttime, double lastontime)
 {
+  // offtime is the time of a note on's paired off or -1
   switch (midival)
     {
     case MidiValues::MidiValueTime:
-      return s7_make_real(sc, hold->message.getTimeStamp());
+      return s7_make_real(sc, msg.getTimeStamp());
     case MidiValues::MidiValueDelta:
-      return s7_make_real(sc, hold->message.getTimeStamp() - lasttime);
+      return s7_make_real(sc, msg.getTimeStamp() - lasttime);
     case MidiValues::MidiValueOp:
       return s7_make_integer(sc, opcode);
     case MidiValues::MidiValueRhythm:
-      return s7_make_real(sc, hold->message.getTimeStamp() - lastontime);
+      return s7_make_real(sc, msg.getTimeStamp() - lastontime);
     case MidiValues::MidiValueDuration:
-      if (hold->noteOffObject)
-        return s7_make_real(sc, hold->noteOffObject->message.getTimeStamp() - hold->message.getTimeStamp());
+      if (offtime>=0.0)
+        return s7_make_real(sc, offtime - msg.getTimeStamp());
       else // no dur if no paired off
         return SchemeThread::getInstance()->schemeFalse;
     case MidiValues::MidiValueKeyNumber:
-      return s7_make_integer(sc, hold->message.getNoteNumber());
+      return s7_make_integer(sc, msg.getNoteNumber());
     case MidiValues::MidiValueAmplitude:
-      return s7_make_real(sc, hold->message.getFloatVelocity());
+      return s7_make_real(sc, msg.getFloatVelocity());
     case MidiValues::MidiValueVelocity:
-      return s7_make_integer(sc, hold->message.getVelocity());
+      return s7_make_integer(sc, msg.getVelocity());
     case MidiValues::MidiValueChannel:
-      return s7_make_integer(sc, hold->message.getChannel()-1);
+      return s7_make_integer(sc, msg.getChannel()-1);
     case MidiValues::MidiValueTouch:
-      return s7_make_integer(sc, hold->message.getAfterTouchValue());
+      return s7_make_integer(sc, msg.getAfterTouchValue());
     case MidiValues::MidiValueControlNumber:
-      return s7_make_integer(sc, hold->message.getControllerNumber());
+      return s7_make_integer(sc, msg.getControllerNumber());
     case MidiValues::MidiValueControlValue:
-      return s7_make_integer(sc, hold->message.getControllerValue());
+      return s7_make_integer(sc, msg.getControllerValue());
     case MidiValues::MidiValueProgram:
-      return s7_make_integer(sc, hold->message.getProgramChangeNumber());
+      return s7_make_integer(sc, msg.getProgramChangeNumber());
     case MidiValues::MidiValuePressure:
-      return s7_make_integer(sc, hold->message.getChannelPressureValue());
+      return s7_make_integer(sc, msg.getChannelPressureValue());
     case MidiValues::MidiValueBend:
-      return s7_make_integer(sc, hold->message.getPitchWheelValue());
+      return s7_make_integer(sc, msg.getPitchWheelValue());
     case MidiValues::MidiValueSeqNum:
       {
         int num = -1;
-        const uint8* data=hold->message.getMetaEventData();
-        if (hold->message.getMetaEventLength()==2)
+        const uint8* data=msg.getMetaEventData();
+        if (msg.getMetaEventLength()==2)
           num=(int)((data[0]<<8)+data[1]);
-        return s7_make_integer(sc, hold->message.getPitchWheelValue());
+        return s7_make_integer(sc, num);
       }
     case MidiValues::MidiValueText:
-      return s7_make_string(sc, hold->message.getTextFromTextMetaEvent().toUTF8());
+      return s7_make_string(sc, msg.getTextFromTextMetaEvent().toUTF8());
     case MidiValues::MidiValueChanPrefix:
-      return s7_make_integer(sc, hold->message.getMidiChannelMetaEventChannel());
+      return s7_make_integer(sc, msg.getMidiChannelMetaEventChannel());
     case MidiValues::MidiValueTempo:
-      return s7_make_real(sc, hold->message.getTempoSecondsPerQuarterNote());
+      return s7_make_real(sc, msg.getTempoSecondsPerQuarterNote());
     case MidiValues::MidiValueTimeSig:
       {
         int num, den;
-        hold->message.getTimeSignatureInfo(num, den);
+        msg.getTimeSignatureInfo(num, den);
         return s7_cons(sc, s7_make_integer(sc, num),
                        s7_cons(sc, s7_make_integer(sc, den),
                                SchemeThread::getInstance()->schemeNil));
       }
     case MidiValues::MidiValueKeySig:
-      return s7_make_integer(sc, hold->message.getKeySignatureNumberOfSharpsOrFlats());
+      return s7_make_integer(sc, msg.getKeySignatureNumberOfSharpsOrFlats());
     default:
       return SchemeThread::getInstance()->schemeFalse;
     }
 }
 
-s7_pointer cm_midifile_import(char* path, int track, s7_pointer midivalues)
+/** Returns the opcode the import uses for a message: the upper nibble
+    of a channel message's status, a meta message's type or -1. **/
+
+static int getMidiImportOpcode(const MidiMessage& msg)
 {
-  s7_scheme* scheme=SchemeThread::getInstance()->scheme;
+  if (msg.getChannel()>0)
+    return (msg.getRawData()[0] & 0xF0)>>4;
+  else if (msg.isMetaEvent())
+    return msg.getMetaEventType();
+  return -1;
+}
+
+static bool isOpForValues(const Array<int>& vals, int op)
+{
+  for (int j=0; j<vals.size(); j++)
+    if (!MidiValues::isOpForValue(vals.getUnchecked(j), op))
+      return false;
+  return true;
+}
+
+/** Reads track of file into events, returns an error message or an
+    empty string. The file is unmapped before this returns so the
+    caller can signal the error. **/
+
+static String readMidiImportTrack(const File& file, int track, MidiCaptureBuffer& events)
+{
+  MidiFileReader reader;
+  if (!reader.open(file))
+    return T("midifile-import: not a valid midifile: ") + file.getFullPathName();
+  if (track<0 || track>=reader.getNumTracks())
+    return T("midifile-import: not a valid track: ") + String(track);
+  if (!reader.readTrack(track, events))
+    return T("midifile-import: not a valid midifile: ") + file.getFullPathName();
+  // pair note ons with their offs for durations
+  events.prepare();
+  return String::empty;
+}
+
+s7_pointer cm_midifile_import(char* path, int track, s7_pointer midivalues, bool columns)
+{
+  SchemeThread* scm=SchemeThread::getInstance();
+  s7_scheme* scheme=scm->scheme;
   String name (path);
   File file=completeFile(name);
   if (!file.existsAsFile())
-    SchemeThread::getInstance()->signalSchemeError(T("midifile-import: file does not exist: ") + 
-                                                   file.getFullPathName());
-  FileInputStream* input=file.createInputStream();
-  MidiFile midifile;
-  midifile.readFrom(*input);
-  int numtracks=midifile.getNumTracks();
-  if (numtracks<1) 
-    SchemeThread::getInstance()->signalSchemeError(T("midifile-import: not a valid midifile: ") + 
-                                                   file.getFullPathName());
-  if (track<0 || track>=numtracks)
-    SchemeThread::getInstance()->signalSchemeError(T("midifile-import: not a valid track: ") + 
-                                                   String(track));
-  int format=midifile.getTimeFormat();
-  // get the track's midi data
-  MidiMessageSequence* seq=(MidiMessageSequence*)midifile.getTrack(track);
-  seq->updateMatchedPairs();
-  // juce time format is postive for beats and negative for SMTPE
-  if (format>0)
-    midifile.convertTimestampTicksToSeconds();    
-  else
-    {
-      // convert SMPTE ticks to seconds. The juce function
-      // convertTimestampTicksToSeconds doesnt seem to work for SMPTE
-      // ticks.
-      int tpf=format & 0xFF;
-      // juce smpte frames per second is negative upper byte
-      int fps=0xFF-((format & 0xFF00) >> 8)+1;
-      double smptetps=fps*tpf; // smpte ticks per second
-      for (int i=0; i<seq->getNumEvents(); i++)
-        {
-          MidiMessageSequence::MidiEventHolder* h=seq->getEventPointer(i);
-          h->message.setTimeStamp(h->message.getTimeStamp()/smptetps);
-        }
-    }
-
+    scm->signalSchemeError(T("midifile-import: file does not exist: ") + 
+                           file.getFullPathName());
   // format of values list: 1=single value, 2=multiple values, 3=list
-  // of lists eg: ("op"), ("op" "key") (("op" "key") ("op" "bend"))
-  format=1;
+  // of lists eg: ("op"), ("op" "key") (("op" "key") ("op" "bend")).
+  // the list is parsed once into an array of values for each sublist
+  int format=1;
   if (s7_is_pair(s7_car(midivalues)))
     format=3;
   else if (s7_list_length(scheme, midivalues)>1)
     format=2;
-  // transfer midi values to array
-  Array<int> vals;
-  // if not format 3 then load the array just one time
+  if (columns && format==3)
+    scm->signalSchemeError(T("midifile-import: columns need a list of midi values"));
+  OwnedArray<Array<int> > specs;
   if (format<3)
+    specs.add(new Array<int>());
+  for (s7_pointer top=midivalues; s7_is_pair(top); top=s7_cdr(top))
     {
-      for (s7_pointer p=midivalues; s7_is_pair(p); p=s7_cdr(p))
-        vals.add((int)s7_integer(s7_car(p)));
+      if (format==3)
+        {
+          specs.add(new Array<int>());
+          for (s7_pointer p=s7_car(top); s7_is_pair(p); p=s7_cdr(p))
+            specs.getLast()->add((int)s7_integer(s7_car(p)));
+        }
+      else
+        specs.getLast()->add((int)s7_integer(s7_car(top)));
+    }
+  // get the track's midi data with times in seconds
+  MidiCaptureBuffer events;
+  String error=readMidiImportTrack(file, track, events);
+  if (error.isNotEmpty())
+    scm->signalSchemeError(error);
+  int size=events.size();
+  double lasttime=0.0;
+  double lastontime=0.0;
+  if (columns)
+    {
+      // one vector per value holding the value of every message that
+      // all the values apply to, sized by counting them first
+      const Array<int>& vals=*specs[0];
+      int rows=0;
+      for (int i=0; i<size; i++)
+        {
+          int op=getMidiImportOpcode(events.getMessage(i));
+          if (op>-1 && isOpForValues(vals, op))
+            rows++;
+        }
+      s7_pointer head=scm->schemeNil;
+      for (int j=vals.size(); --j>=0; )
+        head=s7_cons(scheme, s7_make_vector(scheme, rows), head);
+      int prot=s7_gc_protect(scheme, head);
+      int row=0;
+      for (int i=0; i<size; i++)  
+        {
+          MidiMessage msg=events.getMessage(i);
+          int op=getMidiImportOpcode(msg);
+          if (op>-1 && isOpForValues(vals, op))
+            {
+              int off=events.getNoteOff(i);
+              double offtime=(off<0) ? -1.0 : events.getTime(off);
+              s7_pointer col=head;
+              for (int j=0; j<vals.size(); j++, col=s7_cdr(col))
+                s7_vector_set(scheme, s7_car(col), row,
+                              getMidiValue(scheme, msg, offtime, vals[j], op, lasttime, lastontime));
+              row++;
+            }
+          if (op>-1)
+            {
+              lasttime=msg.getTimeStamp();
+              if (op==0x9)
+                lastontime=lasttime;
+            }
+        }
+      s7_gc_unprotect_at(scheme, prot);
+      return head;
     }
   // initialize return list for rplacd value appending
-  s7_pointer empty=SchemeThread::getInstance()->schemeNil;
-  s7_pointer head=s7_cons(scheme, SchemeThread::getInstance()->schemeFalse, empty);
+  s7_pointer empty=scm->schemeNil;
+  s7_pointer head=s7_cons(scheme, scm->schemeFalse, empty);
   s7_pointer tail=head;  // tail now: (#f)
-  double lasttime=0.0;
-  double lastontime=0.0;
+  int prot=s7_gc_protect(scheme, head);
   // map all events in track
-  for (int i=0; i<seq->getNumEvents(); i++)  
-    {
-      MidiMessageSequence::MidiEventHolder* e=seq->getEventPointer(i);
-      int op=-1;
-      // only handle channel or meta messages. get the midi opcode of
-      // the event. for channel events opcode is in the upper nibble
-      // of the status byte
-      if (e->message.getChannel()>0)
-        op=(e->message.getRawData()[0] & 0xF0)>>4;
-      else if (e->message.isMetaEvent())
-        op=e->message.getMetaEventType();
-      else 
+  for (int i=0; i<size; i++)  
+    {
+      MidiMessage msg=events.getMessage(i);
+      // only handle channel or meta messages. 
+      int op=getMidiImportOpcode(msg);
+      if (op<0)
         continue;
-
-      s7_pointer top=midivalues; // top only used by format 3
-      // if format 3 set pointer to start of midivals and load the
-      // vals array with the first sublist
-      if (format==3)
-        {
-          vals.clear();
-          // first values list is car of top
-          for (s7_pointer p=s7_car(top); s7_is_pair(p); p=s7_cdr(p))
-            vals.add((int)s7_integer(s7_car(p)));
-          top=s7_cdr(top); // increment top
-        }
+      int off=events.getNoteOff(i);
+      double offtime=(off<0) ? -1.0 : events.getTime(off);
       // process all the midivalues for the current message. if format
-      // is 1 or 2 then this loop happens only one time
-      while (true)
+      // is 1 or 2 then there is only one
+      for (int k=0; k<specs.size(); k++)
         {
-          // check that all values are applicable to the current message.
-          bool ok=true;
-          for (int j=0; j<vals.size() && ok; j++) //((j<vals.size()) && (op > -1))
-            if (!MidiValues::isOpForValue(vals[j], op))
-              ok=false;
+          const Array<int>& vals=*specs.getUnchecked(k);
           // if all the values match then process them and add to return list
-          if (ok)
+          if (isOpForValues(vals, op))
             {
-              //std::cout << "event [" << i << "] op=" << op << " values are applicable\n";
               s7_pointer add=NULL;
               if (format==1)
-                add=getMidiValue(scheme, e, vals[0], op, lasttime, lastontime);
+                add=getMidiValue(scheme, msg, offtime, vals[0], op, lasttime, lastontime);
               else
                 {
                   // process vals in reverse order to cons up adds
                   add=empty;
                   for (int j=vals.size(); --j>=0; )
-                    add=s7_cons(scheme, getMidiValue(scheme, e, vals[j], op, lasttime, lastontime), add);
+                    add=s7_cons(scheme, getMidiValue(scheme, msg, offtime, vals[j], op, lasttime, lastontime), add);
                 }
               // add the new value (or list of values) onto tail.
               s7_set_cdr(tail, s7_cons(scheme, add, empty));
               tail=s7_cdr(tail);
             }
-          // if just single value list or no more lists then quit loop
-          // and move to next message
-          if (format<3 || top == empty)
-            break;
-          // else format is 3 and more lists to process, increment to next values list
-          vals.clear();
-          // next values is car of top
-          for (s7_pointer p=s7_car(top); s7_is_pair(p); p=s7_cdr(p))
-            vals.add((int)s7_integer(s7_car(p)));
-          top=s7_cdr(top);  // increment top 
         }
-
-      lasttime=e->message.getTimeStamp();
+      lasttime=msg.getTimeStamp();
       if (op==0x9)
         lastontime=lasttime;
     }
+  s7_gc_unprotect_at(scheme, prot);
   return s7_cdr(head);
 }
 
@@ -1856,6 +2056,12 @@ s7_pointer mp_is_midi_hook(int op)
     return (st->isMidiHook(op)) ? s7_make_integer(st->scheme, op) : st->schemeFalse;
 }
 
+bool mp_set_midi_batch_hook(s7_pointer proc, bool coalesce)
+{
+  // proc #f clears the batch hook
+  return SchemeThread::getInstance()->setMidiBatchHook(proc, coalesce);
+}
+
 // Csound support
 
 void cs_open_score(char* args)
@@ -95,6 +95,7 @@ double cm_sched_metro_dur(double beats, int metroId);
 
 double cm_now();
 void cm_sched_sprout(s7_pointer proc, double time, int id, int metroId = 0, double startBeat = 0);
+void cm_sched_sprout_list(s7_pointer procs, s7_pointer starts, s7_pointer ids, int metroId = 0, double startBeat = 0);
 bool cm_sched_paused_p();
 void cm_sched_pause();
 void cm_sched_continue();
@@ -106,6 +107,8 @@ bool cm_sched_score_mode_p();
 int  cm_sched_get_score_mode();
 void cm_sched_set_score_mode(int val);
 double cm_sched_score_time();
+s7_pointer cm_sched_stats(bool reset);
+void cm_sched_set_spin(double ms);
 
 // file system and pathname support
 
@@ -124,7 +127,7 @@ int cm_pathname_to_key(char* path);
 int cm_insure_new_file_version(String pathname, int vers);
 s7_pointer cm_directory(char* path, bool recurse=true);
 
-s7_pointer cm_midifile_import(char* path, int track, s7_pointer midivalues);
+s7_pointer cm_midifile_import(char* path, int track, s7_pointer midivalues, bool columns);
 s7_pointer cm_midifile_header(char* path, s7_pointer midivalues);
 
 // sal support
@@ -151,7 +154,7 @@ s7_pointer cm_mouse_button(s7_pointer upval, s7_pointer downval);
 char* cm_port_info();
 
 File completeFile(String path);
-bool mp_open_output(int dev);
+bool mp_open_output(int dev, int port);
 bool mp_open_input(int dev);
 void mp_close_output(int dev);
 void mp_close_input(int dev);
@@ -159,8 +162,8 @@ void mp_close_input(int dev);
 void mp_open_score(char* file, s7_pointer args);
 void mp_close_score();
 
-void mp_send_note(s7_pointer time, s7_pointer dur, s7_pointer key, s7_pointer vel, s7_pointer chan);
-void mp_send_data(int type, double time, double chan, double data1, double data2);
+void mp_send_note(s7_pointer time, s7_pointer dur, s7_pointer key, s7_pointer vel, s7_pointer chan, s7_pointer port);
+void mp_send_data(int type, double time, double chan, double data1, double data2, int port);
 
 void mp_play_seq();
 void mp_save_seq();
@@ -169,12 +172,20 @@ void mp_plot_seq();
 void mp_clear_seq();
 
 void mp_set_tuning(int div);
+void mp_set_lookahead(double ms);
+void mp_set_retrigger(bool retrig);
+void mp_set_extend(bool ext);
+bool mp_set_tuning_offsets(s7_pointer list);
+void mp_set_note_bends(bool bends);
 void mp_set_instruments(s7_pointer list);
+void mp_set_channel_ports(s7_pointer list);
+void mp_set_output_latency(int port, double ms);
 void mp_set_channel_mask(int m);
 void mp_set_message_mask(int m);
 
 bool mp_set_midi_hook(int op, s7_pointer proc);
 s7_pointer mp_is_midi_hook(int op);
+bool mp_set_midi_batch_hook(s7_pointer proc, bool coalesce);
 
 // csound
 
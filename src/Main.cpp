@@ -298,12 +298,29 @@ START_JUCE_APPLICATION(Grace)
                             CM CONSOLE APPLICATION                       
  *=======================================================================*/
 
+static bool printstats=false;
+static String statsfile=String::empty;
+
 void cm_cleanup()
 {
   if (SchemeThread::getInstance()->isThreadRunning())
     SchemeThread::getInstance()->stopThread(2000);
   if (MidiOutPort::getInstance()->isThreadRunning())
     MidiOutPort::getInstance()->stopThread(2000);
+  if (printstats || statsfile.isNotEmpty())
+    {
+      String stats=String::empty;
+      stats << SchemeThread::getInstance()->clock.getStatsString();
+      for (int i=0; i<MidiOutPort::NumOutputs; i++)
+        if (MidiOutPort::getInstance()->getOutput(i) != NULL)
+          stats << MidiOutPort::getInstance()->getOutput(i)->clock.getStatsString();
+      stats << XSchemeNode::pool.getStatsString()
+            << MidiNode::pool.getStatsString();
+      if (printstats)
+        std::cout << stats;
+      if (statsfile.isNotEmpty())
+        File::getCurrentWorkingDirectory().getChildFile(statsfile).replaceWithText(stats);
+    }
   SchemeThread::deleteInstance();
   delete Console::getInstance();
   MidiOutPort::deleteInstance();
@@ -329,8 +346,10 @@ int main(int argc, const char* argv[])
   cmdargs.addCommand(T("--help"), T("print help and exit"));
   cmdargs.addCommand(T("--load"), T("load file"), T("<file>"));
   cmdargs.addCommand(T("--eval"), T("evaluate expression"), T("<expr>"));
-  cmdargs.addCommand(T("--batch"), T("process options and exit"));
+  cmdargs.addCommand(T("--batch"), T("process options, render any scores and exit"));
   cmdargs.addCommand(T("--quiet"), T("don't print startup banner"));
+  cmdargs.addCommand(T("--stats"), T("print scheduler and node pool statistics on exit"));
+  cmdargs.addCommand(T("--stats-file"), T("write scheduler and node pool statistics to file on exit"), T("<file>"));
   String err=cmdargs.init(args);
   if (!err.isEmpty())
     {
@@ -361,6 +380,10 @@ int main(int argc, const char* argv[])
   //con->printOutput(vers);
   SchemeThread* scm=SchemeThread::getInstance();
   scm->setQuiet(cmdargs.getCommandArg(T("--quiet")) != NULL);
+  printstats=(cmdargs.getCommandArg(T("--stats")) != NULL);
+  CommandArg* statsarg=cmdargs.getCommandArg(T("--stats-file"));
+  if (statsarg != NULL)
+    statsfile=statsarg->expr;
   scm->setPriority(10);
   scm->startThread();
   MidiOutPort* mid=MidiOutPort::getInstance();
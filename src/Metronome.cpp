@@ -53,6 +53,7 @@ bool Metronome::removePoint(int point)
   int index = (point - 1) * 2;
   bpmGraph.remove(index + 1);
   bpmGraph.remove(index);
+  graphChanged();
   return true;
 }
 
@@ -67,6 +68,7 @@ void Metronome::addPoint(double x, double y, bool insertBeforeEqualPoints)
         int index = getPointIndex(i + 1);
         bpmGraph.insert(index, x);
         bpmGraph.insert(index + 1, y);
+        graphChanged();
         return;
       }
     }
@@ -77,6 +79,7 @@ void Metronome::addPoint(double x, double y, bool insertBeforeEqualPoints)
         int index = getPointIndex(i + 1);
         bpmGraph.insert(index, x);
         bpmGraph.insert(index + 1, y);
+        graphChanged();
         return;
       }
     }
@@ -90,20 +93,27 @@ double Metronome::getBeatAtTime(double time)
 
 double Metronome::getTimeAtBeat(double beat)
 {
-  double currentBeat = getNowBeat();
-  double currentTime = getNowTime();
-  double beatDelta = beat - currentBeat;
-  double timeDelta = getTimeDeltaBeatsLater(currentTime, beatDelta);
-  return currentTime + timeDelta;  
+  /*Inverts the tempo map directly: find the segment holding the beat and
+  solve for the time in it, no need to integrate forward from now.*/
+  int k = findSegmentAtBeat(beat);
+  const Segment& s = segments.getReference(k);
+  double beatDelta = beat - s.beat;
+  if(k == segments.size() - 1 || beatDelta < 0) //after or before the graph
+    return s.time + ((60 * beatDelta) / s.tempo);
+  const Segment& e = segments.getReference(k + 1);
+  double slope = (e.tempo - s.tempo) / (e.time - s.time);
+  /*Beats from the segment start are (tempo*dt + slope*dt^2/2)/60, solve for
+  dt. This form of the quadratic root is also correct when slope is 0.*/
+  double disc = (s.tempo * s.tempo) + (120 * slope * beatDelta);
+  double denom = s.tempo + sqrt((disc > 0) ? disc : 0);
+  if(denom <= 0)
+    return e.time;
+  return s.time + ((120 * beatDelta) / denom);
 }
 
 double Metronome::getTimeDeltaToBeat(double beat)
 {
-  double currentBeat = getNowBeat();
-  double currentTime = getNowTime();
-  double beatDelta = beat - currentBeat;
-  double timeDelta = getTimeDeltaBeatsLater(currentTime, beatDelta);
-  return timeDelta;  
+  return getTimeAtBeat(beat) - getNowTime();
 }
 
 double Metronome::getTimeToNextBeat(double division)
@@ -128,73 +138,7 @@ double Metronome::getNowBeat()
 
 double Metronome::getTimeDeltaBeatsLater(double startTime, double beatsLater)
 {
-
-  //First determine if "time" lies beyond the end of the graph,
-  int numberOfPoints = bpmGraphLength();
-  if(startTime >= getTimePoint(numberOfPoints)) //lies beyond . . . 
-    return (60 * beatsLater) / getTempoPoint(numberOfPoints);
-  /*The graph has seconds on the x axis, but beats per minute on the y axis.
-  multiplying the "beatsLater" variable by 60 allows the integration to come out
-  right.  Otherwise there's an error of a factor of 60 (as in secs/min).*/
-  beatsLater = beatsLater * 60;
-  
-  double x0, y0, x1, y1;
-  double gx0, gy0, gx1, gy1;
-  double slope;
-  
-  if(startTime < getTimePoint(1)) //lies before . . . 
-  {
-    slope = 0;
-    gx1 = getTimePoint(1);
-    gy1 = getTempoPoint(1);
-  }
-  else
-  {
-    for(int i = bpmGraphLength(); i >= 2; i--)
-    {
-      if(startTime <= getTimePoint(i) && startTime >= getTimePoint(i - 1)) //time is between the points
-      { //calculate the slope of the line found.
-        gx0 = getTimePoint(i - 1);
-        gy0 = getTempoPoint(i - 1);
-        gx1 = getTimePoint(i);
-        gy1 = getTempoPoint(i);
-        slope = (gy1 - gy0) / (gx1 - gx0);
-        break;
-      }
-    }
-  }
-  //Calculate the time and tempo of the target point (some number of beats later).
-  x0 = startTime;
-  y0 = getTempoFromTime(startTime);
-  double temp_y1; //must keep this variable in scope.
-  
-  if(slope == 0)
-  {
-    y1 = y0;
-    x1 = (beatsLater / y0) + x0;
-  }
-  else
-  {
-    double yIntercept = y0 - (slope * x0);
-    temp_y1 = ((2 * slope * beatsLater) + (y0 * y0));
-    if(temp_y1 >= 0)
-    {
-      y1 = sqrt(temp_y1);
-      x1 = (y1 - yIntercept) / slope;
-    }
-  }
-    
-  double result;
-  if(x1 > gx1 || temp_y1 < 0) 
-  {
-    double beatsFulfilled = (gx1 - x0) * (gy1 + y0) / 2;
-    //recursively calls itself if the bpmGraph has extra points under the area in question
-    double extratime = getTimeDeltaBeatsLater(gx1, (beatsLater - beatsFulfilled) / 60);
-    result = (gx1 - x0) + extratime;
-  }
-  else
-    result = x1 - x0;
-  return result;
+  return getTimeAtBeat(integrateGraph(startTime) + beatsLater) - startTime;
 }
 
 double Metronome::getNowTime(void)
@@ -230,6 +174,7 @@ void Metronome::collapseBeatGraph()
   }
   for(i--; i >= 0; i--)
     bpmGraph.remove(i);
+  graphChanged();
 }
 
 void Metronome::addPointNow()
@@ -242,6 +187,7 @@ void Metronome::addPointNow()
     {
       bpmGraph.insert(i + 2, x);
       bpmGraph.insert(i + 3, y);
+      graphChanged();
       break;
     }
   }
@@ -273,6 +219,7 @@ void Metronome::removeDuplicatePoints()
     {
       bpmGraph.remove(i - 2);
       bpmGraph.remove(i - 3);
+      graphChanged();
       i = 3;//Will be incremented to equal 5 on the next iteration
     }
   }
@@ -280,54 +227,89 @@ void Metronome::removeDuplicatePoints()
 
 double Metronome::integrateGraph(double nowVal)
 {
-  double x1, x2;
-  double y1, y2;
-  double beatTotal = beatOffset;
-  int numberOfPoints = bpmGraph.size() * .5;
-  int currentPoint = 1;
-  int curIndex = 0;
-  while (currentPoint < numberOfPoints && nowVal > bpmGraph[curIndex + 2])
-  {
-    x1 = bpmGraph[curIndex];
-    y1 = bpmGraph[curIndex + 1];
-    x2 = bpmGraph[curIndex + 2];
-    y2 = bpmGraph[curIndex + 3];
-    beatTotal = beatTotal + (((x2 - x1) / 60) * ((y1 + y2) / 2));
-    currentPoint = currentPoint + 1;  
-    curIndex = (currentPoint - 1) * 2;    
-  }
-  x1 = bpmGraph[curIndex];
-  y1 = bpmGraph[curIndex + 1];
-  x2 = nowVal;
-  y2 = getTempoFromTime(nowVal);
-  beatTotal = beatTotal + (((x2 - x1) / 60) * ((y1 + y2) / 2));
-  return beatTotal;
+  //The beat at the start of the segment plus the area of the trapezoid up to nowVal.
+  int k = findSegmentAtTime(nowVal);
+  const Segment& s = segments.getReference(k);
+  double y2 = getTempoFromTime(nowVal);
+  return s.beat + (((nowVal - s.time) / 60) * ((s.tempo + y2) / 2));
 }
 
 double Metronome::getTempoFromTime(double time)
 {
-  double y1, y2;
-  double x1 = bpmGraph[0];
-  double x2 = bpmGraph[bpmGraph.size() - 2];
-  if(time <= x1)
-    return bpmGraph[1];
-  else if(time >= x2)
-    return bpmGraph[bpmGraph.size() - 1];
-  else
+  int k = findSegmentAtTime(time);
+  const Segment& s = segments.getReference(k);
+  if(time <= s.time || k == segments.size() - 1) //before or after the graph
+    return s.tempo;
+  const Segment& e = segments.getReference(k + 1);
+  return (((time - s.time) * (e.tempo - s.tempo)) / (e.time - s.time)) + s.tempo;
+}
+
+void Metronome::graphChanged()
+{
+  segmentsValid = false;
+}
+
+void Metronome::updateSegments()
+{
+  segments.clearQuick();
+  int numberOfPoints = bpmGraphLength();
+  double beat = beatOffset;
+  for(int i = 0; i < numberOfPoints; i++)
   {
-    for(int i = 0; i < bpmGraph.size(); i = i + 2)
+    Segment s;
+    s.time = bpmGraph[i * 2];
+    s.tempo = bpmGraph[(i * 2) + 1];
+    if(i > 0)
     {
-      if(bpmGraph[i] >= time)
-      {
-        x1 = bpmGraph[i - 2];
-        y1 = bpmGraph[i - 1];
-        x2 = bpmGraph[i];
-        y2 = bpmGraph[i + 1];
-        break;
-      }
+      const Segment& p = segments.getReference(i - 1);
+      beat = beat + (((s.time - p.time) / 60) * ((p.tempo + s.tempo) / 2));
     }
-    return (((time - x1) * (y2 - y1)) / (x2 - x1)) + y1;
-  }    
+    s.beat = beat;
+    segments.add(s);
+  }
+  if(lastSegment >= segments.size())
+    lastSegment = 0;
+  segmentsValid = true;
+}
+
+int Metronome::findSegmentAtTime(double time)
+{
+  //Returns the last segment whose start time is before time (or 0).
+  if(!segmentsValid)
+    updateSegments();
+  int last = segments.size() - 1;
+  //try the hint and its successor first, "now" moves forward slowly
+  for(int k = lastSegment; k <= lastSegment + 1 && k <= last; k++)
+    if((k == 0 || segments.getReference(k).time < time) &&
+       (k == last || segments.getReference(k + 1).time >= time))
+      return lastSegment = k;
+  int lo = 0, hi = last;
+  while(lo < hi)
+  {
+    int mid = (lo + hi + 1) / 2;
+    if(segments.getReference(mid).time < time)
+      lo = mid;
+    else
+      hi = mid - 1;
+  }
+  return lastSegment = lo;
+}
+
+int Metronome::findSegmentAtBeat(double beat)
+{
+  //Returns the last segment whose start beat is at or before beat (or 0).
+  if(!segmentsValid)
+    updateSegments();
+  int lo = 0, hi = segments.size() - 1;
+  while(lo < hi)
+  {
+    int mid = (lo + hi + 1) / 2;
+    if(segments.getReference(mid).beat <= beat)
+      lo = mid;
+    else
+      hi = mid - 1;
+  }
+  return lo;
 }
 
 void Metronome::setFutureTempo(double tempo, double time, bool issec)
@@ -356,6 +338,7 @@ void Metronome::setFutureTempo(double tempo, double time, bool issec)
     bpmGraph.add(currentTime + time);
     bpmGraph.add(tempo);
   }
+  graphChanged();
 }
 
 bool Metronome::adjustBeatToTime(double targetTime, double targetTempo, int mode) //mode -1 slow, 0 smart, 1 fast
@@ -641,6 +624,7 @@ void Metronome::reset(double tempo)
   bpmGraph.clear();
   bpmGraph.add(time);
   bpmGraph.add(tempo);
+  graphChanged();
 }
 
 void Metronome::printGraph()
@@ -650,20 +634,21 @@ void Metronome::printGraph()
 }
 
 Metronome::Metronome(double curtime, double tempo) : beatOffset(0), identifier(0),
-  preventChangesBeforeTime(0)
+  preventChangesBeforeTime(0), segmentsValid(false), lastSegment(0)
 {
   bpmGraph.add(curtime);
   bpmGraph.add(tempo);
 }
 
 Metronome::Metronome(double tempo) : beatOffset(0), identifier(0),
-  preventChangesBeforeTime(0)
+  preventChangesBeforeTime(0), segmentsValid(false), lastSegment(0)
 {
   bpmGraph.add(getNowTime());
   bpmGraph.add(tempo);
 }
 
-Metronome::Metronome() : beatOffset(0), identifier(0), preventChangesBeforeTime(0)
+Metronome::Metronome() : beatOffset(0), identifier(0), preventChangesBeforeTime(0),
+  segmentsValid(false), lastSegment(0)
 {
   bpmGraph.add(getNowTime());
   bpmGraph.add(60);
@@ -17,6 +17,27 @@ struct Metronome
   double beatOffset;
   double preventChangesBeforeTime;
   Array<double, CriticalSection> bpmGraph;
+
+  /*The tempo map is cached as segments holding each graph point's time,
+  tempo and the cumulative beat at that time, so conversions are binary
+  searches instead of integrating the graph from its start. Anything that
+  changes bpmGraph or beatOffset must call graphChanged() so the segments
+  are rebuilt on next use.*/
+  struct Segment
+  {
+    double time;
+    double tempo;
+    double beat;
+  };
+  Array<Segment> segments;
+  bool segmentsValid;
+  int lastSegment; //search hint, conversions are mostly near "now"
+  void graphChanged();
+  void updateSegments();
+  /*Returns the index of the segment containing time (or beat). Index 0
+  also covers times before the graph and the last index times after it.*/
+  int findSegmentAtTime(double time);
+  int findSegmentAtBeat(double beat);
   
   bool floatCompare(double a, double b);
   
@@ -0,0 +1,299 @@
+/*=======================================================================*
+  Copyright (C) 2012 Rick Taube.
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the Lisp Lesser Gnu Public License. The text of
+  this agreement is available at http://www.cliki.net/LLGPL
+ *=======================================================================*/
+
+#include "MicroTuning.h"
+
+MicroTuning::MicroTuning()
+  : chancounter (0)
+{
+  Tables& t=tables[0];
+  t.numzones=1;
+  t.chancount=16;
+  t.custom=false;
+  t.notebends=false;
+  t.avoiddrum=true;
+  t.bendwidth=2;
+  current=&t;
+  resetChannels();
+  setDivisions(1);
+}
+
+MicroTuning::Reader::Reader(const MicroTuning& tuning)
+  : owner (tuning),
+    index (enter(tuning)),
+    tables (tuning.tables[index])
+{
+}
+
+MicroTuning::Reader::~Reader()
+{
+  --owner.readers[index];
+}
+
+int MicroTuning::Reader::enter(const MicroTuning& tuning)
+{
+  // count ourselves in and then check the tables are still current.
+  // if a setter swapped them meanwhile they may already be its spare,
+  // so count out and try again.
+  while (true)
+    {
+      int i=(tuning.current.get()==&tuning.tables[0]) ? 0 : 1;
+      ++tuning.readers[i];
+      if (tuning.current.get()==&tuning.tables[i])
+        return i;
+      --tuning.readers[i];
+    }
+}
+
+MicroTuning::Tables& MicroTuning::getSpare()
+{
+  // the setters are serialized so the tables not being read are ours
+  // once the readers that had them before the last swap are done
+  int i=(current.get()==&tables[0]) ? 1 : 0;
+  while (readers[i].get()>0)
+    Thread::yield();
+  tables[i]=*current.get();
+  return tables[i];
+}
+
+void MicroTuning::setDivisions(int divs)
+{
+  const ScopedLock lock (writelock);
+  Tables& t=getSpare();
+  divs=jlimit(1, 16, divs);
+  for (int z=0; z<divs; z++)
+    t.offsets[z]=(double)z/(double)divs;
+  t.numzones=divs;
+  t.custom=false;
+  t.notebends=false;
+  update(t);
+}
+
+bool MicroTuning::setOffsets(const Array<double>& cents)
+{
+  int num=cents.size();
+  if (num<1 || num>16 || cents[0] != 0.0)
+    return false;
+  for (int z=1; z<num; z++)
+    if (cents[z] < cents[z-1]+1.0 || cents[z] >= 100.0)
+      return false;
+  const ScopedLock lock (writelock);
+  Tables& t=getSpare();
+  for (int z=0; z<num; z++)
+    t.offsets[z]=cents[z]/100.0;
+  t.numzones=num;
+  t.custom=true;
+  t.notebends=false;
+  update(t);
+  return true;
+}
+
+void MicroTuning::setNoteBends(bool bends)
+{
+  const ScopedLock lock (writelock);
+  Tables& t=getSpare();
+  if (bends)
+    {
+      // note bend mode has a single zone on every channel
+      t.offsets[0]=0.0;
+      t.numzones=1;
+      t.custom=false;
+    }
+  t.notebends=bends;
+  resetChannels();
+  update(t);
+}
+
+void MicroTuning::setAvoidDrumTrack(bool avoid)
+{
+  const ScopedLock lock (writelock);
+  Tables& t=getSpare();
+  t.avoiddrum=avoid;
+  update(t);
+}
+
+void MicroTuning::setPitchBendWidth(int width)
+{
+  const ScopedLock lock (writelock);
+  Tables& t=getSpare();
+  t.bendwidth=jmax(1, width);
+  update(t);
+}
+
+void MicroTuning::update(Tables& t)
+{
+  t.chancount=16/t.numzones;
+  // physical channels of each user channel's zones. this keeps the
+  // old drum track rule, which moves a note off channel 9 to channel
+  // 8.
+  for (int c=0; c<16; c++)
+    for (int z=0; z<t.numzones; z++)
+      {
+        int chan=((c % t.chancount)*t.numzones)+z;
+        if ((chan==9) && t.avoiddrum)
+          chan--;
+        t.zonechans[c][z]=chan;
+      }
+  int claimed=t.chancount*t.numzones;
+  for (int c=0; c<16; c++)
+    t.chanzones[c]=(c<claimed) ? (c % t.numzones) : 0;
+  // a keynum's zone is the nearest offset above its key, or the next
+  // key's first zone. zone z ends halfway to the next offset and ties
+  // go up, like rounding. each grid cell holds the zone at its start
+  // and the boundary inside it (offsets are at least a cent apart so
+  // there is never more than one).
+  double bounds[16];
+  for (int z=0; z<t.numzones; z++)
+    bounds[z]=(t.offsets[z]+((z+1<t.numzones) ? t.offsets[z+1] : 1.0))/2.0;
+  int zone=0;
+  for (int g=0; g<GridSize; g++)
+    {
+      double lo=(double)g/(double)GridSize;
+      double hi=(double)(g+1)/(double)GridSize;
+      while (zone<t.numzones && bounds[zone]<=lo)
+        zone++;
+      t.gridzones[g]=(signed char)((zone<t.numzones) ? zone : -1);
+      t.gridbounds[g]=(zone<t.numzones && bounds[zone]<hi) ? bounds[zone] : 2.0;
+    }
+  // the finished tables replace the ones map() reads
+  current=&t;
+}
+
+double MicroTuning::getChannelOffset(int chan) const
+{
+  Reader r (*this);
+  const Tables& t=r.tables;
+  if (t.notebends)
+    return 0.0;
+  return t.offsets[t.chanzones[jlimit(0, 15, chan)]];
+}
+
+int MicroTuning::getChannelBend(int chan) const
+{
+  Reader r (*this);
+  const Tables& t=r.tables;
+  double offset=(t.notebends) ? 0.0 : t.offsets[t.chanzones[jlimit(0, 15, chan)]];
+  return toBend(offset, t.bendwidth);
+}
+
+int MicroTuning::toBend(double semitones, int width)
+{
+  // pitch bends are 0 to 16383 with 8192 the center, spanning
+  // -width to width semitones
+  double bend=((semitones+width)/(2.0*width))*16383.0;
+  return jlimit(0, 16383, (int)(bend+0.5));
+}
+
+void MicroTuning::resetChannels()
+{
+  const SpinLock::ScopedLockType lock (chanlock);
+  for (int c=0; c<16; c++)
+    {
+      chanheld[c]=0;
+      chanends[c]=0.0;
+      chanorders[c]=0;
+      for (int k=0; k<128; k++)
+        notechans[c][k]=-1;
+    }
+  chancounter=0;
+}
+
+int MicroTuning::allocateChannel(bool avoiddrum, double ontime, double offtime)
+{
+  // use the free channel that was given out longest ago, so a note's
+  // release isn't cut off by a new bend. if every channel is busy the
+  // oldest note loses its channel. called with chanlock held.
+  int chan=-1, oldest=-1;
+  for (int c=0; c<16; c++)
+    {
+      if ((c==9) && avoiddrum)
+        continue;
+      if (oldest<0 || chanorders[c]<chanorders[oldest])
+        oldest=c;
+      if (chanheld[c]==0 && chanends[c]<=ontime &&
+          (chan<0 || chanorders[c]<chanorders[chan]))
+        chan=c;
+    }
+  if (chan<0)
+    chan=oldest;
+  chanorders[chan]=++chancounter;
+  if (offtime<0.0)
+    chanheld[chan]++;
+  else if (offtime>chanends[chan])
+    chanends[chan]=offtime;
+  return chan;
+}
+
+void MicroTuning::map(int chan, double keynum, MicroNote& note,
+                      double ontime, double offtime)
+{
+  Reader r (*this);
+  const Tables& t=r.tables;
+  chan=jlimit(0, 15, chan);
+  int key=(int)floor(keynum);
+  note.bend=-1;
+  if (t.notebends)
+    {
+      // each note gets a channel of its own and its own bend
+      note.key=jlimit(0, 127, key);
+      note.bend=toBend(keynum-key, t.bendwidth);
+      const SpinLock::ScopedLockType lock (chanlock);
+      note.chan=allocateChannel(t.avoiddrum, ontime, offtime);
+      if (offtime<0.0)
+        {
+          // a key mapped on twice only remembers the second channel,
+          // so the first is no longer held
+          int c=notechans[chan][note.key];
+          if (c>=0 && chanheld[c]>0)
+            chanheld[c]--;
+          notechans[chan][note.key]=(signed char)note.chan;
+        }
+    }
+  else if (chan<t.chancount*t.numzones)
+    {
+      double frac=keynum-key;
+      int cell=jlimit(0, GridSize-1, (int)(frac*GridSize));
+      int zone=t.gridzones[cell];
+      if (frac>=t.gridbounds[cell])
+        zone=(zone+1<t.numzones) ? zone+1 : -1;
+      if (zone<0)
+        {
+          key++;
+          zone=0;
+        }
+      note.chan=t.zonechans[chan][zone];
+      note.key=jlimit(0, 127, key);
+    }
+  else
+    {
+      // channels above the zones are not tuned
+      note.chan=chan;
+      note.key=jlimit(0, 127, (int)keynum);
+    }
+}
+
+void MicroTuning::mapOff(int chan, double keynum, MicroNote& note)
+{
+  if (isNoteBends())
+    {
+      chan=jlimit(0, 15, chan);
+      note.key=jlimit(0, 127, (int)floor(keynum));
+      note.bend=-1;
+      const SpinLock::ScopedLockType lock (chanlock);
+      int c=notechans[chan][note.key];
+      note.chan=(c<0) ? chan : c;
+      if (c>=0)
+        {
+          // the note's channel is free again
+          notechans[chan][note.key]=-1;
+          if (chanheld[c]>0)
+            chanheld[c]--;
+        }
+    }
+  else
+    map(chan, keynum, note);
+}
@@ -0,0 +1,169 @@
+/*=======================================================================*
+  Copyright (C) 2012 Rick Taube.
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the Lisp Lesser Gnu Public License. The text of
+  this agreement is available at http://www.cliki.net/LLGPL
+ *=======================================================================*/
+
+#ifndef MICROTUNING_H
+#define MICROTUNING_H
+
+#include "Libraries.h"
+
+/*=======================================================================*
+                                Micro Tuning
+ *=======================================================================*/
+
+/** A microtuned note: its physical channel and integer key. If bend is
+    not -1 the channel must be sent that pitch bend before the note. **/
+
+struct MicroNote
+{
+  int chan;
+  int key;
+  int bend;
+};
+
+/** Maps fractional keynums to physical midi channels and keys. A
+    tuning divides each semitone into zones, each zone claims a
+    physical channel that is detuned by a pitch bend. User channel n
+    addresses the block of channels starting at n*zones, so a tuning
+    with z zones has 16/z user channels. The zones are either equal
+    divisions of the semitone (1 to 16, as before) or a set of cent
+    offsets like the steps of a scala file. In note bend mode there are
+    no zones, each note is given a free channel and its own pitch bend
+    (like MPE). A channel is busy until its note ends or is mapped off,
+    if every channel is busy the one given out longest ago is reused.
+
+    All the arithmetic is done once by the setters, which build the
+    tables that map() reads, so a note costs a few array lookups. The
+    setters build new tables in a spare copy and then swap it in. Readers
+    count themselves in on the tables they use and a setter waits for
+    its spare's readers to finish before overwriting it, so the tuning
+    can be changed from any thread while notes are being mapped. **/
+
+class MicroTuning
+{
+ public:
+
+  MicroTuning();
+  ~MicroTuning() {}
+
+  /** Sets an equal tuning of divs (1-16) divisions per semitone. **/
+  void setDivisions(int divs);
+
+  /** Sets zones at the given cent offsets above each key. There can
+      be 1 to 16 offsets, each 0 <= offset < 100, at least a cent apart
+      and the first must be 0. Returns false (and leaves the tuning alone) if the offsets are
+      invalid. **/
+  bool setOffsets(const Array<double>& cents);
+
+  /** Turns note bend mode on or off. **/
+  void setNoteBends(bool bends);
+
+  void setAvoidDrumTrack(bool avoid);
+  void setPitchBendWidth(int width);
+
+  bool isNoteBends() const {return Reader(*this).tables.notebends;}
+  bool isCustom() const {return Reader(*this).tables.custom;}
+  bool isAvoidDrumTrack() const {return Reader(*this).tables.avoiddrum;}
+  int getPitchBendWidth() const {return Reader(*this).tables.bendwidth;}
+
+  /** True if map() does anything, ie the tuning has more than one
+      zone or is in note bend mode. **/
+  bool isMicrotonal() const
+  {
+    Reader r (*this);
+    return r.tables.notebends || (r.tables.numzones>1);
+  }
+
+  /** Returns the number of zones (the divisions of an equal
+      tuning). **/
+  int getDivisions() const {return Reader(*this).tables.numzones;}
+
+  /** Returns the number of user channels. **/
+  int getChannelCount() const {return Reader(*this).tables.chancount;}
+
+  /** Returns the number of physical channels claimed by the
+      zones. **/
+  int getChannelsClaimed() const
+  {
+    Reader r (*this);
+    return r.tables.chancount*r.tables.numzones;
+  }
+
+  /** Returns the detuning of a physical channel in semitones. **/
+  double getChannelOffset(int chan) const;
+
+  /** Returns the 14 bit pitch bend that tunes a physical channel. **/
+  int getChannelBend(int chan) const;
+
+  /** Maps a user channel and keynum to a physical note. In note bend
+      mode the note's channel is busy from ontime until offtime
+      (milliseconds on any clock the caller keeps to), if offtime is
+      negative it is busy until the note is mapped off. **/
+  void map(int chan, double keynum, MicroNote& note, double ontime=0.0,
+           double offtime=-1.0);
+
+  /** Maps a note off. In note bend mode this returns the channel the
+      last note on for the same channel and key was given and frees
+      it. **/
+  void mapOff(int chan, double keynum, MicroNote& note);
+
+  /** Frees every channel in note bend mode, call this when the
+      caller's clock changes. **/
+  void resetChannels();
+
+ private:
+
+  enum {GridSize=1000}; // zone lookup cells per semitone
+
+  /** Everything map() reads. **/
+  struct Tables
+  {
+    int numzones;
+    int chancount;
+    bool custom;
+    bool notebends;
+    bool avoiddrum;
+    int bendwidth;
+    double offsets[16];           // zone offsets in semitones
+    int zonechans[16][16];        // user channel and zone to physical channel
+    int chanzones[16];            // physical channel to zone
+    signed char gridzones[GridSize];  // zone at the start of each cell, -1 is the next key
+    double gridbounds[GridSize];      // where the next zone starts in the cell or 2.0
+  };
+  Tables tables[2];
+  Atomic<Tables*> current;      // the tables map() reads
+  mutable Atomic<int> readers[2];   // threads reading each of the tables
+  CriticalSection writelock;    // serializes the setters
+
+  /** Holds the current tables for as long as it exists, a setter
+      won't reuse them as its spare until every reader is gone. **/
+  class Reader
+  {
+   private:
+    const MicroTuning& owner;
+    int index;
+    static int enter(const MicroTuning& tuning);
+   public:
+    Reader(const MicroTuning& tuning);
+    ~Reader();
+    const Tables& tables;
+  };
+
+  // note bend mode channels, shared by every thread that maps notes
+  SpinLock chanlock;
+  int chanheld[16];             // notes waiting for mapOff
+  double chanends[16];          // when the channel's last timed note ends
+  int chanorders[16];           // when the channel was last given out
+  int chancounter;
+  signed char notechans[16][128];   // channel of each note in note bend mode
+
+  Tables& getSpare();
+  void update(Tables& t);
+  int allocateChannel(bool avoiddrum, double ontime, double offtime);
+  static int toBend(double semitones, int width);
+};
+
+#endif
@@ -26,82 +26,91 @@ juce_ImplementSingleton(MidiInPort)
 //  Nodes
 //
 
+// several seconds of dense output (and their pending note offs) fit
+// in the pool before it overflows to the heap
+
+NodePool MidiNode::pool (T("midi-nodes"), sizeof(MidiNode), 16384);
+
 MidiNode::MidiNode(int typ, double wait, double *vals, int num_vals)
-  : type (0), time (0.0), message (NULL), midiOutPort (NULL)
+  : type (0), time (0.0), duration (0.0), message (NULL), midiOutPort (NULL),
+    order (0), inboxnext (NULL)
 { 
   type=typ;
   time=wait;
-  for (int i=0;i<num_vals;i++)
-    values.add(vals[i]);
+  values[DATA0]=values[DATA1]=values[DATA2]=0.0;
+  for (int i=0;i<num_vals && i<3;i++)
+    values[i]=vals[i];
 }
 
 MidiNode::MidiNode(int typ, double wait, double chan, double data1) 
-  : type (0), time (0.0), duration (0.0), message (NULL), midiOutPort (NULL)
+  : type (0), time (0.0), duration (0.0), message (NULL), midiOutPort (NULL),
+    order (0), inboxnext (NULL)
 {
   type=typ;
   time=wait;
-  values.add(chan);
-  values.add(data1);
+  values[DATA0]=chan;
+  values[DATA1]=data1;
+  values[DATA2]=0.0;
 }
 
 MidiNode::MidiNode(int typ, double wait, double chan, double data1,
 		   double data2) 
-  : type (0), time (0.0), duration (0.0), message (NULL), midiOutPort (NULL)
+  : type (0), time (0.0), duration (0.0), message (NULL), midiOutPort (NULL),
+    order (0), inboxnext (NULL)
 {
   type=typ;
   time=wait;
-  values.add(chan);
-  values.add(data1);
-  values.add(data2);
+  values[DATA0]=chan;
+  values[DATA1]=data1;
+  values[DATA2]=data2;
 }
 
 MidiNode::MidiNode(int typ, double wait, double chan, double data1,
 		   double data2, double dur) 
-  : type (0), time (0.0), duration (0.0), message (NULL), midiOutPort (NULL)
+  : type (0), time (0.0), duration (0.0), message (NULL), midiOutPort (NULL),
+    order (0), inboxnext (NULL)
 {
   type=typ;
   time=wait;
   duration=dur;
-  values.add(chan);
-  values.add(data1);
-  values.add(data2);
+  values[DATA0]=chan;
+  values[DATA1]=data1;
+  values[DATA2]=data2;
 }
 
 MidiNode::MidiNode(MidiMessage *msg)
-  : type (0), time (0.0), duration (0.0), message (NULL), midiOutPort (NULL)
+  : type (0), time (0.0), duration (0.0), message (NULL), midiOutPort (NULL),
+    order (0), inboxnext (NULL)
 {
   type=MM_MESSAGE;
   time=msg->getTimeStamp();
   message=msg;
+  values[DATA0]=values[DATA1]=values[DATA2]=0.0;
+}
+
+MidiNode::MidiNode(const MidiOutEvent& event)
+  : type (event.type), time (event.time), duration (event.duration),
+    message (event.message), midiOutPort (NULL), order (0), inboxnext (NULL)
+{
+  values[DATA0]=event.values[DATA0];
+  values[DATA1]=event.values[DATA1];
+  values[DATA2]=event.values[DATA2];
 }
 
 MidiNode::~MidiNode() { 
-  values.clear();
+  if (message) delete message;
 }
 
-bool MidiNode::process()
+void MidiNode::process()
 {
-  bool flag=false;
   switch (type)
     {
       
     case MM_ON:
       if ( values[DATA2] > 0.0 )
 	{
-	  // handle velocity ranges 0.0-1.0 or 0.0-127.0
-          float vel=(float)((values[DATA2]>1.0) ? (values[DATA2]/127.0) : values[DATA2]);
-          MidiMessage msg=MidiMessage::noteOn((int)values[DATA0]+1, 
-					      (int)values[DATA1], 
-					      vel);
-	  msg.setTimeStamp(time);
-	  midiOutPort->sendOut(msg);
-          if (duration>0.0)
-            {
-              type=MM_OFF;
-              time += (duration*1000.0);
-              duration=0.0;
-              flag=true;  // signal to reschedule this node as a note off
-            }
+	  // note offs are kept in the port's note off table
+	  midiOutPort->sendNoteOn(this);
 	}
       else 
 	{
@@ -180,37 +189,243 @@ bool MidiNode::process()
     default:
       break;
     }
-  return flag;
+}
+
+//
+// Output Ring
+//
+
+MidiOutRing::MidiOutRing(int size)
+  : events (NULL),
+    mask (0)
+{
+  // size must be a power of 2, one slot is always left empty
+  jassert((size & (size-1))==0);
+  events=new MidiOutEvent[size];
+  mask=size-1;
+}
+
+MidiOutRing::~MidiOutRing()
+{
+  MidiOutEvent event;
+  while (pop(event))
+    if (event.message != NULL)
+      delete event.message;
+  delete[] events;
+}
+
+bool MidiOutRing::push(const MidiOutEvent& event)
+{
+  int w=writepos.get();
+  int next=(w+1) & mask;
+  if (next==readpos.get())
+    return false;
+  events[w]=event;
+  // publish the event before the new write position
+  Atomic<int>::memoryBarrier();
+  writepos.set(next);
+  return true;
+}
+
+bool MidiOutRing::pop(MidiOutEvent& event)
+{
+  int r=readpos.get();
+  if (r==writepos.get())
+    return false;
+  event=events[r];
+  Atomic<int>::memoryBarrier();
+  readpos.set((r+1) & mask);
+  return true;
+}
+
+//
+// Output Inbox
+//
+
+MidiNodeInbox::~MidiNodeInbox()
+{
+  MidiNode* node=popAll();
+  while (node != NULL)
+    {
+      MidiNode* next=node->inboxnext;
+      delete node;
+      node=next;
+    }
+}
+
+void MidiNodeInbox::push(MidiNode* node)
+{
+  MidiNode* top;
+  do
+    {
+      top=head.get();
+      node->inboxnext=top;
+    }
+  while (!head.compareAndSetBool(node, top));
+}
+
+MidiNode* MidiNodeInbox::popAll()
+{
+  // nodes are stacked newest first so reverse them
+  MidiNode* node=head.exchange(NULL);
+  MidiNode* list=NULL;
+  while (node != NULL)
+    {
+      MidiNode* next=node->inboxnext;
+      node->inboxnext=list;
+      list=node;
+      node=next;
+    }
+  return list;
+}
+
+//
+// Output Queue
+//
+
+MidiNodeQueue::~MidiNodeQueue()
+{
+  clear();
+}
+
+void MidiNodeQueue::add(MidiNode* node)
+{
+  node->order=counter++;
+  heap.add(node);
+  ++numnodes;
+}
+
+MidiNode* MidiNodeQueue::removeFirst()
+{
+  if (heap.isEmpty())
+    return NULL;
+  --numnodes;
+  return heap.removeFirst();
+}
+
+void MidiNodeQueue::clear()
+{
+  for (int i=heap.size()-1; i>=0; i--)
+    delete heap.getUnchecked(i);
+  heap.clear();
+  numnodes.set(0);
+}
+
+//
+// Note Off Table
+//
+
+MidiNoteOffTable::MidiNoteOffTable()
+  : heap (Comparator(entries), Index(entries))
+{
+  for (int i=0; i<NumEntries; i++)
+    {
+      entries[i].time=0.0;
+      entries[i].count=0;
+      entries[i].hindex=-1;
+    }
+  heap.ensureStorageAllocated(NumEntries);
+}
+
+double MidiNoteOffTable::getFirstTime() const
+{
+  return (heap.isEmpty()) ? HUGE_VAL : entries[heap.getFirst()].time;
+}
+
+void MidiNoteOffTable::add(int chan, int key, double time, bool extend)
+{
+  int entry=toIndex(chan, key);
+  Entry& e=entries[entry];
+  if (e.hindex<0)
+    {
+      e.time=time;
+      e.count=1;
+      heap.add(entry);
+    }
+  else
+    {
+      // the key is already sounding, its off goes at the earlier
+      // time or waits for the later note if extending
+      e.count++;
+      if ((extend) ? (time > e.time) : (time < e.time))
+        {
+          e.time=time;
+          heap.update(e.hindex);
+        }
+    }
+  ++numpending;
+}
+
+int MidiNoteOffTable::removeFirst(int& chan, int& key, double& time)
+{
+  if (heap.isEmpty())
+    return 0;
+  int entry=heap.getFirst();
+  chan=entry/128;
+  key=entry%128;
+  time=entries[entry].time;
+  int count=entries[entry].count;
+  removeAt(0);
+  return count;
+}
+
+int MidiNoteOffTable::remove(int chan, int key)
+{
+  int entry=toIndex(chan, key);
+  if (entries[entry].hindex<0)
+    return 0;
+  int count=entries[entry].count;
+  removeAt(entries[entry].hindex);
+  return count;
+}
+
+void MidiNoteOffTable::clear()
+{
+  for (int i=0; i<heap.size(); i++)
+    {
+      entries[heap.getUnchecked(i)].hindex=-1;
+      entries[heap.getUnchecked(i)].count=0;
+    }
+  heap.clear();
+  numpending.set(0);
+}
+
+void MidiNoteOffTable::removeAt(int index)
+{
+  int entry=heap.getUnchecked(index);
+  numpending-=entries[entry].count;
+  entries[entry].count=0;
+  heap.removeAt(index);
+  entries[entry].hindex=-1;
 }
 
 //
 // Queue
 //
 
-void MidiOutPort::sendOut(MidiMessage& msg)
+void MidiOutDevice::sendOut(MidiMessage& msg)
 {
-  // WARNING: this should only be called by process().  SHOULD THIS
-  // CHECK DEVICE?
-  if (device)
+  // WARNING: this should only be called by process().
+  if (device == NULL)
+    return;
+  if (block != NULL)
   {
+    // collected by sendBlock(), block positions are microseconds
+    int pos=(int)((msg.getTimeStamp()-blockstart)*1000.0);
+    block->addEvent(msg, jmax(0, pos));
+  }
+  else
     device->sendMessageNow(msg);
-    if ( isRecordMode(CaptureModes::RecordMidiOut) )
-    {
-      // if this is the first recorded note cache its time offset so
-      // we can subtract this value from the subsequence messages (we
-      // want the capture sequence timeline to be in zero-based
-      // seconds.)
+  if (recordOutput.get())
+    recording.add(msg);
+}
 
-      if (recordTimeOffset<0)
-      {
-        recordTimeOffset=msg.getTimeStamp();
-        std::cout << "Record time offset=" << recordTimeOffset << "\n";
-      }
-      // convert millisecond timestamps from output queue to seconds
-      // before adding messages to the capture sequence
-      double sec=(msg.getTimeStamp()-recordTimeOffset)/1000.0;
-      captureSequence.addEvent( MidiMessage(msg,sec) );
-    }
+void MidiOutPort::sendOut(MidiMessage& msg)
+{
+  if (device)
+  {
+    // records the message in RecordMidiOut mode
+    MidiOutDevice::sendOut(msg);
   }
 #ifdef GRACE
   // If no MIDI port is open then send message to audio manager in
@@ -231,22 +446,63 @@ void MidiOutPort::sendOut(MidiMessage& msg)
 /// MIDI OUT PORT
 ///
 
-MidiOutPort::MidiOutPort()
-  : Thread(T("Midi Out Port")),
-    device(0),
+MidiOutDevice::MidiOutDevice(const String& threadname, const String& clockname)
+  : Thread(threadname),
     devid (-1),
-    microdivisions (1),  // micro initialized for semitone
-    microincrement (1.0),
-    microchancount (16),
-    microchanblock (16),
-    avoiddrumtrack (true),
-    pitchbendwidth (2),
+    device (NULL),
+    ring (8192),
+    clock (clockname),
+    block (NULL),
+    blockstart (0.0),
+    blockdevice (NULL),
+    recordingCopied (0)
+{
+}
+
+MidiOutDevice::~MidiOutDevice()
+{
+  stopThread(100);
+  if (device != NULL)
+    delete device;
+  outputNodes.clear();  // ring and inbox free their own contents
+}
+
+void MidiOutDevice::setDevice(MidiOutput* dev, int id)
+{
+  // let the output thread finish with the device first
+  bool running=isThreadRunning();
+  if (running)
+    stopThread(1000);
+  if (device != NULL)
+    delete device;
+  device=dev;
+  devid=id;
+  // the new device's background thread has not been started (it can
+  // be allocated where the old one was) and the queue is connected to
+  // the old one
+  sequencer.close();
+  blockdevice=NULL;
+  if (running)
+    startThread(9);
+}
+
+MidiOutPort::MidiOutPort()
+  : MidiOutDevice(T("Midi Out Port"), T("midi-out")),
     recordTimeOffset (-1.0),
+    inputRecordingCopied (0),
     recordmode(CaptureModes::Off),
     console (NULL)
 {	
   for(int i=0;i<16;i++)
     programchanges[i]=0;
+  // this is output 0, all channels go to it until they are mapped
+  outputs[0]=this;
+  for (int i=1; i<NumOutputs; i++)
+    outputs[i]=NULL;
+  for (int i=0; i<NumOutputs; i++)
+    latencies[i]=0.0;
+  for (int i=0; i<16; i++)
+    chanports[i]=0;
   tuningnames.add(T("Semitone"));
   tuningnames.add(T("Quartertone"));
   tuningnames.add(T("33 Cent"));
@@ -263,7 +519,7 @@ MidiOutPort::MidiOutPort()
   tuningnames.add(T("7.1 Cent"));
   tuningnames.add(T("6.6 Cent"));
   tuningnames.add(T("6.25 Cent"));
-  captureSequence.clear();
+  captureBuffer.clear();
   for (int i=0; i<128; i++)
     instrumentnames.add(MidiMessage::getGMInstrumentName(i));
 
@@ -277,14 +533,16 @@ MidiOutPort::MidiOutPort()
 
 MidiOutPort::~MidiOutPort()
 {
+  // DOES NOT CALL CLOSE SO THE LAST PORT SETTING IS STILL VALID FOR
+  // PREFS. the other outputs stop their threads and close their
+  // devices when they are deleted
   stopThread(100);
-  // DOES NOT CALL CLOSE SO THE LAST PORT SETTING IS STILL VALID FOR PREFS
-  if (device != NULL)
-    delete device;
+  for (int i=1; i<NumOutputs; i++)
+    if (outputs[i] != NULL)
+      delete outputs[i];
   tuningnames.clear();
   instrumentnames.clear();
-  outputNodes.clear();
-  captureSequence.clear();
+  captureBuffer.clear();
   tracks.clear();
 }
 
@@ -315,14 +573,18 @@ bool MidiOutPort::open(int id)
   // dont do anything if opening same port
   if (id == devid) 
     return true;
+  // a device can only be open on one output
+  for (int i=1; i<NumOutputs; i++)
+    if (outputs[i] != NULL && outputs[i]->device != NULL && outputs[i]->devid == id)
+    {
+      Console::getInstance()->printError(T(">>> Error: Midi output device ") + String(id) + T(" is already open on port ") + String(i) + T(".\n"));
+      return false;
+    }
 
-  // delete current port. IS THIS CORRECT?
-  if (device != NULL)
-  {
-    delete device;
-    devid=-1;
-  }
-  device = MidiOutput::openDevice(id);
+  // replace the current device once the output thread is done with
+  // it, on failure the port is left closed
+  MidiOutput* dev=MidiOutput::openDevice(id);
+  setDevice(dev, (dev==NULL) ? -1 : id);
   if (device==NULL)
   {
 #ifdef GRACE
@@ -333,9 +595,8 @@ bool MidiOutPort::open(int id)
   }
   else  // SUCCESS!
   {
-    devid=id;
     // send current tuning automatically if its microtonal
-    if (getTuning()>1)
+    if (tuning.isMicrotonal())
       sendTuning();
 #ifdef GRACE
     // update Preferences with current port's name;
@@ -349,16 +610,32 @@ bool MidiOutPort::open(int id)
 
 bool MidiOutPort::isOpen(int id) 
 {
-  if (device == NULL)
-    return false;
-  else if (id == -1) // asking if ANY output device is open
-    return true;
-  else
-    return (id == devid); // asking if specific dev is open
+  for (int i=0; i<NumOutputs; i++)
+  {
+    MidiOutDevice* out=outputs[i];
+    if (out == NULL || out->device == NULL)
+      continue;
+    else if (id == -1) // asking if ANY output device is open
+      return true;
+    else if (id == out->devid) // asking if specific dev is open
+      return true;
+  }
+  return false;
 }
 
 void MidiOutPort::close(int id)
 {
+  // a device open on another output is closed there
+  for (int i=1; i<NumOutputs; i++)
+  {
+    MidiOutDevice* out=outputs[i];
+    if (out != NULL && out->device != NULL && (id == -1 || id == out->devid))
+    {
+      out->setDevice(NULL, -1);
+      if (id != -1)
+        return;
+    }
+  }
   if (device!=NULL)
   {
 #ifdef GRACE
@@ -366,12 +643,143 @@ void MidiOutPort::close(int id)
     Preferences::getInstance()->setStringProp(T("MidiOutDevice"), juce::String::empty);
 #endif
     // FIXME: DO I UPDATE AUDIO MANAGER TOO?
-    delete device;
-    device=NULL;
-    devid=-1;
+    setDevice(NULL, -1);
   }
 }
 
+bool MidiOutPort::openOutput(int id, int port)
+{
+  if (port == 0)
+    return open(id);
+  if (port < 0 || port >= NumOutputs)
+  {
+    Console::getInstance()->printError(T(">>> Error: Midi output port ") + String(port) + T(" is not 0 to ") + String(NumOutputs-1) + T(".\n"));
+    return false;
+  }
+  if (isOpen(id))
+  {
+    if (outputs[port] != NULL && outputs[port]->devid == id)
+      return true;
+    Console::getInstance()->printError(T(">>> Error: Midi output device ") + String(id) + T(" is already open.\n"));
+    return false;
+  }
+  MidiOutput* dev=MidiOutput::openDevice(id);
+  if (dev == NULL)
+  {
+    Console::getInstance()->printError(T(">>> Error: Failed to open midi output device ") + String(id) + T(".\n"));
+    return false;
+  }
+  MidiOutDevice* out=outputs[port];
+  if (out == NULL)
+  {
+    // outputs are never deleted before the port so the scheduler can
+    // route to them without locking
+    out=new MidiOutDevice(T("Midi Out Port ") + String(port), 
+                          T("midi-out-") + String(port));
+    out->setLookahead(getLookahead());
+    out->setRetrigger(isRetrigger());
+    out->setExtend(isExtend());
+    out->clock.setSpinTime(clock.getSpinTime());
+    out->recordOutput.set(isRecordMode(CaptureModes::RecordMidiOut));
+    out->device=dev;
+    out->devid=id;
+    outputs[port]=out;
+    updateDelays();
+    out->startThread(9);
+  }
+  else
+    out->setDevice(dev, id);
+  // send current tuning automatically if its microtonal
+  if (tuning.isMicrotonal())
+    sendTuning();
+  return true;
+}
+
+MidiOutDevice* MidiOutPort::getOutput(int port)
+{
+  return (port >= 0 && port < NumOutputs) ? outputs[port] : NULL;
+}
+
+int MidiOutPort::getRoute(int port, int chan)
+{
+  if (getOutput(port) == NULL)
+    port=chanports[jlimit(0, 15, chan)];
+  return (outputs[port] != NULL) ? port : 0;
+}
+
+void MidiOutPort::setChannelPort(int chan, int port)
+{
+  if (chan >= 0 && chan < 16)
+    chanports[chan]=jlimit(0, NumOutputs-1, port);
+}
+
+int MidiOutPort::getChannelPort(int chan)
+{
+  return chanports[jlimit(0, 15, chan)];
+}
+
+void MidiOutPort::setOutputLatency(int port, double ms)
+{
+  if (port < 0 || port >= NumOutputs)
+    return;
+  latencies[port]=jmax(0.0, ms);
+  updateDelays();
+}
+
+void MidiOutPort::updateDelays()
+{
+  // the slowest output is sent on time, the others wait for it
+  double slowest=0.0;
+  for (int i=0; i<NumOutputs; i++)
+    slowest=jmax(slowest, latencies[i]);
+  for (int i=0; i<NumOutputs; i++)
+    if (outputs[i] != NULL)
+      outputs[i]->setDelay(slowest-latencies[i]);
+}
+
+bool MidiOutPort::isOutputQueueActive()
+{
+  for (int i=0; i<NumOutputs; i++)
+    if (outputs[i] != NULL && outputs[i]->MidiOutDevice::isOutputQueueActive())
+      return true;
+  return false;
+}
+
+void MidiOutPort::clear()
+{
+  for (int i=0; i<NumOutputs; i++)
+    if (outputs[i] != NULL)
+      outputs[i]->MidiOutDevice::clear();
+}
+
+void MidiOutPort::setLookahead(double ms)
+{
+  for (int i=0; i<NumOutputs; i++)
+    if (outputs[i] != NULL)
+      outputs[i]->MidiOutDevice::setLookahead(ms);
+}
+
+void MidiOutPort::setRetrigger(bool retrig)
+{
+  for (int i=0; i<NumOutputs; i++)
+    if (outputs[i] != NULL)
+      outputs[i]->MidiOutDevice::setRetrigger(retrig);
+}
+
+void MidiOutPort::setExtend(bool ext)
+{
+  for (int i=0; i<NumOutputs; i++)
+    if (outputs[i] != NULL)
+      outputs[i]->MidiOutDevice::setExtend(ext);
+}
+
+void MidiOutPort::setSpinTime(double ms)
+{
+  for (int i=0; i<NumOutputs; i++)
+    if (outputs[i] != NULL)
+      outputs[i]->clock.setSpinTime(ms);
+}
+
 int MidiOutPort::performCommand(CommandID id, int data, String text)
 {
   // lower eight bits of id encode command information
@@ -396,11 +804,15 @@ int MidiOutPort::performCommand(CommandID id, int data, String text)
 
 
     case CommandIDs::SchedulerScoreComplete :
-      if (isSequenceData())
+      if (scoreStream.isOpen())
+        closeScore();
+      else if (isSequenceData())
 	{
 	  saveSequence(false);
 	  clearSequence();
 	}
+      // note bend channels were timed in score milliseconds
+      tuning.resetChannels();
       break;
 
     case CommandIDs::MidiOutTuning :
@@ -500,19 +912,35 @@ int MidiOutPort::getRecordMode()
 
 void MidiOutPort::setRecordMode(int mode)
 {
+  syncRecording();
   switch (mode)
     {
     case CaptureModes::RecordMidiOut :
+      if (recordmode != mode)
+        for (int i=0; i<NumOutputs; i++)
+          if (outputs[i] != NULL)
+            {
+              outputs[i]->recording.clear();
+              outputs[i]->recordingCopied=0;
+            }
       recordTimeOffset=-1;
       recordmode=mode;
       break;
     case CaptureModes::RecordMidiIn :
+      if (recordmode != mode)
+        {
+          inputRecording.clear();
+          inputRecordingCopied=0;
+        }
       recordmode=mode;
       break;
     default:
       recordmode=CaptureModes::Off;
       break;
     }
+  for (int i=0; i<NumOutputs; i++)
+    if (outputs[i] != NULL)
+      outputs[i]->recordOutput.set(recordmode==CaptureModes::RecordMidiOut);
 }
 
 bool MidiOutPort::isRecordMode(int mode)
@@ -520,29 +948,68 @@ bool MidiOutPort::isRecordMode(int mode)
   return (recordmode==mode);
 }
 
+void MidiOutPort::recordInput(const MidiMessage& msg)
+{
+  // called by the midi input thread
+  if (isRecordMode(CaptureModes::RecordMidiIn))
+    inputRecording.add(msg);
+}
+
+void MidiOutPort::syncRecording()
+{
+  // copy whatever input has arrived since the last sync into the
+  // capture buffer, timed from the first message recorded
+  inputRecordingCopied=inputRecording.copyTo(captureBuffer, inputRecordingCopied);
+  // output is timed from the earliest message not yet copied when
+  // the offset is unset
+  if (recordTimeOffset<0)
+    for (int i=0; i<NumOutputs; i++)
+      {
+        MidiOutDevice* out=outputs[i];
+        if (out != NULL && out->recordingCopied < out->recording.size())
+          {
+            double t=out->recording.getTime(out->recordingCopied);
+            if (recordTimeOffset<0 || t<recordTimeOffset)
+              recordTimeOffset=t;
+          }
+      }
+  if (recordTimeOffset<0)
+    return;
+  // convert millisecond timestamps from the outputs to seconds
+  for (int i=0; i<NumOutputs; i++)
+    if (outputs[i] != NULL)
+      outputs[i]->recordingCopied=outputs[i]->recording.
+        copyTo(captureBuffer, outputs[i]->recordingCopied, recordTimeOffset, 0.001);
+}
+
 bool MidiOutPort::isRecordingAvailable()
 {
-  return (recordmode==CaptureModes::Off) && (captureSequence.getNumEvents()>0);
+  syncRecording();
+  return (recordmode==CaptureModes::Off) && (!captureBuffer.isEmpty());
 }
 
 bool MidiOutPort::isSequenceEmpty()
 {
-  return (captureSequence.getNumEvents()==0);
+  syncRecording();
+  return captureBuffer.isEmpty();
 }
 
 bool MidiOutPort::isSequenceData()
 {
-  return (captureSequence.getNumEvents()>0);
+  syncRecording();
+  return (!captureBuffer.isEmpty());
 }
 
 void MidiOutPort::resetRecordingStart()
 {
+  syncRecording();
   recordTimeOffset=-1;
 }
 
 void MidiOutPort::clearSequence()
 {
-  captureSequence.clear();
+  syncRecording();
+  captureBuffer.clear();
   recordTimeOffset=-1;
 }
 
@@ -551,17 +1018,18 @@ void MidiOutPort::copySequenceToTrack(int index)
   // add a new track if index is -1 else replace track at index
   if (isSequenceData())
     {
-      captureSequence.updateMatchedPairs();
+      MidiMessageSequence seq;
+      captureBuffer.copyTo(seq);
       String name;
       if (index>=0 && index<tracks.size())
 	{
 	  name=getTrackName(index);
-	  tracks.set(index, new MidiTrack( name, captureSequence));
+	  tracks.set(index, new MidiTrack( name, seq));
 	}
       else
 	{
 	  name=T("Untitled Track ") + String(tracks.size()+1);
-	  tracks.add(new MidiTrack( name, captureSequence));
+	  tracks.add(new MidiTrack( name, seq));
 	}
     }
 }
@@ -570,38 +1038,39 @@ void MidiOutPort::playSequence()
 {
   if (isSequenceEmpty() || (! isOpen()))
     return;
-  captureSequence.updateMatchedPairs();
-  for (int i=0; i< captureSequence.getNumEvents(); i++)
+  captureBuffer.prepare();
+  for (int i=0; i< captureBuffer.size(); i++)
     {
-      MidiMessageSequence::MidiEventHolder* h =
-	captureSequence.getEventPointer(i);
-      if (h->message.isNoteOn())
+      MidiMessage msg=captureBuffer.getMessage(i);
+      if (msg.isNoteOn())
 	{
-	  if (h->noteOffObject != NULL)
+	  int off=captureBuffer.getNoteOff(i);
+	  if (off>=0)
 	    {
-	      sendMessage(new MidiMessage(h->message), false);
-	      sendMessage(new MidiMessage(h->noteOffObject->message), false);
+	      sendMessage(new MidiMessage(msg), false);
+	      sendMessage(new MidiMessage(captureBuffer.getMessage(off)), false);
 	    }
 	}
       else
-	sendMessage(new MidiMessage(h->message), false);
+	sendMessage(new MidiMessage(msg), false);
     }
 }
 
 void MidiOutPort::plotSequence()
 {
-  //captureSequence.updateMatchedPairs();
+  //captureBuffer.prepare();
 }
 
 void MidiOutPort::printSequence()
 {
-  captureSequence.updateMatchedPairs();
+  syncRecording();
+  captureBuffer.prepare();
   String text=T("Midi Seq: ");
-  int size=captureSequence.getNumEvents();
+  int size=captureBuffer.size();
   text << String(size) << T(" event");
   if (size!=1)
     text << T("s");
-  text << T(", ") << String(captureSequence.getEndTime())
+  text << T(", ") << String(captureBuffer.getEndTime())
        << T(" seconds\n");
   /***  console->printMessage(text);
    ***/
@@ -679,21 +1148,17 @@ void MidiOutPort::copyTrackToSequence(int index, bool add, double shift)
 {
   if ((index>=0) && (index<tracks.size()))
     {
+      syncRecording();
       if (!add) 
-	captureSequence.clear();
-      bool update=(captureSequence.getNumEvents()>0);
-      captureSequence.
+	captureBuffer.clear();
+      // only Channel messages are copied, the buffer pairs notes when
+      // it is used
+      captureBuffer.
 	addSequence( *(tracks.getUnchecked(index)->sequence),
 		     shift,
 		     0.0,
 		     tracks.getUnchecked(index)->sequence->getEndTime()+shift+1
 		     );
-      // delete all events that are not Channel messages...
-      for (int i=captureSequence.getNumEvents()-1; i>=0; i--)
-	if (captureSequence.getEventPointer(i)->message.getChannel()==0)
-	  captureSequence.deleteEvent(i, false);
-      if (update)
-	captureSequence.updateMatchedPairs();
     }
 }
 
@@ -756,52 +1221,209 @@ void MidiOutPort::importTracks()
 // output queue 
 //
 
-void MidiOutPort::run() 
+void MidiOutDevice::run() 
 {
   double qtime, utime;
-  MidiNode* node;
   while ( true ) 
   {
     if ( threadShouldExit() )
       break;
     while ( true )
     {     
-      //      outputNodes.lockArray();
-      {
-        ScopedLock mylock (outputNodes.getLock());
-        node=outputNodes.getFirst();
-      }
-      if ( node == NULL )
+      // senders only wake us if their output is due before wakeup,
+      // so set it before we look for new output
+      wakeup.set(0.0);
+      receive();
+      qtime=getNextOutputTime();
+      if ( qtime == HUGE_VAL )
       {
-        //	outputNodes.unlockArray();      
 	break;
       }
-      qtime=node->time;
       utime=Time::getMillisecondCounterHiRes() ;
-      // this should probably test if the difference between qtime and
-      // utime is less that 1ms, if not then it probably shouldn't
-      // sleep (?)
-      if ( (qtime-utime) >= 1.5 ) 
-      { //( qtime > utime )
-        //	outputNodes.unlockArray();
-	wait(1);
+      // in lookahead mode messages are handed over ahead of time
+      double ahead=(device != NULL) ? getLookahead() : 0.0;
+      if ( qtime > utime + ahead ) 
+      {
+        // sleep until the message is due, new output that is due
+        // sooner wakes us early
+        wakeup.set(qtime - ahead);
+        if (ring.isEmpty() && inbox.isEmpty())
+          clock.waitUntil(this, qtime - ahead);
+      }
+      else if (ahead > 0.0)
+      {
+        sendBlock(utime, ahead);
       }
       else 
       {
-        ScopedLock mylock (outputNodes.getLock());
-        if (node->process())
-        {
-          outputNodes.remove(0,false);
-          outputNodes.addSorted(comparator, node); // reinsert at new time
-        }
-        else
-        {
-          outputNodes.remove(0, true);
-          //      outputNodes.unlockArray();      
-        }
+        // nothing is locked while the device is written to
+        clock.dispatched(qtime, utime);
+        clock.queueDepth(outputNodes.size()+noteOffs.size());
+        sendNext();
+        clock.callbackTime(Time::getMillisecondCounterHiRes()-utime);
       }
     }
-    wait(-1);
+    wakeup.set(HUGE_VAL);
+    if (ring.isEmpty() && inbox.isEmpty())
+      clock.waitIdle(this);
+  }
+}
+
+void MidiOutDevice::sendBlock(double now, double ahead)
+{
+  // messages are collected into lookaheadblock by sendOut() and then
+  // scheduled by the sequencer queue or the device's background
+  // thread. lateness isn't recorded since we don't know when they are
+  // sent.
+  if (device != blockdevice)
+  {
+    if (!sequencer.open(devid))
+      device->startBackgroundThread();
+    blockdevice=device;
+  }
+  lookaheadblock.clear();
+  block=&lookaheadblock;
+  blockstart=now;
+  // note offs of notes started here may fall in the same block
+  while (getNextOutputTime() <= now + ahead)
+    sendNext();
+  block=NULL;
+  clock.queueDepth(outputNodes.size()+noteOffs.size());
+  if (!lookaheadblock.isEmpty())
+  {
+    if (sequencer.isOpen())
+      sequencer.sendBlock(lookaheadblock, now);
+    else
+      device->sendBlockOfMessages(lookaheadblock, now, 1000000.0);
+  }
+  clock.callbackTime(Time::getMillisecondCounterHiRes()-now);
+}
+
+double MidiOutDevice::getNextOutputTime()
+{
+  MidiNode* node=outputNodes.getFirst();
+  double offtime=noteOffs.getFirstTime();
+  return (node != NULL && node->time < offtime) ? node->time : offtime;
+}
+
+void MidiOutDevice::sendNext()
+{
+  // note offs go before note ons at the same time so a key that ends
+  // and starts again at the same time is retriggered
+  MidiNode* node=outputNodes.getFirst();
+  if (node == NULL || noteOffs.getFirstTime() <= node->time)
+  {
+    int chan, key;
+    double time;
+    int count=noteOffs.removeFirst(chan, key, time);
+    for (int i=0; i<count; i++)
+    {
+      MidiMessage msg=MidiMessage::noteOff(chan+1, key);
+      msg.setTimeStamp(time);
+      sendOut(msg);
+    }
+  }
+  else
+  {
+    outputNodes.removeFirst();
+    node->process();
+    delete node;
+  }
+}
+
+void MidiOutDevice::sendNoteOn(MidiNode* node)
+{
+  int chan=jlimit(0, 15, (int)node->values[MidiNode::DATA0]);
+  int key=jlimit(0, 127, (int)node->values[MidiNode::DATA1]);
+  if (isRetrigger())
+  {
+    // end the sounding note before starting it again
+    int count=noteOffs.remove(chan, key);
+    for (int i=0; i<count; i++)
+    {
+      MidiMessage msg=MidiMessage::noteOff(chan+1, key);
+      msg.setTimeStamp(node->time);
+      sendOut(msg);
+    }
+  }
+  // handle velocity ranges 0.0-1.0 or 0.0-127.0
+  double amp=node->values[MidiNode::DATA2];
+  float vel=(float)((amp>1.0) ? (amp/127.0) : amp);
+  MidiMessage msg=MidiMessage::noteOn(chan+1, key, vel);
+  msg.setTimeStamp(node->time);
+  sendOut(msg);
+  if (node->duration>0.0)
+    noteOffs.add(chan, key, node->time+(node->duration*1000.0), isExtend());
+}
+
+void MidiOutDevice::setRetrigger(bool retrig)
+{
+  retrigger.set((retrig) ? 1 : 0);
+}
+
+bool MidiOutDevice::isRetrigger()
+{
+  return retrigger.get()==1;
+}
+
+void MidiOutDevice::setExtend(bool ext)
+{
+  extend.set((ext) ? 1 : 0);
+}
+
+bool MidiOutDevice::isExtend()
+{
+  return extend.get()==1;
+}
+
+void MidiOutDevice::setLookahead(double ms)
+{
+  lookaheadmicros.set((ms>0.0) ? (int)(ms*1000.0) : 0);
+  notify();
+}
+
+double MidiOutDevice::getLookahead()
+{
+  return lookaheadmicros.get()/1000.0;
+}
+
+void MidiOutDevice::setDelay(double ms)
+{
+  delaymicros.set((ms>0.0) ? (int)(ms*1000.0) : 0);
+}
+
+double MidiOutDevice::getDelay()
+{
+  return delaymicros.get()/1000.0;
+}
+
+void MidiOutDevice::receive()
+{
+  MidiOutEvent event;
+  while (ring.pop(event))
+  {
+    if (event.type==MidiNode::MM_CLEAR)
+      clear(true);
+    else
+    {
+      MidiNode* n=new MidiNode(event);
+      n->midiOutPort=this;
+      outputNodes.add(n);
+    }
+  }
+  MidiNode* node=inbox.popAll();
+  while (node != NULL)
+  {
+    MidiNode* next=node->inboxnext;
+    node->inboxnext=NULL;
+    if (node->type==MidiNode::MM_CLEAR)
+    {
+      clear(true);
+      delete node;
+    }
+    else
+      outputNodes.add(node);
+    node=next;
   }
 }
 
@@ -853,46 +1475,72 @@ void MidiOutPort::run() {
 }
 */
 
-bool MidiOutPort::isOutputQueueActive() { 
-  //  outputNodes.lockArray(); 
-  int n=outputNodes.size();
-  //  outputNodes.unlockArray();
-  return (n > 0);
+bool MidiOutDevice::isOutputQueueActive() { 
+  return (outputNodes.size() > 0) || (noteOffs.size() > 0) ||
+    !ring.isEmpty() || !inbox.isEmpty();
 }
 
-void MidiOutPort::clear()
+void MidiOutDevice::clear(bool now)
 {
-  //  outputNodes.lockArray();
-  outputNodes.clear();
-  // avoid hanging notes
-  if ( device != 0 )
-    for ( int i=1; i<=16; i++ )
-      device->sendMessageNow( MidiMessage::allSoundOff(i) );
-  //  outputNodes.unlockArray();
+  if (now)
+  {
+    // called by the output thread
+    outputNodes.clear();
+    noteOffs.clear();
+    // avoid hanging notes
+    if ( device != 0 )
+    {
+      // drop anything already handed over in lookahead mode
+      sequencer.clear();
+      device->clearAllPendingMessages();
+      for ( int i=1; i<=16; i++ )
+        device->sendMessageNow( MidiMessage::allSoundOff(i) );
+    }
+  }
+  else
+  {
+    // the output thread flushes its queue when the clear arrives,
+    // output sent after this call is kept
+    MidiOutEvent event;
+    event.type=MidiNode::MM_CLEAR;
+    event.time=event.duration=0.0;
+    event.values[0]=event.values[1]=event.values[2]=0.0;
+    event.message=NULL;
+    addEvent(event);
+  }
 }
 
-void MidiOutPort::addNode(MidiNode *n) 
+void MidiOutDevice::addNode(MidiNode *n) 
 {
-  //  outputNodes.lockArray();
   n->midiOutPort = this;
   // MILLI
-  n->time = (n->time * 1000.0) + Time::getMillisecondCounterHiRes();
+  n->time = (n->time * 1000.0) + Time::getMillisecondCounterHiRes() + getDelay();
+  double due=n->time;
+  inbox.push(n);
+  if (due < wakeup.get())
+    notify();
+}
+
+void MidiOutDevice::addEvent(MidiOutEvent& event)
+{
+  // MILLI
+  event.time = (event.time * 1000.0) + Time::getMillisecondCounterHiRes() + getDelay();
+  // the scheduler thread is the ring's only producer, everyone else
+  // (and the scheduler if the ring is full) goes through the inbox
+  if (Thread::getCurrentThreadId() != SchemeThread::getInstance()->getThreadId() ||
+      !ring.push(event))
   {
-    ScopedLock mylock (outputNodes.getLock());
-    outputNodes.addSorted(comparator, n);
+    MidiNode* n=new MidiNode(event);
+    n->midiOutPort=this;
+    inbox.push(n);
   }
-  //  outputNodes.unlockArray();
-  /*  printf("added type=%d, at %f pos=%d of %d\n", 
-	 n->type,
-	 n->time,
-	 outputNodes.indexOf(n),
-	 outputNodes.size()
-	 ); */
-  notify();
+  if (event.time < wakeup.get())
+    notify();
 }
 
 void MidiOutPort::sendNote(double wait, double duration, double keynum, 
-			   double amplitude, double channel, bool toseq) 
+			   double amplitude, double channel, bool toseq,
+                           int port) 
 {
   //  std::cout << "channel=" << channel << "\n";
 
@@ -900,34 +1548,24 @@ void MidiOutPort::sendNote(double wait, double duration, double keynum,
 
   //  std::cout << "after jlimit channel=" << channel << "\n";
 
-  // only microtune if current tuning is not semitonal and user's
-  // channel is a microtonal channel.
-  if ((getTuning() > 1) && (channel < microchanblock)) 
+  // the output is chosen by the user's channel, before tuning maps it
+  port=(toseq) ? 0 : getRoute(port, (int)channel);
+
+  // only microtune if current tuning is not semitonal. the tuning's
+  // tables map the user's channel and keynum to a physical channel
+  // and key, in note bend mode the note also needs its own bend.
+  if (tuning.isMicrotonal())
   {
-    // insure user's channel a valid microtonal channel, ie a channel
-    // within the first zone of microtuned channels and then shift to
-    // actual physical channel
-    int chan=(((int)channel) % microchancount) * microdivisions;
-    // calculate integer midi key quantize user's keynum to microtonal
-    // resolution size. this may round up to the next keynum. if it rounds up (or
-    // down) to an integer keynum then we dont need to microtune
-    keynum = cm_quantize( keynum, microincrement);
-    int key=(int)keynum;
-    // only microtune if we have a fractional keynum
-    if (keynum > key) 
-    {
-      // divide the fractional portion of keynum by the resolution size
-      // to see which zone of channels its in
-      int zone=(int)((keynum-key)/microincrement);
-      // shift channel to the appropriate zone and set keynum to integer
-      chan += zone;
-      if ((chan == 9) && avoiddrumtrack)
-      {
-        chan--;
-      }
-      channel=chan;
-      keynum=key;
-    }
+    // in note bend mode the note's channel is busy until it ends,
+    // score times and real time are both kept in milliseconds
+    double ontime=(toseq) ? 0.0 : Time::getMillisecondCounterHiRes();
+    ontime+=wait*1000.0;
+    MicroNote note;
+    tuning.map((int)channel, keynum, note, ontime, ontime+(duration*1000.0));
+    channel=note.chan;
+    keynum=note.key;
+    if (note.bend>=0)
+      sendData(MidiNode::MM_BEND, wait, channel, note.bend, 0.0, toseq, port);
   }
   
   if (toseq)
@@ -935,8 +1573,8 @@ void MidiOutPort::sendNote(double wait, double duration, double keynum,
     // JUCE channel message constructors are 1-based channels
     float amp=(float)((amplitude>1.0) ? (amplitude/127) : amplitude);
 
-    captureSequence.addEvent(MidiMessage::noteOn((int)channel+1, (int)keynum, amp), wait);
-    captureSequence.addEvent(MidiMessage::noteOff((int)channel+1, (int)keynum), wait+duration);
+    addScoreMessage(MidiMessage::noteOn((int)channel+1, (int)keynum, amp), wait);
+    addScoreMessage(MidiMessage::noteOff((int)channel+1, (int)keynum), wait+duration);
     // don't call updatematchedpairs until the seq is used
   }
   // otherwise add it to the output queue, but dont do anything if
@@ -944,13 +1582,21 @@ void MidiOutPort::sendNote(double wait, double duration, double keynum,
   // NULL OUTPUT DEVICE SENDS TO PLUGINS SO ADD TO QUEUE 
   else   // if (device != NULL)
   {
-    addNode(new MidiNode(MidiNode::MM_ON, wait, channel, keynum, amplitude, duration));
+    MidiOutEvent event;
+    event.type=MidiNode::MM_ON;
+    event.time=wait;
+    event.duration=duration;
+    event.values[MidiNode::DATA0]=channel;
+    event.values[MidiNode::DATA1]=keynum;
+    event.values[MidiNode::DATA2]=amplitude;
+    event.message=NULL;
+    outputs[port]->addEvent(event);
     //addNode( new MidiNode(MidiNode::MM_OFF, wait+duration, channel, keynum) );
   }
 }
 
 void MidiOutPort::sendData(int type, double wait, double channel, 
-			   double data1, double data2, bool toseq)
+			   double data1, double data2, bool toseq, int port)
 {
   if (toseq)
   {
@@ -959,69 +1605,71 @@ void MidiOutPort::sendData(int type, double wait, double channel,
     int d2=(int)data2;
     // JUCE channel message constructors are 1 based
     if (type==MidiNode::MM_OFF)
-      captureSequence.addEvent(MidiMessage::noteOff(ch+1, d1), wait);
+      addScoreMessage(MidiMessage::noteOff(ch+1, d1), wait);
     else if (type==MidiNode::MM_ON)
-      captureSequence.addEvent(MidiMessage::noteOn(ch+1, d1, (float)data2), wait);
+      addScoreMessage(MidiMessage::noteOn(ch+1, d1, (float)data2), wait);
     else if (type==MidiNode::MM_TOUCH)
-      captureSequence.addEvent(MidiMessage::aftertouchChange(ch+1, d1, d2), wait);
+      addScoreMessage(MidiMessage::aftertouchChange(ch+1, d1, d2), wait);
     else if (type==MidiNode::MM_CTRL)
-      captureSequence.addEvent(MidiMessage::controllerEvent(ch+1, d1, d2), wait);
+      addScoreMessage(MidiMessage::controllerEvent(ch+1, d1, d2), wait);
     else if (type==MidiNode::MM_PROG)
-      captureSequence.addEvent(MidiMessage::programChange(ch+1, d1), wait);
+      addScoreMessage(MidiMessage::programChange(ch+1, d1), wait);
     else if (type==MidiNode::MM_PRESS)
-      captureSequence.addEvent(MidiMessage::channelPressureChange(ch+1, d1), wait);
+      addScoreMessage(MidiMessage::channelPressureChange(ch+1, d1), wait);
     else if (type==MidiNode::MM_BEND)
-      captureSequence.addEvent(MidiMessage::pitchWheel(ch+1, d1), wait);
+      addScoreMessage(MidiMessage::pitchWheel(ch+1, d1), wait);
   }
   // NULL OUTPUT DEVICE SENDS TO PLUGINS SO ADD TO QUEUE 
   else // if ( device != NULL )
   {
-
+    port=getRoute(port, (int)channel);
     if ( ((type==MidiNode::MM_OFF) || (type==MidiNode::MM_ON)) &&
-         (getTuning() > 1) && (channel < microchanblock) ) 
-    {
-      // insure user's channel a valid microtonal channel, ie a channel
-      // within the first zone of microtuned channels and then shift to
-      // actual physical channel
-      int chan=(((int)channel) % microchancount) * microdivisions;
-      // calculate integer midi key and quantize user's keynum to
-      // microtonal resolution size. this may round up to the next
-      // keynum quantize keynumber to tuning resolution. if it rounds
-      // up (or down) to an integer keynum then we dont need to
-      // microtune
-      data1 = cm_quantize( data1, microincrement);
-      int key=(int)data1;
-      // only microtune if we have a fractional keynum
-      if (data1 > key) 
-      {
-	// divide the fractional portion of keynum by the resolution size
-	// to see which zone of channels its in
-	int zone=(int)((data1-key)/microincrement);
-	// shift channel to the appropriate zone and set keynum to integer
-	chan += zone;
-	if ((chan == 9) && avoiddrumtrack)
-        {
-	  chan--;
-	}
-	channel=chan;
-	data1=key;
-      }
+         tuning.isMicrotonal() )
+    {
+      MicroNote note;
+      // a note on without a duration holds its channel until its off
+      if (type==MidiNode::MM_ON)
+        tuning.map((int)channel, data1, note,
+                   Time::getMillisecondCounterHiRes()+(wait*1000.0));
+      else
+        tuning.mapOff((int)channel, data1, note);
+      channel=note.chan;
+      data1=note.key;
+      if (note.bend>=0)
+        sendData(MidiNode::MM_BEND, wait, channel, note.bend, 0.0, false, port);
     }
-    addNode( new MidiNode(type, wait, channel, data1, data2) );
+    MidiOutEvent event;
+    event.type=type;
+    event.time=wait;
+    event.duration=0.0;
+    event.values[MidiNode::DATA0]=channel;
+    event.values[MidiNode::DATA1]=data1;
+    event.values[MidiNode::DATA2]=data2;
+    event.message=NULL;
+    outputs[port]->addEvent(event);
   }
 }
 
-void MidiOutPort::sendMessage(MidiMessage *message, bool toseq)
+void MidiOutPort::sendMessage(MidiMessage *message, bool toseq, int port)
 {
   if (toseq)
     {
-      captureSequence.addEvent(MidiMessage(*message));
+      addScoreMessage(*message, message->getTimeStamp());
       delete message; // hmm is this right?
     } 
   // NULL OUTPUT DEVICE SENDS TO PLUGINS SO ADD TO QUEUE 
   else //if ( device != NULL )
     {
-      addNode( new MidiNode(message) );
+      MidiOutEvent event;
+      event.type=MidiNode::MM_MESSAGE;
+      event.time=message->getTimeStamp();
+      event.duration=0.0;
+      event.values[0]=event.values[1]=event.values[2]=0.0;
+      event.message=message;
+      // messages without a channel go to port or else port 0
+      int chan=message->getChannel();
+      port=(chan>0 || getOutput(port) != NULL) ? getRoute(port, chan-1) : 0;
+      outputs[port]->addEvent(event);
     }
 }
 
@@ -1078,62 +1726,8 @@ void MidiOutPort::testOutput ()
 /// Microtuning
 ///
 
-/* tuning array (in cents, tunings X channels)
-
-    0  1  2  3  4  5  6  7  8  9 10 11 12 13 14 15
-    ----------------------------------------------
- 1  0  0  0  0  0  0  0  0  0  0  0  0  0  0  0  0
- 2  0 50  0 50  0 50  0 50  0 50  0 50  0 50  0 50
- 3  0 33 66  0 33 66  0 33 66  0 33 66  0 33 66  0
- 4  0 25 50 75  0 25 50 75  0 25 50 75  0 25 50 75
- 5  0 20 40 60 80  0 20 40 60 80  0 20 40 60 80  0
- 6  0 16 33 50 66 83  0 16 33 50 66 83  0  0  0  0
- 7  0 14 28 42 57 71 85  0 14 28 42 57 71 85  0  0
- 8  0 12 25 37 50 62 75 87  0 12 25 37 50 62 75 87
- 9  0 11 22 33 44 55 66 77 88  0  0  0  0  0  0  0
-10  0 10 20 30 40 50 60 70 80 90  0  0  0  0  0  0
-11  0  9 18 27 36 45 54 63 72 81 90  0  0  0  0  0
-12  0  8 16 25 33 41 50 58 66 75 83 91  0  0  0  0
-13  0  7 15 23 30 38 46 53 61 69 76 84 92  0  0  0
-14  0  7 14 21 28 35 42 50 57 64 71 78 85 92  0  0
-15  0  6 13 20 26 33 42 46 53 60 66 73 80 86 93  0
-16  0  6 12 18 25 31 37 43 50 56 62 68 75 81 87 93
-
-;; this calculates the array contents
-(loop for div from 1 to 16 
-   for zones = div
-   for width = (floor (/ 16 div))
-   for uses = (* width zones)
-   do
-     (let ((a (/ 1.0 div)))
-       (format t "~:[{~;{{~]" (= div 1))
-       (loop for c below uses by zones
-	  do (loop for z below zones 
-	        do (format t "~:[, ~;~]~f" (= z c 0) (* z a))))
-       (loop repeat (- 16 uses) do (format t ", ~f" 0.0))
-       (format t "}~:[,~%~;};~%~]" (= div 16))))
-*/
-
-double MidiOutPort::channeltunings[16][16] =
-{{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
-{0.0, 0.5, 0.0, 0.5, 0.0, 0.5, 0.0, 0.5, 0.0, 0.5, 0.0, 0.5, 0.0, 0.5, 0.0, 0.5},
-{0.0, 0.33333334, 0.6666667, 0.0, 0.33333334, 0.6666667, 0.0, 0.33333334, 0.6666667, 0.0, 0.33333334, 0.6666667, 0.0, 0.33333334, 0.6666667, 0.0},
-{0.0, 0.25, 0.5, 0.75, 0.0, 0.25, 0.5, 0.75, 0.0, 0.25, 0.5, 0.75, 0.0, 0.25, 0.5, 0.75},
-{0.0, 0.2, 0.4, 0.6, 0.8, 0.0, 0.2, 0.4, 0.6, 0.8, 0.0, 0.2, 0.4, 0.6, 0.8, 0.0},
-{0.0, 0.16666667, 0.33333334, 0.5, 0.6666667, 0.8333334, 0.0, 0.16666667, 0.33333334, 0.5, 0.6666667, 0.8333334, 0.0, 0.0, 0.0, 0.0},
-{0.0, 0.14285715, 0.2857143, 0.42857146, 0.5714286, 0.71428573, 0.8571429, 0.0, 0.14285715, 0.2857143, 0.42857146, 0.5714286, 0.71428573, 0.8571429, 0.0, 0.0},
-{0.0, 0.125, 0.25, 0.375, 0.5, 0.625, 0.75, 0.875, 0.0, 0.125, 0.25, 0.375, 0.5, 0.625, 0.75, 0.875},
-{0.0, 0.11111111, 0.22222222, 0.33333334, 0.44444445, 0.5555556, 0.6666667, 0.7777778, 0.8888889, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
-{0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.90000004, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
-{0.0, 0.09090909, 0.18181819, 0.27272728, 0.36363637, 0.45454547, 0.54545456, 0.6363636, 0.72727275, 0.8181819, 0.90909094, 0.0, 0.0, 0.0, 0.0, 0.0},
-{0.0, 0.083333336, 0.16666667, 0.25, 0.33333334, 0.4166667, 0.5, 0.5833334, 0.6666667, 0.75, 0.8333334, 0.9166667, 0.0, 0.0, 0.0, 0.0},
-{0.0, 0.07692308, 0.15384616, 0.23076925, 0.30769232, 0.3846154, 0.4615385, 0.53846157, 0.61538464, 0.6923077, 0.7692308, 0.84615386, 0.923077, 0.0, 0.0, 0.0},
-{0.0, 0.071428575, 0.14285715, 0.21428573, 0.2857143, 0.35714287, 0.42857146, 0.5, 0.5714286, 0.6428572, 0.71428573, 0.7857143, 0.8571429, 0.92857146, 0.0, 0.0},
-{0.0, 0.06666667, 0.13333334, 0.20000002, 0.26666668, 0.33333334, 0.40000004, 0.4666667, 0.53333336, 0.6, 0.6666667, 0.73333335, 0.8000001, 0.86666673, 0.9333334, 0.0},
-{0.0, 0.0625, 0.125, 0.1875, 0.25, 0.3125, 0.375, 0.4375, 0.5, 0.5625, 0.625, 0.6875, 0.75, 0.8125, 0.875, 0.9375}};
-
 int MidiOutPort::getTuning() {
-  return microdivisions;
+  return tuning.getDivisions();
 }
 
 void MidiOutPort::setTuning(int tune, bool send) {
@@ -1141,21 +1735,31 @@ void MidiOutPort::setTuning(int tune, bool send) {
   // each division of a tuning claims a physical midi channel tuned to
   // the division's cent value by sending a pitch bend. channels with
   // 0 cents are assignable by users.
-  jlimit(1,16,tune);
-  microdivisions=tune;  // tuning (1-16) = divisions per semitone.
-  microincrement=1.0/tune; // size of microdivision as fraction of 1
-  microchancount=(int)(16.0/((double)microdivisions)); // num user addressable microchans
-  microchanblock=microchancount*microdivisions; // total num chans claimed
-  //  printf("Tuning=%d, size=%f, chans=%d, claim=%d\n", microdivisions,
-	 //	 microincrement, microchancount, microchanblock);
+  tuning.setDivisions(tune);
+  if (send)
+    sendTuning();
+}
+
+bool MidiOutPort::setTuningOffsets(const Array<double>& cents, bool send) {
+  if (!tuning.setOffsets(cents))
+    return false;
+  if (send)
+    sendTuning();
+  return true;
+}
+
+void MidiOutPort::setNoteBends(bool bends, bool send) {
+  tuning.setNoteBends(bends);
+  // channels are recentered, notes send their own bends
   if (send)
     sendTuning();
 }
 
 bool MidiOutPort::isTuning(int t) {
   // return true if current tuning
-  jlimit(1,16,t);
-  return (microdivisions==t);
+  if (tuning.isCustom() || tuning.isNoteBends())
+    return false;
+  return (tuning.getDivisions()==t);
 }
 
 int MidiOutPort::getTuningDivisions(int t) {
@@ -1178,54 +1782,47 @@ int MidiOutPort::getTuningChannelsClaimed(int t) {
 
 String MidiOutPort::getTuningName (int t) {
   // jlimit(tune,1,16);
+  if (tuning.isCustom() && (t==getTuning()))
+    return T("Custom");
   return tuningnames[t-1];
 }
 
 bool MidiOutPort::avoidDrumTrack() {
-  return avoiddrumtrack;
+  return tuning.isAvoidDrumTrack();
 }
 
 void MidiOutPort::setAvoidDrumTrack(bool b) {
-  avoiddrumtrack=b;
+  tuning.setAvoidDrumTrack(b);
 }
 
 int MidiOutPort::getPitchBendWidth() {
-  return pitchbendwidth;
+  return tuning.getPitchBendWidth();
 }
 
 void MidiOutPort::setPitchBendWidth(int b) {
-  if (b<1) b=1;
-  pitchbendwidth=b;
+  tuning.setPitchBendWidth(b);
 }
 
 void MidiOutPort::sendTuning() 
 {
   if (! isOpen() )
     return;
-  int tunerow=getTuning()-1;
-  for (int c=0; c<16; c++)
-    {
-      int b=(int)round(cm_rescale( channeltunings[tunerow] [c], 
-				   -pitchbendwidth, pitchbendwidth,
-				   0, 
-				   16383,
-				   1));
-      //device->sendMessageNow( MidiMessage::pitchWheel(c+1,bendval));
-      MidiMessage* m=new MidiMessage((0xe0 | c), (b & 127), ((b >> 7) & 127));
-      addNode(new MidiNode(m));
-    }
+  // every output is tuned since any channel can be routed anywhere
+  for (int i=0; i<NumOutputs; i++)
+    if (outputs[i] != NULL && (i == 0 || outputs[i]->device != NULL))
+      for (int c=0; c<16; c++)
+        {
+          int b=tuning.getChannelBend(c);
+          //device->sendMessageNow( MidiMessage::pitchWheel(c+1,bendval));
+          MidiMessage* m=new MidiMessage((0xe0 | c), (b & 127), ((b >> 7) & 127));
+          outputs[i]->addNode(new MidiNode(m));
+        }
 }
 
 void MidiOutPort::getTuningValues(Array<int>& vals)
 {
-  int tunerow=getTuning()-1;
   for (int chan=0; chan<16; chan++)
-    vals.add( (int)round(cm_rescale( channeltunings[tunerow] [chan], 
-				     -pitchbendwidth, 
-				     pitchbendwidth,
-				     0,
-				     16383,
-				     1)));
+    vals.add(tuning.getChannelBend(chan));
 }		
 
 /*=======================================================================*
@@ -1277,17 +1874,18 @@ bool MidiOutPort::isInstrumentChannel(int chan)
 {
   // true if physical chan accepts instruments (ie is not a channel
   // claimed by microtuning)
-  return (0.0 == channeltunings[getTuning()-1][chan]);
+  return (0.0 == tuning.getChannelOffset(chan));
 }
 
 void MidiOutPort::sendInstruments() 
 {
   if (isOpen())
     {
+      // each channel's program goes to the output it is routed to
       for (int c=0; c<16; c++)
 	{
 	  MidiMessage* m=new MidiMessage((0xc0 | c), programchanges[c]);
-	  addNode(new MidiNode(m));
+	  outputs[getRoute(-1, c)]->addNode(new MidiNode(m));
 	}
     }
 }
@@ -1305,7 +1903,6 @@ void MidiOutPort::saveSequence(bool ask)
 {
   if (isSequenceEmpty()) 
     return;
-  sequenceFile.bends=(getTuning()>1) ? true : false;
 
   if (ask )//|| (sequenceFile.file==File::nonexistent)
     {
@@ -1316,22 +1913,45 @@ void MidiOutPort::saveSequence(bool ask)
         return;
     }
   
-  captureSequence.updateMatchedPairs();
-  if (sequenceFile.file.existsAsFile())
-    sequenceFile.file.deleteFile();
-  
-  FileOutputStream outputStream(sequenceFile.file);
-  MidiFile* midifile = new MidiFile();
+  // the file is written as it is encoded, the capture buffer is
+  // never copied into a MidiFile
+  MidiFileWriter writer;
+  if (!writer.open(sequenceFile.file, sequenceFile.qticks, sequenceFile.ismsec))
+    {
+      Console::getInstance()->
+	printError(T(">>> Error: can't write ") +
+		   sequenceFile.file.getFullPathName() + T("\n"));
+      return;
+    }
 
+  writeTrackZero(writer);
+
+  // If writing milliseconds then convert the buffer's seconds to
+  // milliseconds to match our smpte time format, otherwise convert
+  // seconds to division per quarter
   if (sequenceFile.ismsec)
-    midifile->setSmpteTimeFormat(25, 40); // set to 1 msec resolution
+    captureBuffer.writeTrack(writer, 1000.0);
   else
-    midifile->setTicksPerQuarterNote(sequenceFile.qticks);
+    captureBuffer.writeTrack(writer, (double)sequenceFile.qticks);
+
+  // optional clear after save
+  if (writer.close()) 
+    {
+      Console::getInstance()->
+	printOutput((T("Midifile: ") + 
+		     sequenceFile.file.getFullPathName() +
+		     T("\n")));
+      captureBuffer.clear();
+    }
+}
 
-  MidiMessageSequence track0;
-  track0.addEvent( sequenceFile.getTempoMessage(), 0);
-  track0.addEvent( sequenceFile.getTimeSigMessage(), 0);
-  track0.addEvent( sequenceFile.getKeySigMessage(), 0);
+void MidiOutPort::writeTrackZero(MidiFileWriter& writer)
+{
+  sequenceFile.bends=(getTuning()>1) ? true : false;
+  writer.beginTrack();
+  writer.writeEvent( sequenceFile.getTempoMessage(), 0);
+  writer.writeEvent( sequenceFile.getTimeSigMessage(), 0);
+  writer.writeEvent( sequenceFile.getKeySigMessage(), 0);
 
   // add optional tuning data to track 0
   Array<int> data;
@@ -1339,8 +1959,8 @@ void MidiOutPort::saveSequence(bool ask)
     {
       getTuningValues(data);
       for (int c=0; c<data.size(); c++)
-	track0.addEvent(MidiMessage((0xe0 | c), (data[c] & 127), 
-				    ((data[c] >> 7) & 127)));
+	writer.writeEvent(MidiMessage((0xe0 | c), (data[c] & 127), 
+				      ((data[c] >> 7) & 127)), 0);
     }
   // add optional program changes to track 0
   if (sequenceFile.insts)
@@ -1348,44 +1968,56 @@ void MidiOutPort::saveSequence(bool ask)
       data.clear();
       getInstruments(data);
       for (int c=0; c<data.size(); c++)
-	track0.addEvent(MidiMessage::programChange(c+1, data[c]));
+	writer.writeEvent(MidiMessage::programChange(c+1, data[c]), 0);
     }  
+  writer.endTrack();
+}
 
-  midifile->addTrack(track0);
-  midifile->addTrack(captureSequence);
+/*=======================================================================*
+                             Score Streaming
+ *=======================================================================*/
 
-  const MidiMessageSequence* seq=midifile->getTrack(1);
-  if (sequenceFile.ismsec)
+void MidiOutPort::openScore(String filename)
+{
+  setOutputFile(filename);
+  if (!scoreStream.open(sequenceFile.file, sequenceFile.qticks, sequenceFile.ismsec))
     {
-      // If writing milliseconds then convert the file's data from
-      // seconds to milliseconds to match our smpte time format
-      for (int i=0; i<seq->getNumEvents(); i++)
-	{
-	  MidiMessageSequence::MidiEventHolder* h=seq->getEventPointer(i);
-	  h->message.setTimeStamp(h->message.getTimeStamp()*1000.0);
-	}
+      // the score is captured and saved when it completes instead
+      Console::getInstance()->
+	printError(T(">>> Error: can't write ") +
+		   sequenceFile.file.getFullPathName() + T("\n"));
+      return;
     }
+  // track 0 has the tuning and instruments in effect when the score
+  // starts
+  writeTrackZero(scoreStream.getWriter());
+  scoreStream.startScore();
+}
+
+void MidiOutPort::closeScore()
+{
+  if (scoreStream.close())
+    Console::getInstance()->
+      printOutput((T("Midifile: ") + 
+                   sequenceFile.file.getFullPathName() +
+                   T("\n")));
   else
-    {
-      // otherwise convert seconds to division per quarter
-      double divs=(float)sequenceFile.qticks;
-      for (int i=0; i<seq->getNumEvents(); i++)
-	{
-	  MidiMessageSequence::MidiEventHolder* h=seq->getEventPointer(i);
-	  h->message.setTimeStamp(h->message.getTimeStamp()*divs);
-	}
-    }
+    Console::getInstance()->
+      printError(T(">>> Error: can't write ") +
+                 sequenceFile.file.getFullPathName() + T("\n"));
+}
 
-  // optional clear after save
-  //midifile->writeTo(outputStream) && sequenceFile.clear
-  if (midifile->writeTo(outputStream)) 
+void MidiOutPort::addScoreMessage(const MidiMessage& msg, double time)
+{
+  if (scoreStream.isOpen())
     {
-      Console::getInstance()->
-	printOutput((T("Midifile: ") + 
-		     sequenceFile.file.getFullPathName() +
-		     T("\n")));
-      captureSequence.clear();
+      // processes run in time order so nothing can be added before
+      // the current score time, everything up to it is written out
+      scoreStream.add(msg, time);
+      scoreStream.flush(SchemeThread::getInstance()->getScoreTime());
     }
+  else
+    captureBuffer.add(msg, time);
 }
 
 /*=======================================================================*
@@ -1407,6 +2039,7 @@ MidiInPort::MidiInPort()
   channelMask=Preferences::getInstance()->getIntProp(T("MidiInChannelMask"), AllChannels);
   opcodeMask=Preferences::getInstance()->getIntProp(T("MidiInOpcodeMask"), AllOpcodes);
 #endif
+  updateActiveStatus();
 }
 
 MidiInPort::~MidiInPort() 
@@ -1507,6 +2140,7 @@ int MidiInPort::getChannelMask()
 void MidiInPort::setChannelMask(int mask)
 {
   channelMask=mask;
+  updateActiveStatus();
 #ifdef GRACE
   Preferences::getInstance()->setIntProp(T("MidiInChannelMask"),
 					 channelMask);
@@ -1532,6 +2166,7 @@ void MidiInPort::setChannelActive(int chan, bool active)
     Flags::setOn(channelMask, mask);
   else
     Flags::setOff(channelMask, mask);
+  updateActiveStatus();
 #ifdef GRACE
   Preferences::getInstance()->setIntProp(T("MidiInChannelMask"),
 					 channelMask);
@@ -1543,6 +2178,7 @@ void MidiInPort::toggleChannelActive(int chan)
   chan=jlimit(0, 15, chan);
   int mask=1 << chan;
   Flags::toggle(channelMask, mask);
+  updateActiveStatus();
 #ifdef GRACE
   Preferences::getInstance()->setIntProp(T("MidiInChannelMask"),
 					 channelMask);
@@ -1561,6 +2197,7 @@ int MidiInPort::getOpcodeMask()
 void MidiInPort::setOpcodeMask(int mask)
 {
   opcodeMask=mask;
+  updateActiveStatus();
 #ifdef GRACE
   Preferences::getInstance()->setIntProp(T("MidiInOpcodeMask"),
 					 opcodeMask);
@@ -1585,6 +2222,7 @@ void MidiInPort::toggleOpcodeActive(int index)
   index=jlimit(0, 6, index);
   int mask=1 << index;
   Flags::toggle(opcodeMask, mask);
+  updateActiveStatus();
 #ifdef GRACE
   Preferences::getInstance()->setIntProp(T("MidiInOpcodeMask"),
 					 opcodeMask);
@@ -1599,6 +2237,7 @@ void MidiInPort::setOpcodeActive(int index, bool active)
     Flags::setOn(opcodeMask, mask);
   else
     Flags::setOff(opcodeMask, mask);
+  updateActiveStatus();
 #ifdef GRACE
   Preferences::getInstance()->setIntProp(T("MidiInOpcodeMask"),
 					 opcodeMask);
@@ -1638,37 +2277,45 @@ void MidiInPort::setTracing(bool trace)
 /// Receiving
 //
 
+void MidiInPort::updateActiveStatus()
+{
+  for (int op=MidiFlags::Off; op<=0xF; op++)
+    {
+      bool active=(op<=MidiFlags::MaxChannelOpcode) && isOpcodeActive(op, true);
+      for (int ch=0; ch<16; ch++)
+        activeStatus[((op-MidiFlags::Off)<<4) | ch]=active && isChannelActive(ch);
+    }
+}
+
 bool MidiInPort::isMessageActive(const MidiMessage &msg)
 {
-  int ch=msg.getChannel(); // JUCE: channel messages are >0
-  return ((ch>0) && 
-	  isChannelActive(ch-1) &&
-	  ((msg.isNoteOn() && 
-	    isOpcodeActive(MidiNode::MM_ON, true)) ||
-	   (msg.isNoteOff() && 
-	    isOpcodeActive(MidiNode::MM_OFF, true)) ||
-	   (msg.isController() && 
-	    isOpcodeActive(MidiNode::MM_CTRL, true)) ||
-	   (msg.isProgramChange() && 
-	    isOpcodeActive(MidiNode::MM_PROG, true)) ||
-	   (msg.isPitchWheel() && 
-	    isOpcodeActive(MidiNode::MM_BEND, true)) ||
-	   (msg.isAftertouch() && 
-	    isOpcodeActive(MidiNode::MM_TOUCH, true)) ||
-	   (msg.isChannelPressure() && 
-	    isOpcodeActive(MidiNode::MM_PRESS, true))));
+  if (msg.getRawDataSize()<1)
+    return false;
+  const juce::uint8* data=msg.getRawData();
+  int status=data[0];
+  // JUCE: a note on with zero velocity is a note off
+  if (((status & 0xF0)==0x90) && (msg.getRawDataSize()>2) && (data[2]==0))
+    status=0x80 | (status & 0xF);
+  return (status & 0x80) && activeStatus[status & 0x7F];
 }
 
 void MidiInPort::handleIncomingMidiMessage(MidiInput *dev, const MidiMessage &msg) 
 {
   if (isMessageActive(msg))
   {
+    // the device's time stamp is the message's arrival time in
+    // seconds, it is kept all the way to the receivers and the
+    // recording
+    MidiMessage stamped (msg);
+    if (stamped.getTimeStamp()<=0.0)
+      stamped.setTimeStamp(Time::getMillisecondCounterHiRes()*0.001);
+    MidiOutPort::getInstance()->recordInput(stamped);
 #ifdef GRACE
     if (sendToPlugin())
-      AudioManager::getInstance()->sendMessageToPluginGraph(msg);        
+      AudioManager::getInstance()->sendMessageToPluginGraph(stamped);        
     else
 #endif
-      SchemeThread::getInstance()->midiin(msg);
+      SchemeThread::getInstance()->midiin(stamped);
     //      if (isThroughActive() && MidiOutPort::getInstance()->device != NULL)
     //        MidiOutPort::getInstance()->device->sendMessageNow(msg);
     if (isTracing())
@@ -3229,7 +3876,9 @@ void MidiInPort::openImportMidifileDialog()
 
 void MidiOutPort::openImportRecordingDialog()
 {
-  MidiFileImportComponent* c=new MidiFileImportComponent(File::nonexistent,0, &captureSequence);
+  syncRecording();
+  captureBuffer.copyTo(recordingSequence);
+  MidiFileImportComponent* c=new MidiFileImportComponent(File::nonexistent,0, &recordingSequence);
   new MidifileImportWindow(T("Import Recording"),c);
 }
 
@@ -9,10 +9,30 @@
 #define MIDI_H
 
 #include "Libraries.h"
+#include "SchedulerClock.h"
+#include "NodePool.h"
+#include "BinaryHeap.h"
+#include "MicroTuning.h"
+#include "MidiSequencerQueue.h"
+#include "MidiCapture.h"
 
 class MidiOutPort;
+class MidiOutDevice;
 class ConsoleWindow;
 class MidiReceiveComponent;
+
+/** A midi output event as it is passed from a sending thread to the
+    output thread. It is plain data so passing it never allocates. **/
+
+struct MidiOutEvent
+{
+  int type;             // a MidiNode type
+  double time;          // absolute time in milliseconds
+  double duration;      // seconds
+  double values[3];     // DATA0-DATA2
+  MidiMessage* message; // MM_MESSAGE only, passes to the node
+};
+
 class MidiNode
 {
  public:
@@ -20,6 +40,7 @@ class MidiNode
   enum
   {
     MM_MESSAGE=1, 
+    MM_CLEAR,  // flushes the output queue and silences the device
     MM_OFF=0x8,
     MM_ON,
     MM_TOUCH,
@@ -39,18 +60,26 @@ class MidiNode
   int type;
   double time;
   double duration;
-  MidiMessage *message;
-  Array<double> values;
-  MidiOutPort *midiOutPort;
+  MidiMessage *message; // owned by node
+  double values[3];     // DATA0-DATA2
+  MidiOutDevice *midiOutPort;
+  int order;            // output queue insertion order
+  MidiNode* inboxnext;  // link while waiting in the output inbox
   MidiNode(int typ, double wait, double *vals=0, int num_vals=0) ;
   MidiNode(int typ, double wait, double chan, double data1);
   MidiNode(int typ, double wait, double chan, double data1, double data2);
   MidiNode(int typ, double wait, double chan, double data1, double data2, double dur);
   MidiNode(MidiMessage *msg);
+  MidiNode(const MidiOutEvent& event);
   ~MidiNode();
-  bool process();
+  void process();
   void print();
 
+  // nodes are allocated from a preallocated pool
+  static NodePool pool;
+  static void* operator new(size_t size) {return pool.allocate(size);}
+  static void operator delete(void* ptr) {pool.release(ptr);}
+
   static const int indexToOpcode(int index)
   {
     return jlimit(0, 7, index)+MM_OFF;
@@ -82,16 +111,162 @@ class MidiNode
   
 };
 
-class MidiNodeComparator
+/*=======================================================================*
+                             Midi Output Queues
+ *=======================================================================*/
+
+/** A single producer, single consumer ring of output events from the
+    scheduler thread to the midi output thread. Neither side locks or
+    allocates. **/
+
+class MidiOutRing
+{
+ public:
+  MidiOutRing(int size);
+  ~MidiOutRing();
+
+  /** Adds event, returns false if the ring is full. Producer only. **/
+  bool push(const MidiOutEvent& event);
+
+  /** Removes the oldest event, returns false if the ring is
+      empty. Consumer only. **/
+  bool pop(MidiOutEvent& event);
+
+  bool isEmpty() const {return readpos.get()==writepos.get();}
+
+ private:
+  MidiOutEvent* events;
+  int mask;
+  Atomic<int> readpos;
+  Atomic<int> writepos;
+};
+
+/** A lock-free list of nodes posted to the output thread by threads
+    other than the scheduler (or by the scheduler when its ring is
+    full). Any thread can push, only the output thread pops. **/
+
+class MidiNodeInbox
+{
+ public:
+  MidiNodeInbox() {}
+  ~MidiNodeInbox();
+  void push(MidiNode* node);
+  /** Empties the inbox and returns its nodes linked through inboxnext
+      in the order they were pushed. **/
+  MidiNode* popAll();
+  bool isEmpty() const {return head.get()==NULL;}
+ private:
+  Atomic<MidiNode*> head;
+};
+
+/** A binary heap of midi nodes ordered by time, nodes with the same
+    time stay in the order they were added. The queue owns its nodes
+    and belongs to the output thread, only size() may be called by
+    other threads. **/
+
+class MidiNodeQueue
+{
+ public:
+  MidiNodeQueue() : counter (0) {}
+  ~MidiNodeQueue();
+  int size() const {return numnodes.get();}
+  MidiNode* getFirst() const {return heap.getFirst();}
+  void add(MidiNode* node);
+  MidiNode* removeFirst();
+  void clear();
+ private:
+  class Comparator
+  {
+  public:
+    static int compareElements(MidiNode* e1, MidiNode* e2)
+    {
+      if (e1->time < e2->time)
+        return -1;
+      else if (e2->time < e1->time)
+        return 1;
+      // else both at same time, return node that was added first
+      else if (e1->order < e2->order)
+        return -1;
+      else
+        return 1;
+    }
+  };
+  BinaryHeap<MidiNode*, Comparator> heap;
+  Atomic<int> numnodes;
+  int counter;
+};
+
+/** The note offs of sounding notes, one entry per channel and key,
+    kept in a heap ordered by off time. Notes with durations no longer
+    go back into the output queue as note offs, so the queue holds only
+    pending note ons and data. A second note on a key that is already
+    sounding shares the key's entry and the offs for both notes are
+    sent together. By default the earlier off ends the key, as it did
+    when each note had its own off, in extend mode the key sounds until
+    the later off. In retrigger mode the device sends the old off right
+    away instead. The table has a fixed size and only
+    allocates when it is created. It belongs to the output thread, only size() may be
+    called by other threads. **/
+
+class MidiNoteOffTable
 {
  public:
-  static int compareElements(MidiNode* e1, MidiNode* e2)
+  MidiNoteOffTable();
+  int size() const {return numpending.get();}
+  /** Returns the time of the earliest pending off or HUGE_VAL. **/
+  double getFirstTime() const;
+  /** Adds a note off for chan and key at time (milliseconds). If the
+      key already has an off pending it is sent at the earlier of the
+      two times, or the later one if extend is true. **/
+  void add(int chan, int key, double time, bool extend=false);
+  /** Removes the earliest entry and returns the number of offs it
+      holds. **/
+  int removeFirst(int& chan, int& key, double& time);
+  /** Removes the entry for chan and key and returns the number of offs
+      it held, 0 if the note isn't sounding. **/
+  int remove(int chan, int key);
+  void clear();
+ private:
+  enum {NumEntries=16*128};
+  struct Entry
+  {
+    double time;
+    int count;  // number of note ons waiting for this off
+    int hindex; // heap position or -1
+  };
+  /** Orders the heap's entry numbers by their off times. **/
+  class Comparator
+  {
+  public:
+    Comparator(const Entry* e=NULL) : entries (e) {}
+    int compareElements(int e1, int e2) const
+    {
+      if (entries[e1].time < entries[e2].time)
+        return -1;
+      else if (entries[e2].time < entries[e1].time)
+        return 1;
+      return 0;
+    }
+  private:
+    const Entry* entries;
+  };
+  /** Keeps each entry's hindex at its heap position. **/
+  class Index
   {
-    if( e1->time <= e2->time)
-      return -1;
-    else 
-      return 1;
+  public:
+    Index(Entry* e=NULL) : entries (e) {}
+    void setIndex(int entry, int index) const {entries[entry].hindex=index;}
+  private:
+    Entry* entries;
+  };
+  Entry entries[NumEntries];
+  BinaryHeap<int, Comparator, Index> heap;
+  Atomic<int> numpending;
+  static int toIndex(int chan, int key)
+  {
+    return (jlimit(0, 15, chan)*128)+jlimit(0, 127, key);
   }
+  void removeAt(int index);
 };
 
 class MidiFileInfo
@@ -176,55 +351,190 @@ class MidiTrack
   }
 };
 
-class MidiOutPort : public Thread //, public AsyncUpdater
+/** An open midi output device with its own output thread and queues,
+    so output to a slow device never holds up the others. The
+    MidiOutPort is output 0, it opens the other outputs and routes
+    messages to them by port index or by channel. **/
+
+class MidiOutDevice : public Thread
 {
  public:
   int devid;
   MidiOutput *device;
+
+  /** Output travels to the output thread through ring (from the
+      scheduler thread) or inbox (from everywhere else) and waits in
+      outputNodes, which only the output thread touches. So sending
+      never locks and the device is never written under a shared
+      lock. **/
+  MidiOutRing ring;
+  MidiNodeInbox inbox;
+  MidiNodeQueue outputNodes;
+  MidiNoteOffTable noteOffs;
+  /** The time the output thread is sleeping until, 0 if it is awake. **/
+  Atomic<double> wakeup;
+
+  /** While recordOutput is set everything sent is recorded at its
+      time stamp (milliseconds). The output thread adds to the
+      recording without locking, MidiOutPort copies it into its capture
+      buffer. **/
+  Atomic<int> recordOutput;
+  MidiInRecording recording;
+  int recordingCopied;
+
+  /** Sleeps the output thread until the next message is due and keeps
+      the output timing statistics. **/
+  SchedulerClock clock;
+
+  MidiOutDevice(const String& threadname, const String& clockname);
+  virtual ~MidiOutDevice();
+
+  /** Replaces the device with dev (which can be NULL) once the output
+      thread has stopped, deleting the old one, and restarts the thread
+      if it was running. **/
+  void setDevice(MidiOutput* dev, int id);
+
+  /** Sets the lookahead window in milliseconds, 0 (the default) sends
+      each message when it is due. With a window the output thread
+      wakes that much early and hands everything due within the window
+      over with its time stamp. On linux it goes to an ALSA sequencer
+      queue (MidiSequencerQueue) and the kernel sends it, late messages
+      go out at once. Elsewhere, or if the queue can't be opened, it
+      goes to MidiOutput's background thread, which lowers the mean
+      lateness but not the jitter: that thread rounds each time stamp
+      to a whole millisecond and silently drops messages that are more
+      than 200 ms late. **/
+  void setLookahead(double ms);
+  double getLookahead();
+
+  /** In retrigger mode a note on for a key that is already sounding
+      sends that note's off first. Otherwise (the default) the earliest
+      off ends the key. **/
+  void setRetrigger(bool retrig);
+  bool isRetrigger();
+
+  /** In extend mode a note on for a key that is already sounding keeps
+      the key sounding until the later of the two notes ends.
+      Retrigger mode takes precedence. **/
+  void setExtend(bool ext);
+  bool isExtend();
+
+  /** Sets the milliseconds output is held back by, which lines this
+      device up with slower ones. **/
+  void setDelay(double ms);
+  double getDelay();
+
+  bool isOutputQueueActive();
+
+  void run();
+  /** Flushes pending output and silences the device. The flush is
+      passed to the output thread, which calls clear(true). **/
+  void clear(bool now=false);
+
+  /** Queues a node, n's time is seconds from now. **/
+  void addNode(MidiNode *n);
+  /** Queues an event, its time is seconds from now. **/
+  void addEvent(MidiOutEvent& event);
+  /** Moves everything sent since the last call into outputNodes. **/
+  void receive();
+  /** Hands all output due before now+ahead to the device at once. **/
+  void sendBlock(double now, double ahead);
+  /** Returns the time of the earliest pending output or HUGE_VAL. **/
+  double getNextOutputTime();
+  /** Sends the earliest pending output, note offs go first. **/
+  void sendNext();
+  /** Called by MidiNode::process() for note ons. **/
+  void sendNoteOn(MidiNode* node);
+
+  /** called by node process to send a message out the device **/
+  virtual void sendOut(MidiMessage& msg);
+
+ private:
+  Atomic<int> lookaheadmicros;
+  Atomic<int> retrigger;
+  Atomic<int> extend;
+  Atomic<int> delaymicros;
+  MidiBuffer lookaheadblock;
+  MidiBuffer* block;       // set while sendBlock() collects messages
+  double blockstart;       // time of the block's first sample
+  MidiOutput* blockdevice; // device the block destination was chosen for
+  MidiSequencerQueue sequencer;  // lookahead output on linux
+};
+
+class MidiOutPort : public MidiOutDevice //, public AsyncUpdater
+{
+ public:
   ConsoleWindow *console;
-  OwnedArray<MidiNode, CriticalSection> outputNodes;
-  
+
   MidiOutPort( );
   ~MidiOutPort();
 
   bool open(int id);
   bool open(String name);
   bool isOpen(int id=-1) ;
+  /** Closes device id on whichever output it is open. **/
   void close(int id=-1);
 
+  /** Output ports. Port 0 is this port (the device chosen in the
+      menus), the others are opened by openOutput() and each runs its
+      own output thread. **/
+  enum {NumOutputs=16};
+  /** Opens device id on output port, port 0 is the same as open(id). **/
+  bool openOutput(int id, int port);
+  /** Returns the output at port or NULL if it has never been opened. **/
+  MidiOutDevice* getOutput(int port);
+  /** Returns the output port a message on chan goes to: port if it
+      has been opened, otherwise chan's entry in the channel map. **/
+  int getRoute(int port, int chan);
+  /** Sends chan's output to port (by default all channels go to port
+      0). **/
+  void setChannelPort(int chan, int port);
+  int getChannelPort(int chan);
+  /** Sets the latency of the device on port in milliseconds. Each
+      output is delayed by the difference between its latency and the
+      largest latency so they all sound together. **/
+  void setOutputLatency(int port, double ms);
+
   void testOutput();
+  /** True if any output has pending output. **/
   bool isOutputQueueActive();
 
-  void run();
+  /** These apply to every output. **/
   void clear();
-
-  void addNode(MidiNode *n);
-  MidiNodeComparator comparator;
+  void setLookahead(double ms);
+  void setRetrigger(bool retrig);
+  void setExtend(bool ext);
+  void setSpinTime(double ms);
 
   void sendNote(double wait, double dur, double key, double vel, double chan,
-		bool toseq);
+		bool toseq, int port=-1);
   void sendData(int type, double wait, double chan, double data1, double data2,
-		bool toseq);
-  void sendMessage(MidiMessage *message, bool toseq);
-
-  /** called by node process to send a message out the device and
-      (possibly) record it in the capture sequence **/
+		bool toseq, int port=-1);
+  void sendMessage(MidiMessage *message, bool toseq, int port=-1);
 
+  /** sends a message out the device and (possibly) records it in the
+      capture sequence, without a device it goes to the plugins **/
   void sendOut(MidiMessage& msg);
 
+ private:
+  MidiOutDevice* outputs[NumOutputs];
+  int chanports[16];
+  double latencies[NumOutputs];
+  void updateDelays();
+ public:
+
 
   // microtuning support
-  static double channeltunings [16][16] ;
-  int   microdivisions;  // divisions per semitone: 1-16
-  double microincrement; // size of tuning's division (1.0=semitone)
-  int   microchancount; // number of addressable channels in tuning
-  int   microchanblock; // total number of channels used by tuning
-  bool  avoiddrumtrack; // if true then avoid channel 9
-  int   pitchbendwidth;
+  MicroTuning tuning;
   StringArray tuningnames ; // string name for each tuning
   StringArray instrumentnames ; // string name of each GM instrument
   int getTuning() ;
   void setTuning(int tune, bool send=true) ;
+  /** Sets a tuning with zones at the given cent offsets, returns false
+      if they are invalid. **/
+  bool setTuningOffsets(const Array<double>& cents, bool send=true);
+  /** Gives each microtonal note its own channel and pitch bend. **/
+  void setNoteBends(bool bends, bool send=true);
   bool isTuning(int tune);
   String getTuningName(int tune);
   int getTuningDivisions(int tune); // number of division
@@ -266,15 +576,31 @@ class MidiOutPort : public Thread //, public AsyncUpdater
   bool isRecordMode(int mode);
   bool isRecordingAvailable();
   void openImportRecordingDialog();
-  /** the capture sequence. time stamps are seconds **/
-  MidiMessageSequence captureSequence;
+  /** the capture buffer. time stamps are seconds **/
+  MidiCaptureBuffer captureBuffer;
+  /** the capture buffer as a sequence for the import dialog **/
+  MidiMessageSequence recordingSequence;
   MidiFileInfo sequenceFile;
+  /** the midi file a score is streamed to while it runs **/
+  MidiScoreStream scoreStream;
   /** time offset subtracted from MidiOut events that are recorded to
       the zero based capture sequence. when recoding begins the offset
       is intialized to -1 which causes the first recorded event to
       cache its true time stamp as the offset value. this value is
-      then subtracted from the subsequent captured events. **/
+      then subtracted from the subsequent captured events. each output
+      records what it sends, the recordings are copied into the
+      capture buffer by syncRecording() **/
   double recordTimeOffset;
+  /** midi input recorded in RecordMidiIn mode at its arrival times.
+      the input thread adds to it without locking, it is copied into
+      the capture buffer when recording stops or the buffer is
+      tested **/
+  MidiInRecording inputRecording;
+  int inputRecordingCopied;
+  void recordInput(const MidiMessage& msg);
+  /** copies the input and output recorded since the last sync into
+      the capture buffer **/
+  void syncRecording();
   /** predicates to test the status of the capture sequence **/
   bool isSequenceEmpty();
   bool isSequenceData();
@@ -288,6 +614,15 @@ class MidiOutPort : public Thread //, public AsyncUpdater
   void openFileSettingsDialog();
 
   void saveSequence(bool ask=false);
+  /** opens filename for streaming score output, the score's messages
+      are written as the score passes them and the file is finished by
+      closeScore() **/
+  void openScore(String filename);
+  void closeScore();
+  /** adds a score message to the open score stream or else to the
+      capture buffer **/
+  void addScoreMessage(const MidiMessage& msg, double time);
+  void writeTrackZero(MidiFileWriter& writer);
 
 
   /** versions of the capture sequence can be saved to and restored
@@ -333,6 +668,10 @@ class MidiInPort : public MidiInputCallback
   int channelMask;
   int opcodeMask;
   bool toPlugin;
+  // true for each status byte (opcode and channel) the masks let
+  // through, rebuilt whenever a mask changes
+  bool activeStatus[128];
+  void updateActiveStatus();
  public:
   static const int AllOpcodes = 0x7F;
   static const int AllChannels = 0xFFFF;
@@ -0,0 +1,761 @@
+/*=======================================================================*
+  Copyright (C) 2012 Rick Taube.
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the Lisp Lesser Gnu Public License. The text of
+  this agreement is available at http://www.cliki.net/LLGPL
+ *=======================================================================*/
+
+#include "MidiCapture.h"
+#include <algorithm>
+
+/*=======================================================================*
+                              Midi File Writer
+ *=======================================================================*/
+
+MidiFileWriter::MidiFileWriter()
+  : stream (NULL),
+    trackstart (-1),
+    lasttick (0),
+    runningstatus (0),
+    numtracks (0)
+{
+}
+
+MidiFileWriter::~MidiFileWriter()
+{
+  close();
+}
+
+bool MidiFileWriter::open(const File& file, int ticksperquarter, bool msec)
+{
+  close();
+  // FileOutputStream appends to an existing file
+  if (file.existsAsFile() && !file.deleteFile())
+    return false;
+  stream=new FileOutputStream(file);
+  if (stream->failedToOpen())
+    {
+      deleteAndZero(stream);
+      return false;
+    }
+  numtracks=0;
+  stream->write("MThd", 4);
+  stream->writeIntBigEndian(6);
+  stream->writeShortBigEndian(1); // format 1
+  stream->writeShortBigEndian(0); // number of tracks, set by close()
+  if (msec)
+    stream->writeShortBigEndian((short)((-25 << 8) | 40)); // 1 msec resolution
+  else
+    stream->writeShortBigEndian((short)ticksperquarter);
+  return true;
+}
+
+void MidiFileWriter::beginTrack()
+{
+  if (stream==NULL)
+    return;
+  endTrack();
+  stream->write("MTrk", 4);
+  trackstart=stream->getPosition();
+  stream->writeIntBigEndian(0); // length, set by endTrack()
+  lasttick=0;
+  runningstatus=0;
+  numtracks++;
+}
+
+void MidiFileWriter::writeEvent(const MidiMessage& msg, int tick)
+{
+  const juce::uint8* data=msg.getRawData();
+  int size=msg.getRawDataSize();
+  if (stream==NULL || trackstart<0 || size<1)
+    return;
+  writeVarLength(jmax(0, tick-lasttick));
+  lasttick=jmax(tick, lasttick);
+  int status=data[0];
+  if (status==0xf0)
+    {
+      // sysex data is preceded by its length
+      stream->writeByte((char)status);
+      writeVarLength(size-1);
+      stream->write(data+1, size-1);
+      runningstatus=0;
+    }
+  else if (status==runningstatus && size>1)
+    stream->write(data+1, size-1);
+  else
+    {
+      stream->write(data, size);
+      // only channel messages set the running status
+      runningstatus=(status<0xf0) ? status : 0;
+    }
+}
+
+void MidiFileWriter::endTrack()
+{
+  if (stream==NULL || trackstart<0)
+    return;
+  // end of track meta event
+  writeVarLength(0);
+  stream->writeByte((char)0xff);
+  stream->writeByte((char)0x2f);
+  stream->writeByte(0);
+  int64 end=stream->getPosition();
+  patch(trackstart, (int)(end-trackstart-4), false);
+  stream->setPosition(end);
+  trackstart=-1;
+}
+
+bool MidiFileWriter::close()
+{
+  if (stream==NULL)
+    return false;
+  endTrack();
+  int64 end=stream->getPosition();
+  patch(10, numtracks, true);
+  stream->setPosition(end);
+  stream->flush();
+  bool ok=(stream->getStatus().wasOk());
+  deleteAndZero(stream);
+  return ok;
+}
+
+void MidiFileWriter::sync()
+{
+  if (stream==NULL)
+    return;
+  int64 end=stream->getPosition();
+  patch(10, numtracks, true);
+  if (trackstart>=0)
+    patch(trackstart, (int)(end-trackstart-4), false);
+  stream->setPosition(end);
+  stream->flush();
+}
+
+void MidiFileWriter::patch(int64 position, int value, bool isshort)
+{
+  stream->setPosition(position);
+  if (isshort)
+    stream->writeShortBigEndian((short)value);
+  else
+    stream->writeIntBigEndian(value);
+}
+
+void MidiFileWriter::writeVarLength(int value)
+{
+  juce::uint8 bytes[5];
+  int num=0;
+  bytes[num++]=(juce::uint8)(value & 0x7f);
+  while ((value >>= 7) > 0)
+    bytes[num++]=(juce::uint8)((value & 0x7f) | 0x80);
+  while (num>0)
+    stream->writeByte((char)bytes[--num]);
+}
+
+/*=======================================================================*
+                             Midi Score Stream
+ *=======================================================================*/
+
+MidiScoreStream::MidiScoreStream()
+  : counter (0),
+    ticks (1000.0),
+    numwritten (0)
+{
+}
+
+MidiScoreStream::~MidiScoreStream()
+{
+  close();
+}
+
+bool MidiScoreStream::open(const File& file, int ticksperquarter, bool msec)
+{
+  close();
+  // score times are seconds, converted to milliseconds for the smpte
+  // time format otherwise to divisions per quarter
+  ticks=(msec) ? 1000.0 : (double)ticksperquarter;
+  counter=0;
+  numwritten=0;
+  return writer.open(file, ticksperquarter, msec);
+}
+
+void MidiScoreStream::startScore()
+{
+  writer.beginTrack();
+}
+
+void MidiScoreStream::add(const MidiMessage& msg, double time)
+{
+  if (!isOpen())
+    return;
+  Pending p;
+  p.time=time;
+  p.order=counter++;
+  p.message=new MidiMessage(msg);
+  heap.add(p);
+}
+
+void MidiScoreStream::flush(double time)
+{
+  while (heap.size()>0 && heap.getUnchecked(0).time<=time)
+    {
+      Pending p=heap.removeFirst();
+      writer.writeEvent(*p.message, roundToInt(p.time*ticks));
+      delete p.message;
+      if ((++numwritten % 4096)==0)
+        writer.sync();
+    }
+}
+
+bool MidiScoreStream::close()
+{
+  if (!isOpen())
+    return false;
+  flush(HUGE_VAL);
+  return writer.close();
+}
+
+/*=======================================================================*
+                             Midi Capture Buffer
+ *=======================================================================*/
+
+MidiCaptureBuffer::MidiCaptureBuffer()
+  : sorted (true),
+    prepared (true),
+    endtime (0.0)
+{
+}
+
+MidiCaptureBuffer::~MidiCaptureBuffer()
+{
+}
+
+void MidiCaptureBuffer::add(const MidiMessage& msg, double time)
+{
+  const juce::uint8* data=msg.getRawData();
+  int size=msg.getRawDataSize();
+  if (size<1)
+    return;
+  if (size<=3 && data[0]!=0xf0 && data[0]!=0xff)
+    {
+      juce::uint32 bits=(juce::uint32)size<<24;
+      for (int i=0; i<size; i++)
+        bits |= ((juce::uint32)data[i])<<(i*8);
+      packed.add(bits);
+    }
+  else
+    {
+      packed.add((juce::uint32)longs.size());
+      longs.add(new MidiMessage(msg));
+    }
+  if (times.size()>0 && time<times.getLast())
+    sorted=false;
+  times.add(time);
+  if (time>endtime)
+    endtime=time;
+  prepared=false;
+}
+
+void MidiCaptureBuffer::addSequence(const MidiMessageSequence& seq, double shift,
+                                    double start, double end)
+{
+  for (int i=0; i<seq.getNumEvents(); i++)
+    {
+      const MidiMessage& msg=seq.getEventPointer(i)->message;
+      double time=msg.getTimeStamp()+shift;
+      if (time>=start && time<end && msg.getChannel()>0)
+        add(msg, time);
+    }
+}
+
+void MidiCaptureBuffer::ensureStorageAllocated(int num)
+{
+  times.ensureStorageAllocated(num);
+  packed.ensureStorageAllocated(num);
+}
+
+void MidiCaptureBuffer::clear()
+{
+  times.clear();
+  packed.clear();
+  longs.clear();
+  noteoffs.clear();
+  sorted=true;
+  prepared=true;
+  endtime=0.0;
+}
+
+MidiMessage MidiCaptureBuffer::getMessage(int index) const
+{
+  juce::uint32 bits=packed.getUnchecked(index);
+  int size=(int)(bits>>24);
+  if (size==0)
+    return MidiMessage(*longs.getUnchecked((int)bits), times.getUnchecked(index));
+  juce::uint8 data[3];
+  for (int i=0; i<size; i++)
+    data[i]=(juce::uint8)((bits>>(i*8)) & 0xff);
+  return MidiMessage(data, size, times.getUnchecked(index));
+}
+
+void MidiCaptureBuffer::prepare()
+{
+  if (prepared)
+    return;
+  if (!sorted)
+    sort();
+  pair();
+  prepared=true;
+}
+
+class MidiCaptureOrder
+{
+ public:
+  MidiCaptureOrder(const Array<double>& t) : times (t) {}
+  // by time then by position, so messages at the same time stay in
+  // the order they were added
+  bool operator() (int a, int b) const
+  {
+    double ta=times.getUnchecked(a), tb=times.getUnchecked(b);
+    return (ta<tb) || ((ta==tb) && (a<b));
+  }
+ private:
+  const Array<double>& times;
+};
+
+void MidiCaptureBuffer::sort()
+{
+  int size=times.size();
+  int* order=new int[size];
+  for (int i=0; i<size; i++)
+    order[i]=i;
+  std::sort(order, order+size, MidiCaptureOrder(times));
+  Array<double> t;
+  Array<juce::uint32> p;
+  t.ensureStorageAllocated(size);
+  p.ensureStorageAllocated(size);
+  for (int i=0; i<size; i++)
+    {
+      t.add(times.getUnchecked(order[i]));
+      p.add(packed.getUnchecked(order[i]));
+    }
+  delete[] order;
+  times.swapWithArray(t);
+  packed.swapWithArray(p);
+  sorted=true;
+}
+
+void MidiCaptureBuffer::pair()
+{
+  // one pass with the open note on of each channel and key. a note on
+  // of a key that is already on ends the first note at its time.
+  int size=times.size();
+  int open[16*128];
+  for (int i=0; i<16*128; i++)
+    open[i]=-1;
+  Array<double> t;
+  Array<juce::uint32> p;
+  t.ensureStorageAllocated(size);
+  p.ensureStorageAllocated(size);
+  noteoffs.clearQuick();
+  noteoffs.ensureStorageAllocated(size);
+  for (int i=0; i<size; i++)
+    {
+      juce::uint32 bits=packed.getUnchecked(i);
+      int type=(int)(bits & 0xf0);
+      if ((bits>>24)==3 && (type==0x80 || type==0x90))
+        {
+          int chan=(int)(bits & 0x0f);
+          int key=(int)((bits>>8) & 0x7f);
+          int& on=open[(chan*128)+key];
+          if (type==0x90 && ((bits>>16) & 0x7f)>0)
+            {
+              if (on>=0)
+                {
+                  noteoffs.set(on, t.size());
+                  t.add(times.getUnchecked(i));
+                  p.add((3<<24) | (key<<8) | 0x80 | chan);
+                  noteoffs.add(-1);
+                }
+              on=t.size();
+            }
+          else if (on>=0)
+            {
+              noteoffs.set(on, t.size());
+              on=-1;
+            }
+        }
+      t.add(times.getUnchecked(i));
+      p.add(bits);
+      noteoffs.add(-1);
+    }
+  times.swapWithArray(t);
+  packed.swapWithArray(p);
+}
+
+void MidiCaptureBuffer::copyTo(MidiMessageSequence& seq)
+{
+  prepare();
+  seq.clear();
+  for (int i=0; i<size(); i++)
+    seq.addEvent(getMessage(i));
+  // the buffer is already paired, so link the sequence directly
+  for (int i=0; i<size(); i++)
+    if (noteoffs.getUnchecked(i)>=0)
+      seq.getEventPointer(i)->noteOffObject=seq.getEventPointer(noteoffs.getUnchecked(i));
+}
+
+void MidiCaptureBuffer::writeTrack(MidiFileWriter& writer, double ticks)
+{
+  prepare();
+  writer.beginTrack();
+  for (int i=0; i<size(); i++)
+    writer.writeEvent(getMessage(i), roundToInt(times.getUnchecked(i)*ticks));
+  writer.endTrack();
+}
+
+/*=======================================================================*
+                                 Midi Input
+ *=======================================================================*/
+
+MidiInRing::MidiInRing(int size)
+  : messages (NULL),
+    times (NULL),
+    mask (0)
+{
+  // size must be a power of 2, one slot is always left empty
+  jassert((size & (size-1))==0);
+  messages=new juce::uint32[size];
+  times=new double[size];
+  mask=size-1;
+}
+
+MidiInRing::~MidiInRing()
+{
+  delete[] messages;
+  delete[] times;
+}
+
+bool MidiInRing::push(const MidiMessage& msg)
+{
+  int size=msg.getRawDataSize();
+  if (size<1 || size>3)
+    return false;
+  int w=writepos.get();
+  int next=(w+1) & mask;
+  if (next==readpos.get())
+    return false;
+  const juce::uint8* data=msg.getRawData();
+  juce::uint32 bytes=data[0];
+  if (size>1) bytes |= (data[1]<<8);
+  if (size>2) bytes |= (data[2]<<16);
+  messages[w]=bytes;
+  times[w]=msg.getTimeStamp();
+  // publish the message before the new write position
+  Atomic<int>::memoryBarrier();
+  writepos.set(next);
+  return true;
+}
+
+bool MidiInRing::pop(juce::uint32& bytes, double& time)
+{
+  int r=readpos.get();
+  if (r==writepos.get())
+    return false;
+  bytes=messages[r];
+  time=times[r];
+  Atomic<int>::memoryBarrier();
+  readpos.set((r+1) & mask);
+  return true;
+}
+
+MidiInRecording::MidiInRecording()
+  : numblocks (0)
+{
+  for (int b=0; b<MaxBlocks; b++)
+    blocks[b]=NULL;
+}
+
+MidiInRecording::~MidiInRecording()
+{
+  for (int b=0; b<numblocks; b++)
+    delete blocks[b];
+}
+
+void MidiInRecording::add(const MidiMessage& msg)
+{
+  int size=msg.getRawDataSize();
+  if (size<1 || size>3)
+    return;
+  int n=count.get();
+  int b=n/BlockSize;
+  if (b==numblocks)
+    {
+      if (b==MaxBlocks)
+        return;
+      blocks[b]=new Block();
+      numblocks++;
+    }
+  const juce::uint8* data=msg.getRawData();
+  juce::uint32 bytes=data[0] | (size<<24);
+  if (size>1) bytes |= (data[1]<<8);
+  if (size>2) bytes |= (data[2]<<16);
+  blocks[b]->messages[n % BlockSize]=bytes;
+  blocks[b]->times[n % BlockSize]=msg.getTimeStamp();
+  // publish the message (and its block) before the new count
+  Atomic<int>::memoryBarrier();
+  count.set(n+1);
+}
+
+double MidiInRecording::getTime(int index) const
+{
+  Atomic<int>::memoryBarrier();
+  return blocks[index/BlockSize]->times[index % BlockSize];
+}
+
+int MidiInRecording::copyTo(MidiCaptureBuffer& buffer, int start) const
+{
+  if (count.get()==0)
+    return 0;
+  return copyTo(buffer, start, getTime(0), 1.0);
+}
+
+int MidiInRecording::copyTo(MidiCaptureBuffer& buffer, int start, double origin, double scale) const
+{
+  int end=count.get();
+  Atomic<int>::memoryBarrier();
+  if (start>=end)
+    return end;
+  buffer.ensureStorageAllocated(buffer.size()+(end-start));
+  for (int i=start; i<end; i++)
+    {
+      const Block* block=blocks[i/BlockSize];
+      juce::uint32 bytes=block->messages[i % BlockSize];
+      int size=bytes>>24;
+      double time=jmax(0.0, (block->times[i % BlockSize]-origin)*scale);
+      int status=bytes & 0xFF, data1=(bytes>>8) & 0xFF, data2=(bytes>>16) & 0xFF;
+      if (size==3)
+        buffer.add(MidiMessage(status, data1, data2), time);
+      else if (size==2)
+        buffer.add(MidiMessage(status, data1), time);
+      else
+        buffer.add(MidiMessage(status), time);
+    }
+  return end;
+}
+
+void MidiInRecording::clear()
+{
+  // the blocks are kept for the next recording
+  count.set(0);
+}
+
+/*=======================================================================*
+                              Midi File Reader
+ *=======================================================================*/
+
+MidiFileReader::MidiFileReader()
+  : mapping (NULL),
+    data (NULL),
+    size (0),
+    timeformat (0)
+{
+}
+
+MidiFileReader::~MidiFileReader()
+{
+  if (mapping != NULL)
+    delete mapping;
+}
+
+bool MidiFileReader::open(const File& file)
+{
+  if (mapping != NULL)
+    deleteAndZero(mapping);
+  trackstarts.clear();
+  trackends.clear();
+  mapping=new MemoryMappedFile(file, MemoryMappedFile::readOnly);
+  data=(const juce::uint8*)mapping->getData();
+  size=(int)mapping->getSize();
+  if (data==NULL || size<14 || memcmp(data, "MThd", 4)!=0)
+    return false;
+  int headsize=(data[4]<<24) | (data[5]<<16) | (data[6]<<8) | data[7];
+  int numtracks=(data[10]<<8) | data[11];
+  // negative for SMPTE
+  timeformat=(short)((data[12]<<8) | data[13]);
+  if (headsize<6 || timeformat==0)
+    return false;
+  // chunks that aren't tracks are skipped
+  int pos=8+headsize;
+  while (pos+8<=size && trackstarts.size()<numtracks)
+    {
+      int length=(data[pos+4]<<24) | (data[pos+5]<<16) | (data[pos+6]<<8) | data[pos+7];
+      if (length<0)
+        break;
+      if (memcmp(data+pos, "MTrk", 4)==0)
+        {
+          trackstarts.add(pos+8);
+          trackends.add(jmin(pos+8+length, size));
+        }
+      pos+=8+length;
+    }
+  if (timeformat>0)
+    readTempoMap();
+  return trackstarts.size()>0;
+}
+
+bool MidiFileReader::readVarLength(int& pos, int end, int& value)
+{
+  value=0;
+  for (int i=0; i<4; i++)
+    {
+      if (pos>=end)
+        return false;
+      int byte=data[pos++];
+      value=(value<<7) | (byte & 0x7f);
+      if (byte<0x80)
+        return true;
+    }
+  return false;
+}
+
+bool MidiFileReader::readEvent(int& pos, int end, int& running, double& tick,
+                               juce::uint8* bytes, int& start, int& length)
+{
+  int delta, len;
+  if (!readVarLength(pos, end, delta) || pos>=end)
+    return false;
+  tick+=delta;
+  int status=data[pos];
+  if (status>=0x80)
+    pos++;
+  else if (running>0)
+    status=running;
+  else
+    return false;
+  if (status==0xff)
+    {
+      // meta messages keep their raw bytes: ff, type, length, data
+      start=pos-1;
+      if (pos>=end)
+        return false;
+      pos++;
+      if (!readVarLength(pos, end, len) || len>end-pos)
+        return false;
+      pos+=len;
+      length=pos-start;
+    }
+  else if (status==0xf0 || status==0xf7)
+    {
+      if (!readVarLength(pos, end, len) || len>end-pos)
+        return false;
+      pos+=len;
+      length=0;
+    }
+  else if (status>0xf0)
+    return false;
+  else
+    {
+      // only channel messages set the running status
+      running=status;
+      int num=((status & 0xe0)==0xc0) ? 1 : 2; // program and pressure have 1
+      if (num>end-pos)
+        return false;
+      bytes[0]=(juce::uint8)status;
+      for (int i=1; i<=num; i++)
+        bytes[i]=data[pos++] & 0x7f;
+      start=-1;
+      length=num+1;
+    }
+  return true;
+}
+
+struct MidiTempoChange
+{
+  double tick;
+  double rate; // seconds per tick
+};
+
+static bool isEarlierTempo(const MidiTempoChange& a, const MidiTempoChange& b)
+{
+  return a.tick < b.tick;
+}
+
+void MidiFileReader::readTempoMap()
+{
+  // tempo changes can be in any track (format 1 keeps them in track
+  // 0), they apply to every track
+  Array<MidiTempoChange> changes;
+  juce::uint8 bytes[3];
+  for (int t=0; t<trackstarts.size(); t++)
+    {
+      int pos=trackstarts[t], end=trackends[t];
+      int running=0, start, length;
+      double tick=0.0;
+      while (pos<end && readEvent(pos, end, running, tick, bytes, start, length))
+        if (length==6 && start>=0 && data[start+1]==0x51)
+          {
+            MidiTempoChange c;
+            c.tick=tick;
+            c.rate=((data[start+3]<<16) | (data[start+4]<<8) | data[start+5])
+              / (1000000.0*timeformat);
+            changes.add(c);
+          }
+    }
+  std::stable_sort(changes.getRawDataPointer(),
+                   changes.getRawDataPointer()+changes.size(), isEarlierTempo);
+  // 120 bpm until the first change
+  tempoticks.clear();
+  temposecs.clear();
+  temporates.clear();
+  tempoticks.add(0.0);
+  temposecs.add(0.0);
+  temporates.add(0.5/timeformat);
+  for (int i=0; i<changes.size(); i++)
+    {
+      int last=tempoticks.size()-1;
+      double secs=temposecs[last]+((changes[i].tick-tempoticks[last])*temporates[last]);
+      tempoticks.add(changes[i].tick);
+      temposecs.add(secs);
+      temporates.add(changes[i].rate);
+    }
+}
+
+bool MidiFileReader::readTrack(int track, MidiCaptureBuffer& buffer)
+{
+  buffer.clear();
+  if (track<0 || track>=getNumTracks())
+    return false;
+  int pos=trackstarts[track], end=trackends[track];
+  // the smallest events are 3 bytes (running status)
+  buffer.ensureStorageAllocated((end-pos)/3);
+  // SMPTE ticks per second. the frame rate is the negative upper byte
+  double smpte=0.0;
+  if (timeformat<0)
+    smpte=(0xFF-((timeformat & 0xFF00) >> 8)+1) * (timeformat & 0xFF);
+  juce::uint8 bytes[3];
+  int running=0, start, length, tempo=0;
+  double tick=0.0, time;
+  while (pos<end)
+    {
+      if (!readEvent(pos, end, running, tick, bytes, start, length))
+        return false;
+      if (length==0)
+        continue;
+      if (timeformat>0)
+        {
+          while (tempo+1<tempoticks.size() && tempoticks[tempo+1]<=tick)
+            tempo++;
+          time=temposecs[tempo]+((tick-tempoticks[tempo])*temporates[tempo]);
+        }
+      else
+        time=tick/smpte;
+      if (start<0)
+        buffer.add(MidiMessage(bytes, length), time);
+      else
+        {
+          buffer.add(MidiMessage(data+start, length), time);
+          if (data[start+1]==0x2f) // end of track
+            break;
+        }
+    }
+  return true;
+}
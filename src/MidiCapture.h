@@ -0,0 +1,331 @@
+/*=======================================================================*
+  Copyright (C) 2012 Rick Taube.
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the Lisp Lesser Gnu Public License. The text of
+  this agreement is available at http://www.cliki.net/LLGPL
+ *=======================================================================*/
+
+#ifndef MIDICAPTURE_H
+#define MIDICAPTURE_H
+
+#include "Libraries.h"
+#include "BinaryHeap.h"
+
+/*=======================================================================*
+                              Midi File Writer
+ *=======================================================================*/
+
+/** Writes a format 1 Standard Midi File straight to disk. Events are
+    encoded (delta times, running status) as they are written and the
+    header's track count and each track's length are patched in when
+    the track or file is finished, so nothing is held in memory. **/
+
+class MidiFileWriter
+{
+ public:
+  MidiFileWriter();
+  ~MidiFileWriter();
+
+  /** Creates file and writes its header. If msec is true the file's
+      time format is SMPTE milliseconds (25 fps, 40 subframes)
+      otherwise ticks per quarter. Returns false if the file can't be
+      written. **/
+  bool open(const File& file, int ticksperquarter, bool msec);
+  bool isOpen() const {return stream != NULL;}
+
+  /** Starts a new track, any open track is ended first. **/
+  void beginTrack();
+
+  /** Writes msg at tick, ticks may not decrease within a track (later
+      ticks are clipped to the last tick written). **/
+  void writeEvent(const MidiMessage& msg, int tick);
+
+  /** Writes the track's end and patches its length. **/
+  void endTrack();
+
+  /** Patches the header and the open track's length to what has been
+      written so far and flushes the file, so it can be read even if
+      it is never closed. **/
+  void sync();
+
+  /** Ends the last track, patches the header and closes the file.
+      Returns false if writing failed. **/
+  bool close();
+
+ private:
+  FileOutputStream* stream;
+  int64 trackstart;  // position of the open track's length or -1
+  int lasttick;
+  int runningstatus;
+  int numtracks;
+  void writeVarLength(int value);
+  void patch(int64 position, int value, bool isshort);
+};
+
+/*=======================================================================*
+                             Midi Score Stream
+ *=======================================================================*/
+
+/** Streams a score to a midi file as it is rendered. Messages are
+    added with their score times in seconds, which can run ahead of
+    the score (note offs) but never behind it. They wait in a small
+    heap until the score passes their time and are then encoded
+    straight to the file, so memory stays bounded by what is still
+    sounding rather than by the length of the score. The file is
+    synced every few thousand messages so partial output survives a
+    crash. **/
+
+class MidiScoreStream
+{
+ public:
+  MidiScoreStream();
+  ~MidiScoreStream();
+
+  /** Opens file, the caller can then write track 0 through
+      getWriter() before calling startScore(). **/
+  bool open(const File& file, int ticksperquarter, bool msec);
+  bool isOpen() const {return writer.isOpen();}
+  MidiFileWriter& getWriter() {return writer;}
+
+  /** Starts the score's track. **/
+  void startScore();
+
+  /** Adds msg at time (seconds). Messages earlier than what has
+      already been written are written at the current time. **/
+  void add(const MidiMessage& msg, double time);
+
+  /** Writes every message at or before time. **/
+  void flush(double time);
+
+  /** Writes the remaining messages and closes the file. Returns false
+      if writing failed. **/
+  bool close();
+
+  int getNumWritten() const {return numwritten;}
+
+ private:
+  struct Pending
+  {
+    double time;
+    int order;
+    MidiMessage* message;
+  };
+  class Comparator
+  {
+  public:
+    static int compareElements(const Pending& a, const Pending& b)
+    {
+      if (a.time < b.time)
+        return -1;
+      else if (b.time < a.time)
+        return 1;
+      // else both at same time, return message that was added first
+      else if (a.order < b.order)
+        return -1;
+      else
+        return 1;
+    }
+  };
+  MidiFileWriter writer;
+  BinaryHeap<Pending, Comparator> heap;
+  int counter;
+  double ticks;
+  int numwritten;
+};
+
+/*=======================================================================*
+                             Midi Capture Buffer
+ *=======================================================================*/
+
+/** An append only buffer of captured midi messages kept in columns
+    (time stamps and packed message bytes), so adding a message is an
+    amortized O(1) append with no heap object per message. Messages
+    can be added in any time order. The buffer is sorted and its note
+    ons are paired with their note offs only when it is used, in a
+    single linear pass. Like MidiMessageSequence::updateMatchedPairs
+    a note on that is followed by another note on of the same key gets
+    a note off inserted at the second note's time. **/
+
+class MidiCaptureBuffer
+{
+ public:
+  MidiCaptureBuffer();
+  ~MidiCaptureBuffer();
+
+  void add(const MidiMessage& msg, double time);
+
+  /** Adds the channel messages in seq that fall between start and
+      end, shifted by shift. **/
+  void addSequence(const MidiMessageSequence& seq, double shift,
+                   double start, double end);
+
+  int size() const {return times.size();}
+  bool isEmpty() const {return times.size()==0;}
+  /** Makes room for num messages. **/
+  void ensureStorageAllocated(int num);
+  void clear();
+  double getEndTime() const {return endtime;}
+
+  /** Sorts and pairs the buffer if it has changed. **/
+  void prepare();
+
+  /** These may only be called after prepare(). **/
+  double getTime(int index) const {return times.getUnchecked(index);}
+  MidiMessage getMessage(int index) const;
+  /** Returns the index of the note off paired with the note on at
+      index, or -1. **/
+  int getNoteOff(int index) const {return noteoffs.getUnchecked(index);}
+
+  /** Replaces the contents of seq with the buffer, paired. **/
+  void copyTo(MidiMessageSequence& seq);
+
+  /** Writes the buffer as a track of writer's file, time stamps are
+      multiplied by ticks. **/
+  void writeTrack(MidiFileWriter& writer, double ticks);
+
+ private:
+  Array<double> times;
+  // status | data1<<8 | data2<<16 | size<<24. size 0 is a long message
+  // whose index in longs is in the low bits.
+  Array<juce::uint32> packed;
+  OwnedArray<MidiMessage> longs;
+  Array<int> noteoffs;
+  bool sorted;
+  bool prepared;
+  double endtime;
+  void sort();
+  void pair();
+};
+
+/*=======================================================================*
+                                 Midi Input
+ *=======================================================================*/
+
+/** A single producer, single consumer ring of short midi messages
+    from the midi input thread to another thread, holding each
+    message's bytes and time stamp. Neither side locks or
+    allocates. **/
+
+class MidiInRing
+{
+ public:
+  MidiInRing(int size);
+  ~MidiInRing();
+
+  /** Adds msg, returns false if the ring is full or msg is longer
+      than three bytes. Producer only. **/
+  bool push(const MidiMessage& msg);
+
+  /** Removes the oldest message, its bytes are packed status |
+      data1<<8 | data2<<16. Returns false if the ring is empty.
+      Consumer only. **/
+  bool pop(juce::uint32& bytes, double& time);
+
+  bool isEmpty() const {return readpos.get()==writepos.get();}
+
+ private:
+  juce::uint32* messages;
+  double* times;
+  int mask;
+  Atomic<int> readpos;
+  Atomic<int> writepos;
+};
+
+/** Records midi input or output without locking. The thread that
+    receives or sends the messages appends each one and its time stamp
+    to fixed size blocks, allocating a block only when the last one
+    fills, and publishes the new count after every message. Other
+    threads can copy out what has been recorded so far while the
+    recording continues. **/
+
+class MidiInRecording
+{
+ public:
+  MidiInRecording();
+  ~MidiInRecording();
+
+  /** Appends msg at its time stamp. Messages longer than three bytes
+      and messages past the last block are dropped. Producer only. **/
+  void add(const MidiMessage& msg);
+
+  int size() const {return count.get();}
+
+  /** Returns the time stamp of the message at index, which must be
+      less than size(). **/
+  double getTime(int index) const;
+
+  /** Adds the messages from index start to the end of the recording
+      to buffer, timed from the first message recorded. Returns the
+      index to start from next time. **/
+  int copyTo(MidiCaptureBuffer& buffer, int start) const;
+
+  /** Like copyTo() but the times are (stamp-origin)*scale, negative
+      times are clipped to 0. **/
+  int copyTo(MidiCaptureBuffer& buffer, int start, double origin, double scale) const;
+
+  /** Empties the recording, the producer must not be adding. **/
+  void clear();
+
+ private:
+  enum {BlockSize=4096, MaxBlocks=4096};
+  struct Block
+  {
+    juce::uint32 messages[BlockSize]; // status | data1<<8 | data2<<16 | size<<24
+    double times[BlockSize];
+  };
+  Block* blocks[MaxBlocks];
+  int numblocks; // producer only
+  Atomic<int> count;
+};
+
+/*=======================================================================*
+                              Midi File Reader
+ *=======================================================================*/
+
+/** Reads a Standard Midi File through a memory mapping of the file.
+    Tracks are decoded straight from the mapped bytes into a
+    MidiCaptureBuffer with their times converted to seconds, so no
+    MidiFile or MidiMessageSequence is built. **/
+
+class MidiFileReader
+{
+ public:
+  MidiFileReader();
+  ~MidiFileReader();
+
+  /** Maps file and reads its header and track list. Returns false if
+      it isn't a midi file. **/
+  bool open(const File& file);
+  int getNumTracks() const {return trackstarts.size();}
+
+  /** Returns the time format like MidiFile: ticks per quarter if
+      positive otherwise SMPTE frames and ticks per frame. **/
+  int getTimeFormat() const {return timeformat;}
+
+  /** Replaces the contents of buffer with track's channel and meta
+      messages (sysex is skipped). Returns false if the track is
+      corrupt. **/
+  bool readTrack(int track, MidiCaptureBuffer& buffer);
+
+ private:
+  MemoryMappedFile* mapping;
+  const juce::uint8* data;
+  int size;
+  int timeformat;
+  Array<int> trackstarts;  // offset of each track's first event
+  Array<int> trackends;
+  // tempo map: the tick, time and seconds per tick of each change
+  Array<double> tempoticks;
+  Array<double> temposecs;
+  Array<double> temporates;
+  void readTempoMap();
+  /** Decodes the event at pos and adds its delta to tick. A channel
+      message is returned in bytes, a meta message as its start in the
+      file, a sysex has length 0. Returns false if the event is
+      corrupt. **/
+  bool readEvent(int& pos, int end, int& running, double& tick,
+                 juce::uint8* bytes, int& start, int& length);
+  bool readVarLength(int& pos, int end, int& value);
+};
+
+#endif
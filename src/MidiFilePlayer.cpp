@@ -81,6 +81,7 @@ MidiFilePlayer::MidiFilePlayer()
   : midiFile (juce::File::nonexistent),
     fileLength (0),
     fileDuration (0.0),
+    lookahead (0.25),
     midiPort (0),
     fileInfo (0),
     midiPortLabel (0),
@@ -143,6 +144,10 @@ void MidiFilePlayer::setFile(File file)
 
   fileDuration=0;
   fileLength=0;
+  playlist.clear();
+  playtimes.clear();
+  playoffs.clear();
+  heldoffs.clear();
   sequence.clear();
   midiFile=file;
   // create input stream for midi file and read it
@@ -191,22 +196,38 @@ void MidiFilePlayer::setFile(File file)
     }
     // merge file track into our sigle playback sequence
     sequence.addSequence(*seq, 0.0, 0.0, seq->getEndTime()+1);
-    sequence.updateMatchedPairs();
+  }
+  sequence.updateMatchedPairs();
+
+  // index the playable events once so playback reads them in order
+  // and seeks are a binary search of their times. note offs are not
+  // in the list, they are played by their note ons.
+  int numevents=sequence.getNumEvents();
+  playlist.ensureStorageAllocated(numevents);
+  playtimes.ensureStorageAllocated(numevents);
+  playoffs.ensureStorageAllocated(numevents);
+  for (int i=0; i<numevents; i++)
+  {
+    juce::MidiMessageSequence::MidiEventHolder* ev=sequence.getEventPointer(i);
+    if (ev->message.getChannel()<1 || ev->message.isNoteOff())
+      continue;
+    playlist.add(&ev->message);
+    playtimes.add(ev->message.getTimeStamp());
+    playoffs.add((ev->noteOffObject) ? &ev->noteOffObject->message : NULL);
   }
 
   // the file may include more than the note ons and offs so the
   // file length may not reflect the actual number of events that we
   // play. set file playback duration to the very last note event
-  fileLength=sequence.getNumEvents();
+  fileLength=playlist.size();
   for (int i=sequence.getNumEvents()-1; i>=0; i--)
     if (sequence.getEventPointer(i)->message.isNoteOnOrOff())
     {
       fileDuration=sequence.getEventPointer(i)->message.getTimeStamp();
       break;
     }
-  // set the playback range to our upper bounds, note that the
-  // length may include meta message
-  pbthread->setPlaybackLimit(fileDuration, sequence.getNumEvents());
+  // set the playback range to our upper bounds
+  pbthread->setPlaybackLimit(fileDuration, playlist.size());
   pbthread->setMidiOutputPort(MidiOutPort::getInstance()->device);
   juce::String info (midiFile.getFileName());
   info << ": tracks=" << numtracks  << ", dur=" << fileDuration;
@@ -273,13 +294,16 @@ void MidiFilePlayer::positionChanged(double position, bool isPlaying, int dir)
   // playback sequence and update the MidiPlaybackThread's playback
   // position
   double newtime=position * fileDuration;
-  int newindex = sequence.getNextIndexAtTime(newtime);
+  int newindex = getPlaylistIndex(newtime);
   // 
   if (isPlaying)
   {
     pbthread->pause();
   }
+  // the thread is paused so it can't be adding messages. pausing has
+  // silenced any notes whose offs were held or queued
   pbthread->clear();
+  heldoffs.clearQuick();
   pbthread->setPlaybackPosition(newtime,newindex);
   if (isPlaying)
   {
@@ -302,36 +326,61 @@ void MidiFilePlayer::tempoChanged(double tempo, bool isPlaying)
 void MidiFilePlayer::addMidiPlaybackMessages(MidiPlaybackThread::MidiMessageQueue& queue, 
                                              MidiPlaybackThread::PlaybackPosition& position)
 {
-  // add noteOns for the current playback time and index then update
+  // add the events for the current playback time and index then update
   // the index for the next runtime
 
   //std::cout << "addMidiPlaybackMessages beat=" << position.time << " index=" << position.index << "\n";
-  int index=index=position.index;
+  int index=position.index;
   for (; index<position.length; index++)
   {
-    MidiMessageSequence::MidiEventHolder* ev=sequence.getEventPointer(index);
-    // skip over non-channel messages
-    if (ev->message.getChannel()<1)
-      continue;
-    // skip over noteOffs because we add by pairs with noteOns
-    if (ev->message.isNoteOff())
-      continue;
-    if (ev->message.getTimeStamp() <= position.beat)
-    {
-      queue.addMessage(new MidiMessage(ev->message));
-      //MidiPlaybackThread::printMessage(ev->message);
-      if (ev->noteOffObject)
-      {
-        queue.addMessage(new MidiMessage(ev->noteOffObject->message));            
-        //MidiPlaybackThread::printMessage(ev->noteOffObject->message);
-      }
-    }
-    else
+    if (playtimes.getUnchecked(index) > position.beat)
       break;
+    queue.addMessage(*playlist.getUnchecked(index));
+    if (playoffs.getUnchecked(index))
+      holdNoteOff(playoffs.getUnchecked(index));
   }
   // index is now the index of the next (future) event or length
   position.index=index;
+  // release the note offs that are due within the lookahead window.
+  // once the last event is queued the thread stops calling us so
+  // everything still held goes into the queue.
+  bool atend=(index>=position.length);
+  double window=position.beat+jmax(lookahead, position.tick);
+  while (heldoffs.size()>0 && (atend || heldoffs.getLast()->getTimeStamp() <= window))
+  {
+    queue.addMessage(*heldoffs.getLast());
+    heldoffs.removeLast();
+  }
+  position.pending=heldoffs.size();
 }
 
+int MidiFilePlayer::getPlaylistIndex(double time)
+{
+  // binary search for the first event at or after time
+  int lo=0, hi=playtimes.size();
+  while (lo<hi)
+  {
+    int mid=(lo+hi)/2;
+    if (playtimes.getUnchecked(mid) < time)
+      lo=mid+1;
+    else
+      hi=mid;
+  }
+  return lo;
+}
 
-
+void MidiFilePlayer::holdNoteOff(const juce::MidiMessage* off)
+{
+  // heldoffs is sorted latest first so the next one due is last
+  double time=off->getTimeStamp();
+  int lo=0, hi=heldoffs.size();
+  while (lo<hi)
+  {
+    int mid=(lo+hi)/2;
+    if (heldoffs.getUnchecked(mid)->getTimeStamp() >= time)
+      lo=mid+1;
+    else
+      hi=mid;
+  }
+  heldoffs.insert(lo, off);
+}
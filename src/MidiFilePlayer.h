@@ -38,6 +38,18 @@ private:
   int fileLength;
   double fileDuration;
   juce::MidiMessageSequence sequence;
+  // playback index built by setFile: the channel messages to play
+  // (note offs excluded) in time order, their times, and each note
+  // on's note off or NULL.
+  juce::Array<const juce::MidiMessage*> playlist;
+  juce::Array<double> playtimes;
+  juce::Array<const juce::MidiMessage*> playoffs;
+  // note offs of queued note ons, latest first. they are released into
+  // the queue when they fall within lookahead beats of the position.
+  juce::Array<const juce::MidiMessage*> heldoffs;
+  double lookahead;
+  int getPlaylistIndex(double time);
+  void holdNoteOff(const juce::MidiMessage* off);
   MidiPlaybackThread* pbthread;
   Transport* transport;
 
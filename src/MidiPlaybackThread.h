@@ -14,6 +14,7 @@
 #endif
 
 #include "Transport.h"
+#include "MicroTuning.h"
 
 /** A thread that plays midi messages out a midi port in real time. To
     use a MidiPlaybackThread first call startThread() and then
@@ -83,6 +84,13 @@ class MidiPlaybackThread : public juce::Thread
 
     bool stop;
 
+    /** The number of messages the source is holding back to add to
+        the queue later (e.g. note offs it releases shortly before
+        they are due). The thread treats these like queued messages
+        when it pauses, so held notes are silenced. **/
+
+    int pending;
+
     /** Internal PlaybackPosition constructor */
 
   PlaybackPosition()
@@ -91,7 +99,8 @@ class MidiPlaybackThread : public juce::Thread
       tick (0.0),
       index (0),
       length (0),
-      stop (false)
+      stop (false),
+      pending (0)
       {
       }
   
@@ -121,73 +130,269 @@ class MidiPlaybackThread : public juce::Thread
       beat=0.0;
       index=0;
       stop=false;
+      pending=0;
     }
   
   };
 
-  /** A queue of time sorted midi messages. The queue automatically
-      sorts itself according to message time stamps. The queue is
-      passed to the sources addMidiPlaybackMessages function which can
-      add messages to the queue using addMessage().  Added messages
-      are owned by the queue and deleted after they have been sent out
-      the MidiOut port. **/
-
-  class MidiMessageQueue : public juce::OwnedArray<juce::MidiMessage>
+  /** A queue of time sorted midi messages kept in a timing wheel. The
+      wheel is a ring of slots, one per tick of the thread, and a
+      message is filed in the slot of the tick its time stamp falls
+      in, so adding or sending a message only walks the few messages
+      in one slot. Messages further ahead than the wheel reaches wait
+      in an overflow list until the wheel comes around to them. The
+      queue holds the bytes and time stamps of its messages in a
+      preallocated pool, not MidiMessage objects, so only short
+      (channel) messages can be queued. The queue is passed to the
+      source's addMidiPlaybackMessages function which adds messages to
+      it using addMessage(). Messages are sent in time order with note
+      offs before anything else at the same time stamp to avoid note
+      clipping, other messages at the same time are sent in the order
+      they were added. **/
+
+  class MidiMessageQueue
   {
 
   public:
 
-    /** Internal MidiMessageQueue constuctor. **/
-
-     MidiMessageQueue(){}
+    /** Internal MidiMessageQueue constuctor, preallocates room for
+        reserve messages. **/
+
+    MidiMessageQueue(int reserve=256)
+      : tick (0.01),
+        numqueued (0),
+        numwheel (0),
+        current (0),
+        freelist (-1),
+        overflow (-1),
+        overflowtail (-1),
+        overflowtick (0)
+    {
+      for (int i=0; i<WheelSize; i++)
+        wheel[i]=-1;
+      entries.ensureStorageAllocated(reserve);
+    }
 
     /** Internal MidiMessageQueue destructor. **/
 
     ~MidiMessageQueue(){}
 
-   /** Adds a MidiMessage to the thread's playback queue. Once
-       messages are added they are owned by the queue and will be
-       automatically deleted once they are sent out the midi
-       port. Added messages are inserted at the appopriate position in
-       the queue according to the message time stamp. Time stamps are
-       in beats, not seconds, and this beat time is automatically
-       scaled by a tempo factor during playback. Once a message has
-       been sent out the midiport it is deleted by the thread. **/
+    /** Returns the number of messages in the queue. **/
+
+    int size() const {return numqueued;}
+
+    /** Sets the width of a wheel slot in beats, this is the thread's
+        tick. Messages already in the queue are refiled. **/
+
+    void setTickSize(double beats)
+    {
+      if (beats<=0.0 || beats==tick)
+        return;
+      // gather the queued messages in the order they will be sent
+      // then file them again at the new size
+      juce::Array<int> queued;
+      queued.ensureStorageAllocated(numqueued);
+      Entry* e=entries.getRawDataPointer();
+      for (int s=0; s<WheelSize; s++)
+        for (int i=wheel[(int)((current+s) % WheelSize)]; i>-1; i=e[i].next)
+          queued.add(i);
+      for (int i=overflow; i>-1; i=e[i].next)
+        queued.add(i);
+      current=(juce::int64)floor((current*tick)/beats);
+      tick=beats;
+      empty();
+      numqueued=queued.size();
+      for (int i=0; i<queued.size(); i++)
+        file(queued.getUnchecked(i));
+    }
+
+   /** Adds a copy of msg to the queue at its time stamp. Time stamps
+       are in beats, not seconds, and this beat time is automatically
+       scaled by a tempo factor during playback. Messages longer than
+       three bytes are ignored. **/
   
-    void addMessage(juce::MidiMessage* msg)
+    void addMessage(const juce::MidiMessage& msg)
+    {
+      int size=msg.getRawDataSize();
+      if (size<1 || size>3)
+        return;
+      const juce::uint8* data=msg.getRawData();
+      juce::uint32 bytes=data[0] | (size<<24);
+      if (size>1) bytes |= (data[1]<<8);
+      if (size>2) bytes |= (data[2]<<16);
+      double time=msg.getTimeStamp();
+      if (numqueued==0) // an empty wheel starts at the new message
+        current=getTick(time);
+      numqueued++;
+      file(allocate(time, bytes));
+    }
+
+    /** Removes the next message due at or before now and sets msg to
+        it. Returns false if no message is due. **/
+
+    bool getNextMessage(double now, juce::MidiMessage& msg)
+    {
+      if (numqueued==0)
+        return false;
+      juce::int64 nowtick=getTick(now);
+      Entry* e=entries.getRawDataPointer();
+      while (true)
+      {
+        int* slot=&wheel[(int)(current % WheelSize)];
+        if (*slot>-1)
+        {
+          int i=*slot;
+          if (e[i].time > now)
+            return false;
+          *slot=e[i].next;
+          e[i].next=freelist;
+          freelist=i;
+          numqueued--;
+          numwheel--;
+          juce::uint32 bytes=e[i].bytes;
+          int size=bytes>>24;
+          if (size==3)
+            msg=juce::MidiMessage(bytes & 0xFF, (bytes>>8) & 0xFF, (bytes>>16) & 0xFF, e[i].time);
+          else if (size==2)
+            msg=juce::MidiMessage(bytes & 0xFF, (bytes>>8) & 0xFF, e[i].time);
+          else
+            msg=juce::MidiMessage(bytes & 0xFF, e[i].time);
+          return true;
+        }
+        if (current>=nowtick)
+          return false;
+        // move to the next slot, jumping straight to the next
+        // message if the wheel itself is empty
+        if (numwheel==0)
+          current=(overflow>-1) ? juce::jmin(nowtick, overflowtick) : nowtick;
+        else
+          current++;
+        if ((overflow>-1) && (overflowtick<current+WheelSize))
+        {
+          int i=overflow;
+          overflow=overflowtail=-1;
+          while (i>-1)
+          {
+            int next=e[i].next;
+            file(i);
+            i=next;
+          }
+        }
+      }
+    }
+
+    /** Removes all the messages from the queue. **/
+
+    void clear()
+    {
+      empty();
+      numqueued=0;
+      freelist=-1;
+      entries.clearQuick();
+    }
+
+  private:
+
+    enum {WheelSize=1024};
+
+    struct Entry
+    {
+      double time;
+      juce::uint32 bytes; // status | data1<<8 | data2<<16 | size<<24
+      int next;           // next entry in its slot or list, or -1
+    };
+
+    juce::Array<Entry> entries; // message pool, unused entries are on the freelist
+    int wheel[WheelSize];       // first entry in each slot or -1
+    double tick;                // beats per slot
+    int numqueued;
+    int numwheel;               // messages in the wheel (not in overflow)
+    juce::int64 current;        // the tick of the slot being sent
+    int freelist;
+    int overflow;               // messages beyond the wheel, in the order added
+    int overflowtail;
+    juce::int64 overflowtick;   // earliest tick in overflow
+
+    juce::int64 getTick(double time) const
+    {
+      return (juce::int64)floor(time/tick);
+    }
+
+    static bool isNoteOff(juce::uint32 bytes)
     {
-      addSorted(*this, msg);
+      int op=bytes & 0xF0;
+      return (op==0x80) || ((op==0x90) && (((bytes>>16) & 0x7F)==0));
     }
 
-    /** Comparator keeps the queue in time sorted order but places
-        note offs before anything else at the same time stamp to avoid
-        note clipping. All other message types are added at the last
-        possible position for their time. **/
+    /** Returns true if a message at time is sent before the entry e
+        that is already queued. **/
 
-    static int compareElements(juce::MidiMessage* a, juce::MidiMessage* b)
+    static bool isSentBefore(double time, juce::uint32 bytes, const Entry& e)
     {
-      if (a->getTimeStamp() < b->getTimeStamp())
-        return -1;
-      else if (b->getTimeStamp() < a->getTimeStamp())
-        return 1;
+      if (time == e.time)
+        return isNoteOff(bytes) && !isNoteOff(e.bytes);
+      return (time < e.time);
+    }
+
+    int allocate(double time, juce::uint32 bytes)
+    {
+      int i=freelist;
+      if (i>-1)
+        freelist=entries.getReference(i).next;
       else
       {
-        if (a->isNoteOff())
+        Entry blank;
+        entries.add(blank);
+        i=entries.size()-1;
+      }
+      Entry& e=entries.getReference(i);
+      e.time=time;
+      e.bytes=bytes;
+      e.next=-1;
+      return i;
+    }
+
+    /** Files entry i in the slot of its tick, or the current slot if
+        it is late, or at the end of overflow if it is beyond the
+        wheel. **/
+
+    void file(int i)
+    {
+      Entry* e=entries.getRawDataPointer();
+      juce::int64 t=juce::jmax(getTick(e[i].time), current);
+      if (t>=current+WheelSize)
+      {
+        if (overflow<0)
         {
-          if (b->isNoteOff())
-            return 0;
-          else 
-            return -1;
+          overflow=i;
+          overflowtick=t;
         }
         else
         {
-          if (b->isNoteOff())
-            return 1;
-          else
-            return 0;
+          e[overflowtail].next=i;
+          overflowtick=juce::jmin(overflowtick, t);
         }
+        overflowtail=i;
+        e[i].next=-1;
+        return;
       }
-    } 
+      int* link=&wheel[(int)(t % WheelSize)];
+      while ((*link>-1) && !isSentBefore(e[i].time, e[i].bytes, e[*link]))
+        link=&e[*link].next;
+      e[i].next=*link;
+      *link=i;
+      numwheel++;
+    }
+
+    /** Empties the wheel and overflow without touching the pool. **/
+
+    void empty()
+    {
+      for (int i=0; i<WheelSize; i++)
+        wheel[i]=-1;
+      numwheel=0;
+      overflow=overflowtail=-1;
+    }
   };
 
   /** A class to receive callbacks from a MidiPlaybackThread to add
@@ -246,6 +451,7 @@ class MidiPlaybackThread : public juce::Thread
     paused (true)
     {   
       position.tick= 1.0/ticksPerBeat;
+      messages.setTickSize(position.tick);
     }
   
   ~MidiPlaybackThread()
@@ -283,14 +489,19 @@ class MidiPlaybackThread : public juce::Thread
   }
 
   /** Sets the playback position to the specified beat. To update the
-      position's index as well specify an index value 0 or larger. **/
+      position's index as well specify an index value 0 or larger, the
+      source is then assumed to have dropped any messages it was
+      holding. **/
 
   void setPlaybackPosition(double beat, int index=-1)
   {
     juce::ScopedLock mylock(pblock);
     position.beat=beat;
     if (index>-1)
+    {
       position.index=index;      
+      position.pending=0;
+    }
   }
 
   /** Sets the thread's playback tempo in beats per minute. This value
@@ -315,6 +526,7 @@ class MidiPlaybackThread : public juce::Thread
     if (tpb<1) tpb=1;
     ticks=(int)tpb;
     position.tick=1.0/tpb;
+    messages.setTickSize(position.tick);
   }
 
   /** Returns true if the thread is currently paused. **/
@@ -362,50 +574,34 @@ class MidiPlaybackThread : public juce::Thread
       {
         // send allNotesOff if pausing with messages still in queue.
         // not sure if we need to lock the queue to check its size...
-        if (messages.size() > 0)
+        if (messages.size() > 0 || position.pending > 0)
           sendAllNotesOff();
       }
     }
   }
 
-  /** Microtunes successive channels in the output device according to
-      the number of divisions per semitone, a value 1 to 16
-      inclusive. The starting channel is channel offset to begin
-      tuning at, a value 0 to 15 inclusive. **/
+  /** Microtunes the channels in the output device by sending each
+      channel its pitch bend in tuning. Untuned channels are set to
+      slider position 0. **/
 
-  void sendMicrotuning(int divs, int startingChannel=0)
+  void sendMicrotuning(const MicroTuning& tuning)
   {
     juce::ScopedLock mylock(pblock);
     if (port==0) return;
-    divs=juce::jlimit(1,16,divs);
-    int chan=startingChannel;
-    for (; chan<divs && chan<16; chan++)
-    {
-      double frac=(double)((double)chan/(double)divs);
-      // juce pitch bends are 0 to 16383 with slider 0 == 8192 and
-      // range -2 to 2 semitones so: bend=rescale(slider,-2,2,0,16383)
-      int bend=(int)(4095.75 * (frac + 2));
-      std::cout << "sending pitchbend, chan=" << chan << " bend=" << bend << "\n";
-      port->sendMessageNow( juce::MidiMessage::pitchWheel(chan+1,bend));
-    }
-    // adjust all higher channels to slider position 0 (no tuning)
-    for (; chan<16; chan++)
-      port->sendMessageNow( juce::MidiMessage::pitchWheel(chan+1,8192));
+    for (int chan=0; chan<16; chan++)
+      port->sendMessageNow( juce::MidiMessage::pitchWheel(chan+1, tuning.getChannelBend(chan)));
   }
 
-  /** Utility function to microtune a message by shifting it the
-      appropiate number of channels for the specified divisions and
-      fractional keynum. The message should already have its base
-      channel and (integer) keynum values assigned.  **/
+  /** Utility function to microtune a note message by moving it to the
+      channel and key that tuning maps the fractional keynum to. The
+      message should already have its base channel assigned.  **/
 
-  static void microtuneMessage(juce::MidiMessage& msg, int divs, double knum)
+  static void microtuneMessage(juce::MidiMessage& msg, MicroTuning& tuning, double knum)
   {
-    int base=(int)knum;
-    double frac=knum-base;
-    // how many channels we have to shift for the resolution
-    int shift=(int)(frac/divs);
-    if (shift>0)
-      msg.setChannel(msg.getChannel()+shift);
+    MicroNote note;
+    tuning.map(msg.getChannel()-1, knum, note);
+    msg.setChannel(note.chan+1);
+    msg.setNoteNumber(note.key);
   }
 
   /** Clears the queue of pending messages. Don't call this unless the
@@ -484,19 +680,9 @@ class MidiPlaybackThread : public juce::Thread
             pblock.enter();
             double now=position.beat;
             pos=now/position.endbeat;
-            juce::MidiMessage* msg=0; 
-            while (msg=messages.getFirst())
-            {
-              if (msg->getTimeStamp() <= now)              
-              {
-                messages.remove(0, false); // pop message off queue
-                processMessage(msg);       // process message
-              }
-              else
-              {
-                break;
-              }
-            }
+            juce::MidiMessage msg;
+            while (messages.getNextMessage(now, msg))
+              processMessage(msg);       // process message
             position.beat += position.tick;
             pblock.exit();
           }
@@ -511,13 +697,9 @@ class MidiPlaybackThread : public juce::Thread
           pos=now/position.endbeat;
           // call sources's routine to get more messages
           source->addMidiPlaybackMessages(messages, position);
-          juce::MidiMessage* msg=messages.getFirst();          
-          while (msg && msg->getTimeStamp() <= now)
-          {
-            messages.remove(0, false); // pop message off queue
+          juce::MidiMessage msg;
+          while (messages.getNextMessage(now, msg))
             processMessage(msg);       // send message out port
-            msg=messages.getFirst();   // increment to next
-          }
           position.beat += position.tick;  // increment beat
           pblock.exit();
         }
@@ -553,13 +735,12 @@ class MidiPlaybackThread : public juce::Thread
   
   /** Internal function that sends a message out the midi port. **/
 
-  void processMessage(juce::MidiMessage* msg)
+  void processMessage(const juce::MidiMessage& msg)
   {
     if (port)
-      port->sendMessageNow(*msg);
+      port->sendMessageNow(msg);
     if (1)
-      printMidiMessage(*msg);
-    delete msg; // DELETE MESSAGE AFTER USE
+      printMidiMessage(msg);
   }
   
   /** Internal function that sends an allNotesOff if we pause or move
@@ -577,7 +758,7 @@ class MidiPlaybackThread : public juce::Thread
     }
   }
 
-  static const void printMidiMessage(juce::MidiMessage& msg)
+  static const void printMidiMessage(const juce::MidiMessage& msg)
   {
     int op=(msg.getRawData()[0] & 0xf0)>>4;
     int ch=msg.getChannel()-1;
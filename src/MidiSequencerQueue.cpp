@@ -0,0 +1,199 @@
+/*=======================================================================*
+  Copyright (C) 2012 Rick Taube.
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the Lisp Lesser Gnu Public License. The text of
+  this agreement is available at http://www.cliki.net/LLGPL
+ *=======================================================================*/
+
+#include "MidiSequencerQueue.h"
+
+// juce defines JUCE_LINUX, JUCE_MAC or JUCE_WIN32 already
+#if defined(JUCE_LINUX)
+  #include <alsa/asoundlib.h>
+#endif
+
+MidiSequencerQueue::MidiSequencerQueue()
+  : seq (NULL),
+    encoder (NULL),
+    status (NULL),
+    encodersize (0),
+    port (-1),
+    queue (-1)
+{
+}
+
+MidiSequencerQueue::~MidiSequencerQueue()
+{
+  close();
+}
+
+#if defined(JUCE_LINUX)
+
+/** Finds the sequencer address of output device id. The devices are
+    counted the way juce's MidiOutput::getDevices() lists them: every
+    port that can be written to, client by client. **/
+
+static bool findOutputPort(snd_seq_t* handle, int id, int& client, int& port)
+{
+  snd_seq_client_info_t* clientinfo;
+  snd_seq_port_info_t* portinfo;
+  snd_seq_client_info_alloca(&clientinfo);
+  snd_seq_port_info_alloca(&portinfo);
+  int count=0;
+  snd_seq_client_info_set_client(clientinfo, -1);
+  while (snd_seq_query_next_client(handle, clientinfo) == 0)
+  {
+    snd_seq_port_info_set_client(portinfo, snd_seq_client_info_get_client(clientinfo));
+    snd_seq_port_info_set_port(portinfo, -1);
+    while (snd_seq_query_next_port(handle, portinfo) == 0)
+    {
+      if ((snd_seq_port_info_get_capability(portinfo) & SND_SEQ_PORT_CAP_WRITE) == 0)
+        continue;
+      if (count++ == id)
+      {
+        client=snd_seq_port_info_get_client(portinfo);
+        port=snd_seq_port_info_get_port(portinfo);
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+bool MidiSequencerQueue::open(int id)
+{
+  close();
+  snd_seq_t* handle;
+  if (snd_seq_open(&handle, "default", SND_SEQ_OPEN_OUTPUT, 0) < 0)
+    return false;
+  seq=handle;
+  int destclient, destport;
+  snd_midi_event_t* enc;
+  snd_seq_queue_status_t* stat;
+  snd_seq_set_client_name(handle, "Common Music");
+  port=snd_seq_create_simple_port(handle, "Common Music Queue",
+                                  SND_SEQ_PORT_CAP_READ | SND_SEQ_PORT_CAP_SUBS_READ,
+                                  SND_SEQ_PORT_TYPE_MIDI_GENERIC | SND_SEQ_PORT_TYPE_APPLICATION);
+  queue=snd_seq_alloc_named_queue(handle, "Common Music Queue");
+  encodersize=256;
+  if (port < 0 || queue < 0 ||
+      !findOutputPort(handle, id, destclient, destport) ||
+      snd_seq_connect_to(handle, port, destclient, destport) < 0 ||
+      snd_midi_event_new(encodersize, &enc) < 0)
+  {
+    close();
+    return false;
+  }
+  encoder=enc;
+  if (snd_seq_queue_status_malloc(&stat) < 0)
+  {
+    close();
+    return false;
+  }
+  status=stat;
+  snd_seq_start_queue(handle, queue, NULL);
+  snd_seq_drain_output(handle);
+  return true;
+}
+
+void MidiSequencerQueue::close()
+{
+  if (status != NULL)
+    snd_seq_queue_status_free((snd_seq_queue_status_t*)status);
+  if (encoder != NULL)
+    snd_midi_event_free((snd_midi_event_t*)encoder);
+  if (seq != NULL)
+  {
+    snd_seq_t* handle=(snd_seq_t*)seq;
+    // anything still queued is dropped with the queue
+    if (queue >= 0)
+      snd_seq_free_queue(handle, queue);
+    snd_seq_close(handle);
+  }
+  seq=encoder=status=NULL;
+  port=queue=-1;
+}
+
+void MidiSequencerQueue::sendBlock(const MidiBuffer& block, double start)
+{
+  if (seq == NULL)
+    return;
+  snd_seq_t* handle=(snd_seq_t*)seq;
+  snd_midi_event_t* enc=(snd_midi_event_t*)encoder;
+  // queue time is real time since the queue started, line it up with
+  // our clock once per block
+  snd_seq_get_queue_status(handle, queue, (snd_seq_queue_status_t*)status);
+  const snd_seq_real_time_t* qtime=
+    snd_seq_queue_status_get_real_time((snd_seq_queue_status_t*)status);
+  double qnow=(qtime->tv_sec*1000.0)+(qtime->tv_nsec/1000000.0);
+  double now=Time::getMillisecondCounterHiRes();
+  MidiBuffer::Iterator iter (block);
+  const uint8* data;
+  int size, pos;
+  while (iter.getNextEvent(data, size, pos))
+  {
+    // late messages are queued for now, which sends them at once
+    double ms=qnow+jmax(0.0, start+(pos/1000.0)-now);
+    snd_seq_real_time_t when;
+    when.tv_sec=(unsigned int)(ms/1000.0);
+    when.tv_nsec=(unsigned int)((ms-(when.tv_sec*1000.0))*1000000.0);
+    if (size > encodersize)
+    {
+      // long sysex
+      encodersize=size;
+      snd_midi_event_resize_buffer(enc, encodersize);
+    }
+    snd_midi_event_reset_encode(enc);
+    while (size > 0)
+    {
+      snd_seq_event_t event;
+      snd_seq_ev_clear(&event);
+      long used=snd_midi_event_encode(enc, data, size, &event);
+      if (used <= 0)
+        break;
+      data+=used;
+      size-=(int)used;
+      if (event.type == SND_SEQ_EVENT_NONE)
+        continue;
+      snd_seq_ev_set_source(&event, port);
+      snd_seq_ev_set_subs(&event);
+      snd_seq_ev_schedule_real(&event, queue, 0, &when);
+      snd_seq_event_output(handle, &event);
+    }
+  }
+  snd_seq_drain_output(handle);
+}
+
+void MidiSequencerQueue::clear()
+{
+  if (seq == NULL)
+    return;
+  snd_seq_t* handle=(snd_seq_t*)seq;
+  snd_seq_remove_events_t* remove;
+  snd_seq_remove_events_alloca(&remove);
+  snd_seq_remove_events_set_queue(remove, queue);
+  snd_seq_remove_events_set_condition(remove, SND_SEQ_REMOVE_OUTPUT | SND_SEQ_REMOVE_IGNORE_OFF);
+  snd_seq_drop_output(handle);
+  snd_seq_remove_events(handle, remove);
+}
+
+#else
+
+bool MidiSequencerQueue::open(int id)
+{
+  return false;
+}
+
+void MidiSequencerQueue::close()
+{
+}
+
+void MidiSequencerQueue::sendBlock(const MidiBuffer& block, double start)
+{
+}
+
+void MidiSequencerQueue::clear()
+{
+}
+
+#endif
@@ -0,0 +1,57 @@
+/*=======================================================================*
+  Copyright (C) 2012 Rick Taube.
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the Lisp Lesser Gnu Public License. The text of
+  this agreement is available at http://www.cliki.net/LLGPL
+ *=======================================================================*/
+
+#ifndef MIDISEQUENCERQUEUE_H
+#define MIDISEQUENCERQUEUE_H
+
+#include "Libraries.h"
+
+/*=======================================================================*
+                            Midi Sequencer Queue
+ *=======================================================================*/
+
+/** Sends time stamped midi to an output device through a queue of the
+    ALSA sequencer, so the kernel sends each message at its time rather
+    than a thread of ours. The queue has its own sequencer client and
+    port, connected to the same port MidiOutput::openDevice() writes
+    to. Messages that are already late go out at once, nothing is
+    dropped. Only linux has the sequencer, elsewhere open() fails and
+    the caller should use the device's own background thread. All the
+    methods must be called from one thread. **/
+
+class MidiSequencerQueue
+{
+ public:
+  MidiSequencerQueue();
+  ~MidiSequencerQueue();
+
+  /** Connects to output device id (its index in
+      MidiOutput::getDevices()) and starts the queue. Returns false if
+      there is no sequencer or no such device. **/
+  bool open(int id);
+  void close();
+  bool isOpen() const {return seq != NULL;}
+
+  /** Queues the messages in block, whose positions are microseconds
+      after start (milliseconds on the
+      Time::getMillisecondCounterHiRes() clock), and hands them to the
+      kernel. **/
+  void sendBlock(const MidiBuffer& block, double start);
+
+  /** Removes every message that hasn't been sent yet. **/
+  void clear();
+
+ private:
+  void* seq;          // snd_seq_t
+  void* encoder;      // snd_midi_event_t
+  void* status;       // snd_seq_queue_status_t
+  int encodersize;
+  int port;
+  int queue;
+};
+
+#endif
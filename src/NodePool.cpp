@@ -0,0 +1,107 @@
+/*=======================================================================*
+  Copyright (C) 2012 Rick Taube.
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the Lisp Lesser Gnu Public License. The text of
+  this agreement is available at http://www.cliki.net/LLGPL
+ *=======================================================================*/
+
+#include "NodePool.h"
+
+NodePool::NodePool(String poolname, int slotsize, int numslots)
+  : name (poolname),
+    slab (NULL),
+    slotbytes (0),
+    capacity (numslots),
+    freelist (NULL),
+    inuse (0),
+    highwater (0),
+    overflows (0)
+{
+  // round slots up so every slot is aligned for doubles and pointers
+  int align=jmax((int)sizeof(double), (int)sizeof(void*));
+  slotbytes=((jmax(slotsize, (int)sizeof(Slot))+align-1)/align)*align;
+  slab=new char[slotbytes*capacity];
+  // thread the free list through the slots in address order
+  for (int i=capacity-1; i>=0; i--)
+    {
+      Slot* s=(Slot*)(slab+(i*slotbytes));
+      s->next=freelist;
+      freelist=s;
+    }
+}
+
+NodePool::~NodePool()
+{
+  // if nodes are still alive at exit leave the slab to the os
+  if (inuse==0)
+    delete[] slab;
+}
+
+void* NodePool::allocate(size_t size)
+{
+  if ((int)size<=slotbytes)
+    {
+      const SpinLock::ScopedLockType l (lock);
+      if (freelist != NULL)
+        {
+          Slot* s=freelist;
+          freelist=s->next;
+          if (++inuse>highwater)
+            highwater=inuse;
+          return s;
+        }
+      overflows++;
+    }
+  else
+    {
+      const SpinLock::ScopedLockType l (lock);
+      overflows++;
+    }
+  return ::operator new(size);
+}
+
+void NodePool::release(void* ptr)
+{
+  if (ptr==NULL)
+    return;
+  char* p=(char*)ptr;
+  if (p>=slab && p<slab+(slotbytes*capacity))
+    {
+      Slot* s=(Slot*)ptr;
+      const SpinLock::ScopedLockType l (lock);
+      s->next=freelist;
+      freelist=s;
+      inuse--;
+    }
+  else
+    ::operator delete(ptr);
+}
+
+int NodePool::getNumInUse()
+{
+  const SpinLock::ScopedLockType l (lock);
+  return inuse;
+}
+
+int NodePool::getHighWaterMark()
+{
+  const SpinLock::ScopedLockType l (lock);
+  return highwater;
+}
+
+int NodePool::getNumOverflows()
+{
+  const SpinLock::ScopedLockType l (lock);
+  return overflows;
+}
+
+String NodePool::getStatsString()
+{
+  String str=String::empty;
+  str << name << T(": capacity=") << getCapacity()
+      << T(" in-use=") << getNumInUse()
+      << T(" high-water=") << getHighWaterMark()
+      << T(" overflows=") << getNumOverflows()
+      << T("\n");
+  return str;
+}
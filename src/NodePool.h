@@ -0,0 +1,55 @@
+/*=======================================================================*
+  Copyright (C) 2012 Rick Taube.
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the Lisp Lesser Gnu Public License. The text of
+  this agreement is available at http://www.cliki.net/LLGPL
+ *=======================================================================*/
+
+#ifndef NODEPOOL_H
+#define NODEPOOL_H
+
+#include "Libraries.h"
+
+/*=======================================================================*
+                                Node Pool
+ *=======================================================================*/
+
+/** A preallocated block of fixed-size slots for the scheduler's node
+    classes, which use it in their operator new and delete. Taking a
+    slot is a pop from a free list under a SpinLock, so allocating a
+    node on the real time path never calls malloc. If the pool is
+    exhausted (or a request is bigger than a slot) the pool falls back
+    on the heap and counts the overflow. Slots can be allocated and
+    released from any thread. **/
+
+class NodePool
+{
+ public:
+
+  NodePool(String poolname, int slotsize, int numslots);
+  ~NodePool();
+
+  String name;
+
+  void* allocate(size_t size);
+  void release(void* ptr);
+
+  int getCapacity() {return capacity;}
+  int getNumInUse();
+  int getHighWaterMark();
+  int getNumOverflows();
+  String getStatsString();
+
+ private:
+  struct Slot {Slot* next;};
+  char* slab;
+  int slotbytes;
+  int capacity;
+  Slot* freelist;
+  SpinLock lock;
+  int inuse;
+  int highwater;
+  int overflows;
+};
+
+#endif
@@ -221,82 +221,113 @@ int OscPort::sendBundle(lo_bundle bndl)
 void OscPort::handleMessage(const char *oscpath, const char *types, int argc, void **data)
 {
   SchemeThread* st=SchemeThread::getInstance();
-  String path (oscpath);
-  OscHook* hook=st->getOscHook(path);
-  //std::cout << "handleMessage " << path << " " << types << "\n";
+  //std::cout << "handleMessage " << oscpath << " " << types << "\n";
 
-  if (hook)
+  // the message is copied once into a flat buffer and its hook is
+  // looked up by the scheme thread, so nothing here converts the path
+  // or allocates per argument. see XOscNode for the buffer's layout.
+  if (st->isOscHooked())
     {
       lo_arg **argv=(lo_arg **)data;
-      XOscNode* node=new XOscNode(0.0, path, String(types));
+      int typesstart=XOscNode::align((int)strlen(oscpath)+1);
+      int argsstart=typesstart+XOscNode::align(argc+1);
+      int size=argsstart;
+      for (int i=0; i<argc; i++)
+        {
+          switch (types[i])
+            {
+            case LO_INT32:
+            case LO_INT64:
+            case LO_FLOAT:
+            case LO_DOUBLE:
+            case LO_TIMETAG:
+            case LO_CHAR:
+            case LO_MIDI:
+              size+=8;
+              break;
+            case LO_STRING:
+            case LO_SYMBOL:
+              size+=XOscNode::align((int)strlen(&argv[i]->s)+1);
+              break;
+            case LO_BLOB:
+              size+=8+XOscNode::align(lo_blob_datasize((lo_blob)argv[i]));
+              break;
+            case LO_TRUE:
+            case LO_FALSE:
+            case LO_NIL:
+            case LO_INFINITUM:
+              break;
+            default:
+              {
+                String msg=T("OSC: dropped unparsable message with path ");
+                msg << String(oscpath).quoted() << T("\n");
+                Console::getInstance()->printWarning(msg);
+                return;
+              }
+            }
+        }
+      char* buffer=(char*)XOscNode::buffers.allocate(size);
+      strcpy(buffer, oscpath);
+      memcpy(buffer+typesstart, types, argc);
+      buffer[typesstart+argc]=0;
+      char* arg=buffer+argsstart;
       for (int i=0; i<argc; i++)
         {     
-          char t=types[i];
-          switch (t)
+          switch (types[i])
             {
             case LO_INT32:
-              node->ints.add((s7_Int)argv[i]->i32);
+              *(s7_Int*)arg=(s7_Int)argv[i]->i32;
+              arg+=8;
               break;
             case LO_INT64:
-              node->ints.add((s7_Int)argv[i]->i64);
+              *(s7_Int*)arg=(s7_Int)argv[i]->i64;
+              arg+=8;
               break;
             case LO_FLOAT:
-              node->flos.add((double)argv[i]->f32);
+              *(double*)arg=(double)argv[i]->f32;
+              arg+=8;
               break;
             case LO_DOUBLE:
-              node->flos.add(argv[i]->f64);
+              *(double*)arg=argv[i]->f64;
+              arg+=8;
               break;
             case LO_TIMETAG:
-              {
-                double t=argv[i]->t.sec + (argv[i]->t.frac/4294967295.0);
-                node->flos.add(t);
-              }
-              break;
-            case LO_STRING:
-              node->strs.add(String(&argv[i]->s));
-              break;
-            case LO_SYMBOL:
-              node->strs.add(String(&argv[i]->S));
+              *(double*)arg=argv[i]->t.sec + (argv[i]->t.frac/4294967295.0);
+              arg+=8;
               break;
             case LO_CHAR:
-              node->ints.add(argv[i]->c);
+              *(s7_Int*)arg=(s7_Int)argv[i]->c;
+              arg+=8;
               break;
             case LO_MIDI:
+              memcpy(arg, argv[i]->m, 4);
+              arg+=8;
+              break;
+            case LO_STRING:
+            case LO_SYMBOL:
               {
-                for (int m=0; m<4; m++)
-                  node->ints.add(argv[i]->m[m]);
+                int s=(int)strlen(&argv[i]->s)+1;
+                memcpy(arg, &argv[i]->s, s);
+                arg+=XOscNode::align(s);
               }
               break;
             case LO_BLOB:
               {
                 int s=lo_blob_datasize((lo_blob)argv[i]);
-                char* b=(char*)lo_blob_dataptr((lo_blob)argv[i]);
-                node->ints.add(s); // add size then data
-                for (int j=0; j<s; j++)
-                  node->ints.add(b[j]);
+                *(s7_Int*)arg=(s7_Int)s; // size then data
+                memcpy(arg+8, lo_blob_dataptr((lo_blob)argv[i]), s);
+                arg+=8+XOscNode::align(s);
               }
               break;
-            case LO_TRUE:
-            case LO_FALSE:
-            case LO_NIL:
-            case LO_INFINITUM:
-              break;
             default:
-              {
-                String msg=T("OSC: dropped unparsable message with path ");
-                msg << path.quoted() << T("\n");
-                Console::getInstance()->printWarning(msg);
-                delete node;
-                return;
-              }
+              break;
             }
         }
-      node->hook=hook;
-      st->addNode(node);
+      st->addNode(new XOscNode(0.0, buffer, typesstart, argsstart));
     }
 
   if (traceInput)
-    Console::getInstance()->printOutput(T("OSC: ") + path +  T(" ...\n"));
+    Console::getInstance()->printOutput(T("OSC: ") + String(oscpath) +  T(" ...\n"));
 }
 
 /* ==============================================================================
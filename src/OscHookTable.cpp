@@ -0,0 +1,325 @@
+/*=======================================================================*
+  Copyright (C) 2012 Rick Taube.
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the Lisp Lesser Gnu Public License. The text of
+  this agreement is available at http://www.cliki.net/LLGPL
+ *=======================================================================*/
+
+#include "OscHookTable.h"
+
+OscHookTable::Node::Node(Node* up, const char* elt, int len, bool pat)
+  : element (String::fromUTF8(elt, len)),
+    length (len),
+    pattern (pat),
+    parent (up),
+    hook (NULL),
+    hashnext (NULL)
+{
+}
+
+OscHookTable::OscHookTable()
+  : root (NULL, "", 0, false),
+    numliterals (0),
+    defhook (NULL)
+{
+  buckets.insertMultiple(0, NULL, 64);
+}
+
+OscHookTable::~OscHookTable()
+{
+}
+
+bool OscHookTable::isPattern(const String& path)
+{
+  return path.containsAnyOf(T("*?[]{}"));
+}
+
+bool OscHookTable::isPattern(const char* elt, int len)
+{
+  for (int i=0; i<len; i++)
+    switch (elt[i])
+      {
+      case '*': case '?': case '[': case ']': case '{': case '}':
+        return true;
+      default:
+        break;
+      }
+  return false;
+}
+
+const char* OscHookTable::nextElement(const char*& path, int& len)
+{
+  if (*path=='/')
+    path++;
+  const char* elt=path;
+  while (*path && *path!='/')
+    path++;
+  len=(int)(path-elt);
+  return elt;
+}
+
+int OscHookTable::getBucket(const Node* parent, const char* elt, int len) const
+{
+  // FNV-1a of the element mixed with its parent
+  juce::uint32 h=2166136261u;
+  for (int i=0; i<len; i++)
+    h=(h ^ (juce::uint8)elt[i]) * 16777619u;
+  h=(h ^ (juce::uint32)(pointer_sized_int)parent) * 16777619u;
+  return (int)(h & (juce::uint32)(buckets.size()-1));
+}
+
+OscHookTable::Node* OscHookTable::getChild(Node* node, const char* elt, int len, bool pat) const
+{
+  if (pat)
+    {
+      for (int i=0; i<node->patterns.size(); i++)
+        {
+          Node* n=node->patterns.getUnchecked(i);
+          if (n->length==len && memcmp(n->element.toUTF8(), elt, len)==0)
+            return n;
+        }
+      return NULL;
+    }
+  for (Node* n=buckets.getUnchecked(getBucket(node, elt, len)); n; n=n->hashnext)
+    if (n->parent==node && n->length==len && memcmp(n->element.toUTF8(), elt, len)==0)
+      return n;
+  return NULL;
+}
+
+void OscHookTable::addLiteral(Node* node)
+{
+  if (++numliterals > buckets.size()*2)
+    rehash(buckets.size()*4);
+  int b=getBucket(node->parent, node->element.toUTF8(), node->length);
+  node->hashnext=buckets.getUnchecked(b);
+  buckets.set(b, node);
+}
+
+void OscHookTable::removeLiteral(Node* node)
+{
+  Node** link=&buckets.getReference(getBucket(node->parent, node->element.toUTF8(), node->length));
+  while (*link && *link!=node)
+    link=&(*link)->hashnext;
+  if (*link)
+    *link=node->hashnext;
+  node->hashnext=NULL;
+  numliterals--;
+}
+
+void OscHookTable::rehash(int size)
+{
+  Array<Node*> nodes;
+  for (int i=0; i<buckets.size(); i++)
+    for (Node* n=buckets.getUnchecked(i); n; n=n->hashnext)
+      nodes.add(n);
+  buckets.clear();
+  buckets.insertMultiple(0, NULL, size);
+  for (int i=0; i<nodes.size(); i++)
+    {
+      Node* n=nodes.getUnchecked(i);
+      int b=getBucket(n->parent, n->element.toUTF8(), n->length);
+      n->hashnext=buckets.getUnchecked(b);
+      buckets.set(b, n);
+    }
+}
+
+void OscHookTable::add(OscHook* hook)
+{
+  if (hook->path.isEmpty())
+    {
+      defhook=hook;
+      return;
+    }
+  Node* node=&root;
+  const char* path=hook->path.toUTF8();
+  while (*path)
+    {
+      int len;
+      const char* elt=nextElement(path, len);
+      bool pat=isPattern(elt, len);
+      Node* child=getChild(node, elt, len, pat);
+      if (!child)
+        {
+          child=new Node(node, elt, len, pat);
+          node->children.add(child);
+          if (pat)
+            node->patterns.add(child);
+          else
+            addLiteral(child);
+        }
+      node=child;
+    }
+  node->hook=hook;
+}
+
+void OscHookTable::remove(OscHook* hook)
+{
+  if (hook==defhook)
+    {
+      defhook=NULL;
+      return;
+    }
+  Node* node=&root;
+  const char* path=hook->path.toUTF8();
+  while (*path && node)
+    {
+      int len;
+      const char* elt=nextElement(path, len);
+      node=getChild(node, elt, len, isPattern(elt, len));
+    }
+  if (!node || node->hook!=hook)
+    return;
+  node->hook=NULL;
+  // prune the levels that no longer lead to a hook
+  while (node!=&root && !node->hook && node->children.size()==0)
+    {
+      Node* up=node->parent;
+      if (node->pattern)
+        up->patterns.removeValue(node);
+      else
+        removeLiteral(node);
+      up->children.removeObject(node);
+      node=up;
+    }
+}
+
+OscHook* OscHookTable::find(const char* path) const
+{
+  OscHook* hook=find(&root, path);
+  return (hook) ? hook : defhook;
+}
+
+OscHook* OscHookTable::find(const Node* node, const char* path) const
+{
+  if (!*path)
+    return node->hook;
+  int len;
+  const char* elt=nextElement(path, len);
+  OscHook* hook=NULL;
+  if (isPattern(elt, len))
+    {
+      // an incoming pattern matches the literal elements it describes
+      // and patterns written the same way
+      for (int i=0; i<node->children.size() && !hook; i++)
+        {
+          const Node* n=node->children.getUnchecked(i);
+          if (n->pattern ? (n->length==len && memcmp(n->element.toUTF8(), elt, len)==0)
+              : matchElement(elt, n->element.toUTF8()))
+            hook=find(n, path);
+        }
+      return hook;
+    }
+  const Node* n=getChild((Node*)node, elt, len, false);
+  if (n)
+    hook=find(n, path);
+  for (int i=0; i<node->patterns.size() && !hook; i++)
+    {
+      n=node->patterns.getUnchecked(i);
+      if (matchElement(n->element.toUTF8(), elt))
+        hook=find(n, path);
+    }
+  return hook;
+}
+
+bool OscHookTable::matches(const char* pattern, const char* path)
+{
+  while (true)
+    {
+      if (!matchElement(pattern, path))
+        return false;
+      while (*pattern && *pattern!='/')
+        pattern++;
+      while (*path && *path!='/')
+        path++;
+      if (!*pattern || !*path)
+        return (!*pattern && !*path);
+      pattern++;
+      path++;
+    }
+}
+
+bool OscHookTable::matchElement(const char* pattern, const char* path)
+{
+  while (*pattern && *pattern!='/')
+    {
+      switch (*pattern)
+        {
+        case '?':
+          if (!*path || *path=='/')
+            return false;
+          pattern++;
+          path++;
+          break;
+        case '*':
+          {
+            while (*pattern=='*')
+              pattern++;
+            // try every split up to the end of the element
+            for (const char* p=path; ; p++)
+              {
+                if (matchElement(pattern, p))
+                  return true;
+                if (!*p || *p=='/')
+                  return false;
+              }
+          }
+        case '[':
+          {
+            if (!*path || *path=='/')
+              return false;
+            pattern++;
+            bool negate=(*pattern=='!');
+            if (negate)
+              pattern++;
+            bool found=false;
+            while (*pattern && *pattern!=']' && *pattern!='/')
+              {
+                if (pattern[1]=='-' && pattern[2] && pattern[2]!=']' && pattern[2]!='/')
+                  {
+                    if (*path>=pattern[0] && *path<=pattern[2])
+                      found=true;
+                    pattern+=3;
+                  }
+                else
+                  {
+                    if (*path==*pattern)
+                      found=true;
+                    pattern++;
+                  }
+              }
+            if (*pattern!=']' || found==negate)
+              return false;
+            pattern++;
+            path++;
+          }
+          break;
+        case '{':
+          {
+            const char* end=pattern;
+            while (*end && *end!='}' && *end!='/')
+              end++;
+            if (*end!='}')
+              return false;
+            const char* alt=pattern+1;
+            while (alt<=end)
+              {
+                const char* stop=alt;
+                while (stop<end && *stop!=',')
+                  stop++;
+                int len=(int)(stop-alt);
+                if (strncmp(alt, path, len)==0 && matchElement(end+1, path+len))
+                  return true;
+                alt=stop+1;
+              }
+            return false;
+          }
+        default:
+          if (*pattern!=*path)
+            return false;
+          pattern++;
+          path++;
+          break;
+        }
+    }
+  return (!*path || *path=='/');
+}
@@ -0,0 +1,86 @@
+/*=======================================================================*
+  Copyright (C) 2012 Rick Taube.
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the Lisp Lesser Gnu Public License. The text of
+  this agreement is available at http://www.cliki.net/LLGPL
+ *=======================================================================*/
+
+#ifndef OSCHOOKTABLE_H
+#define OSCHOOKTABLE_H
+
+#include "Libraries.h"
+
+/*=======================================================================*
+                                 Osc Hooks
+ *=======================================================================*/
+
+class OscHook
+{
+ public:
+  String path;
+  s7_pointer proc;
+  OscHook (String oscpath, s7_pointer func) : path (oscpath), proc (func) {}
+  ~OscHook () {}
+};
+
+/** Finds the hook that receives an incoming osc path. Hook paths can
+    be OSC 1.0 address patterns: ? is any character, * any run of
+    characters, [abc] [a-z] [!abc] one character from a set and
+    {foo,bar} one of several strings, none of which match a '/'.
+
+    The paths are compiled into a trie with a level per path element.
+    A level's literal elements are found by hashing and its patterns
+    are tried in the order they were added, so matching depends on the
+    depth of the path and the patterns along it rather than on the
+    number of hooks. At each level literal elements win over patterns
+    and the first path that matches to the end receives the message.
+    An incoming path that is itself a pattern is matched against the
+    literal hook paths. The default hook (the empty path) receives
+    everything else. The table does not own its hooks and is only used
+    by the scheme thread. **/
+
+class OscHookTable
+{
+ public:
+  OscHookTable();
+  ~OscHookTable();
+  void add(OscHook* hook);
+  void remove(OscHook* hook);
+  OscHook* find(const char* path) const;
+  /** True if path contains any of the OSC pattern characters *?[]{}. **/
+  static bool isPattern(const String& path);
+  /** True if the OSC address pattern matches path. **/
+  static bool matches(const char* pattern, const char* path);
+ private:
+  class Node
+  {
+  public:
+    String element;   // this level's path element or pattern
+    int length;
+    bool pattern;
+    Node* parent;
+    OscHook* hook;    // hook whose path ends here
+    Node* hashnext;   // next literal node in its bucket
+    OwnedArray<Node> children;
+    Array<Node*> patterns;  // pattern children in the order added
+    Node(Node* up, const char* elt, int len, bool pat);
+    ~Node() {}
+  };
+  Node root;
+  Array<Node*> buckets;  // literal nodes hashed by parent and element
+  int numliterals;
+  OscHook* defhook;
+  Node* getChild(Node* node, const char* elt, int len, bool pat) const;
+  void addLiteral(Node* node);
+  void removeLiteral(Node* node);
+  void rehash(int size);
+  OscHook* find(const Node* node, const char* path) const;
+  int getBucket(const Node* parent, const char* elt, int len) const;
+  /** Returns the next element in path, which is left at its end. **/
+  static const char* nextElement(const char*& path, int& len);
+  static bool isPattern(const char* elt, int len);
+  /** True if pattern matches path up to their next '/' or end. **/
+  static bool matchElement(const char* pattern, const char* path);
+};
+
+#endif
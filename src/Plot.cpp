@@ -1803,10 +1803,18 @@ void Plotter::pbSetMidiOut(int id)
   {
     std::cout << "Tranport::setMidiOutputPort(" << pbMidiOut << ")\n";
     pbThread->setMidiOutputPort(pbMidiOut);
-    pbThread->sendMicrotuning(pbTuning);
+    pbThread->sendMicrotuning(pbMicroTuning);
   }
 }
 
+void Plotter::pbSetTuning(int divs)
+{
+  ScopedLock mylock (pbLock);
+  pbTuning=divs;
+  pbMicroTuning.setDivisions(divs);
+  pbThread->sendMicrotuning(pbMicroTuning);
+}
+
 void Plotter::pause()
 {
   std::cout << "Plotter::pause()\n";
@@ -1871,6 +1879,7 @@ void Plotter::addMidiPlaybackMessages(MidiPlaybackThread::MidiMessageQueue& queu
 
     double dur=layer->pbDur;
     int chan=layer->pbChan;
+    int c=juce::jlimit(0, 15, chan);
 
     while ((layer->pbIndex < num) && layer->getPointX(layer->pbIndex) <= position.beat)
     {
@@ -1880,16 +1889,16 @@ void Plotter::addMidiPlaybackMessages(MidiPlaybackThread::MidiMessageQueue& queu
         k=juce::jlimit(0, 127, juce::roundToInt(key));
       else
       {
-        k=(int)key;
-        double frac=key-k;
-        // how many channels we have to shift for the resolution
-        int shift=(int)(frac/pbTuning);
-        chan+=shift;
+        // the tuning maps the layer's channel and fractional key to
+        // a tuned channel and key
+        MicroNote note;
+        pbMicroTuning.map(chan, key, note);
+        k=note.key;
+        c=note.chan;
       }
       int a=juce::jlimit(0, 127, juce::roundToInt(amp*127));
-      int c=juce::jlimit(0, 15, chan);
-      queue.addMessage(new juce::MidiMessage((0x90 | c), k, a, position.beat));
-      queue.addMessage(new juce::MidiMessage((0x80 | c), k, 0, position.beat + dur));
+      queue.addMessage(juce::MidiMessage((0x90 | c), k, a, position.beat));
+      queue.addMessage(juce::MidiMessage((0x80 | c), k, 0, position.beat + dur));
       layer->pbIndex++;
     }      
   }
@@ -894,6 +894,7 @@ class Plotter : public Component,
   double pbMinKey;
   double pbMaxKey;
   int pbTuning;
+  MicroTuning pbMicroTuning;
   CriticalSection pbLock;
 
   OwnedArray <Layer> layers;
@@ -1038,6 +1039,10 @@ class Plotter : public Component,
       and cleared in the thread. **/
   void pbSetMidiOut(int id);
 
+  /** Sets the playback tuning to divs divisions per semitone and
+      sends it to the playback thread's device. **/
+  void pbSetTuning(int divs);
+
   /** Called by Transport to stop thread playing. **/
   void pause();
 
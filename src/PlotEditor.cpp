@@ -380,9 +380,7 @@ void PlotAudioEditor::comboBoxChanged (ComboBox* comboBoxThatHasChanged)
   }
   else if (comboBoxThatHasChanged == tuningmenu)
   {
-    ScopedLock mylock (plotter->pbLock);
-    plotter->pbTuning=tuningmenu->getSelectedId();
-    plotter->pbThread->sendMicrotuning(plotter->pbTuning);
+    plotter->pbSetTuning(tuningmenu->getSelectedId());
   }
 }
 
@@ -0,0 +1,310 @@
+/*=======================================================================*
+  Copyright (C) 2012 Rick Taube.
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the Lisp Lesser Gnu Public License. The text of
+  this agreement is available at http://www.cliki.net/LLGPL
+ *=======================================================================*/
+
+#include "SchedulerClock.h"
+
+// the clock's statistics have a single writer so read-modify-write
+// of an atomic is safe without a compare and swap loop.
+
+static void accumulate(Atomic<double>& var, double value)
+{
+  var.set(var.get()+value);
+}
+
+static void maximize(Atomic<double>& var, double value)
+{
+  if (value>var.get())
+    var.set(value);
+}
+
+/*=======================================================================*
+                            Scheduler Histogram
+ *=======================================================================*/
+
+static const double histogramBounds[SchedulerHistogram::NumBuckets-1]=
+  {0.1, 0.25, 0.5, 1.0, 2.0, 5.0, 10.0, 20.0, 50.0, 100.0};
+
+SchedulerHistogram::SchedulerHistogram()
+{
+  reset();
+}
+
+void SchedulerHistogram::add(double ms)
+{
+  int i=0;
+  while (i<NumBuckets-1 && ms>=histogramBounds[i])
+    i++;
+  ++counts[i];
+}
+
+void SchedulerHistogram::reset()
+{
+  for (int i=0; i<NumBuckets; i++)
+    counts[i].set(0);
+}
+
+int SchedulerHistogram::getCount(int bucket) const
+{
+  return counts[bucket].get();
+}
+
+double SchedulerHistogram::getBound(int bucket)
+{
+  return (bucket<NumBuckets-1) ? histogramBounds[bucket] : 0.0;
+}
+
+String SchedulerHistogram::toString() const
+{
+  String str=String::empty;
+  for (int i=0; i<NumBuckets; i++)
+    {
+      int n=getCount(i);
+      if (n==0)
+        continue;
+      if (str.isNotEmpty())
+        str << T(" ");
+      if (i<NumBuckets-1)
+        str << T("<") << String(getBound(i));
+      else
+        str << T(">=") << String(getBound(i-1));
+      str << T(":") << n;
+    }
+  return str;
+}
+
+/*=======================================================================*
+                              Scheduler Clock
+ *=======================================================================*/
+
+SchedulerClock::SchedulerClock(String clockname)
+  : name (clockname)
+{
+  resetStats();
+}
+
+SchedulerClock::~SchedulerClock()
+{
+}
+
+bool SchedulerClock::waitUntil(Thread* thread, double target)
+{
+  double now=Time::getMillisecondCounterHiRes();
+  double delta=target-now;
+  if (delta<=0.0)
+    return true;
+  double spin=getSpinTime();
+  if (delta>spin)
+    {
+      // sleep until the spin window (or deadline if not spinning). if
+      // not spinning round up so we never wake before the deadline.
+      int ms=(spin>0.0) ? (int)(delta-spin) : (int)ceil(delta);
+      if (ms>0)
+        {
+          beginSleep();
+          bool notified=thread->wait(ms);
+          endSleep();
+          ++numwakeups;
+          if (notified)
+            {
+              ++numearly;
+              return false;
+            }
+          now=Time::getMillisecondCounterHiRes();
+        }
+    }
+  // busy-wait the rest of the way
+  while (now<target)
+    {
+      if (thread->threadShouldExit())
+        return false;
+      now=Time::getMillisecondCounterHiRes();
+    }
+  return true;
+}
+
+void SchedulerClock::waitIdle(Thread* thread)
+{
+  beginSleep();
+  thread->wait(-1);
+  endSleep();
+  ++numwakeups;
+}
+
+void SchedulerClock::beginSleep()
+{
+  double now=Time::getMillisecondCounterHiRes();
+  if (sleeping.get()==0)
+    {
+      accumulate(busytime, now-lastchange.get());
+      lastchange.set(now);
+      sleeping.set(1);
+    }
+}
+
+void SchedulerClock::endSleep()
+{
+  double now=Time::getMillisecondCounterHiRes();
+  if (sleeping.get()!=0)
+    {
+      accumulate(sleeptime, now-lastchange.get());
+      lastchange.set(now);
+      sleeping.set(0);
+    }
+}
+
+void SchedulerClock::dispatched(double target, double now)
+{
+  double late=now-target;
+  ++numdispatched;
+  accumulate(latesum, late);
+  accumulate(latesumsq, late*late);
+  maximize(latemax, late);
+  latenessHistogram.add(late);
+}
+
+void SchedulerClock::callbackTime(double ms)
+{
+  ++numcallbacks;
+  accumulate(callbacksum, ms);
+  maximize(callbackmax, ms);
+  callbackHistogram.add(ms);
+}
+
+void SchedulerClock::queueDepth(int num)
+{
+  depth.set(num);
+  if (num>maxdepth.get())
+    maxdepth.set(num);
+}
+
+void SchedulerClock::setSpinTime(double ms)
+{
+  spinmicros.set((ms>0.0) ? (int)(ms*1000.0) : 0);
+}
+
+double SchedulerClock::getSpinTime()
+{
+  return spinmicros.get()/1000.0;
+}
+
+void SchedulerClock::resetStats()
+{
+  numwakeups.set(0);
+  numearly.set(0);
+  numdispatched.set(0);
+  latesum.set(0.0);
+  latesumsq.set(0.0);
+  latemax.set(0.0);
+  numcallbacks.set(0);
+  callbacksum.set(0.0);
+  callbackmax.set(0.0);
+  maxdepth.set(depth.get());
+  latenessHistogram.reset();
+  callbackHistogram.reset();
+  busytime.set(0.0);
+  sleeptime.set(0.0);
+  double now=Time::getMillisecondCounterHiRes();
+  lastchange.set(now);
+  resettime.set(now);
+}
+
+int SchedulerClock::getNumDispatched()
+{
+  return numdispatched.get();
+}
+
+int SchedulerClock::getNumWakeups()
+{
+  return numwakeups.get();
+}
+
+int SchedulerClock::getNumEarlyWakeups()
+{
+  return numearly.get();
+}
+
+double SchedulerClock::getMeanLateness()
+{
+  int num=numdispatched.get();
+  return (num>0) ? (latesum.get()/num) : 0.0;
+}
+
+double SchedulerClock::getMaxLateness()
+{
+  return latemax.get();
+}
+
+double SchedulerClock::getJitter()
+{
+  int num=numdispatched.get();
+  if (num<2)
+    return 0.0;
+  double mean=latesum.get()/num;
+  double var=(latesumsq.get()/num)-(mean*mean);
+  return (var>0.0) ? sqrt(var) : 0.0;
+}
+
+double SchedulerClock::getMeanCallbackTime()
+{
+  int num=numcallbacks.get();
+  return (num>0) ? (callbacksum.get()/num) : 0.0;
+}
+
+double SchedulerClock::getMaxCallbackTime()
+{
+  return callbackmax.get();
+}
+
+int SchedulerClock::getQueueDepth()
+{
+  return depth.get();
+}
+
+int SchedulerClock::getMaxQueueDepth()
+{
+  return maxdepth.get();
+}
+
+double SchedulerClock::getRate()
+{
+  double secs=(Time::getMillisecondCounterHiRes()-resettime.get())/1000.0;
+  return (secs>0.0) ? (numdispatched.get()/secs) : 0.0;
+}
+
+double SchedulerClock::getLoad()
+{
+  double now=Time::getMillisecondCounterHiRes();
+  double busy=busytime.get(), idle=sleeptime.get();
+  // include the interval we are currently in
+  if (sleeping.get()!=0)
+    idle += (now-lastchange.get());
+  else
+    busy += (now-lastchange.get());
+  return ((busy+idle)>0.0) ? (busy*100.0/(busy+idle)) : 0.0;
+}
+
+String SchedulerClock::getStatsString()
+{
+  String str=String::empty;
+  str << name << T(": dispatched=") << getNumDispatched()
+      << T(" rate(/sec)=") << String(getRate(), 1)
+      << T(" wakeups=") << getNumWakeups()
+      << T(" early=") << getNumEarlyWakeups()
+      << T(" lateness(ms) mean=") << String(getMeanLateness(), 3)
+      << T(" max=") << String(getMaxLateness(), 3)
+      << T(" jitter=") << String(getJitter(), 3)
+      << T(" callback(ms) mean=") << String(getMeanCallbackTime(), 3)
+      << T(" max=") << String(getMaxCallbackTime(), 3)
+      << T(" queue=") << getQueueDepth()
+      << T(" max-queue=") << getMaxQueueDepth()
+      << T(" load=") << String(getLoad(), 1) << T("%")
+      << T(" spin(ms)=") << String(getSpinTime(), 3)
+      << T("\n")
+      << name << T(": lateness(ms) ") << latenessHistogram.toString() << T("\n")
+      << name << T(": callback(ms) ") << callbackHistogram.toString() << T("\n");
+  return str;
+}
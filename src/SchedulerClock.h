@@ -0,0 +1,142 @@
+/*=======================================================================*
+  Copyright (C) 2012 Rick Taube.
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the Lisp Lesser Gnu Public License. The text of
+  this agreement is available at http://www.cliki.net/LLGPL
+ *=======================================================================*/
+
+#ifndef SCHEDULERCLOCK_H
+#define SCHEDULERCLOCK_H
+
+#include "Libraries.h"
+
+/*=======================================================================*
+                            Scheduler Histogram
+ *=======================================================================*/
+
+/** Counts times in milliseconds in a fixed set of buckets. Only one
+    thread may add times but any thread can read the counts, nothing
+    is locked. **/
+
+class SchedulerHistogram
+{
+ public:
+
+  enum {NumBuckets=11};
+
+  SchedulerHistogram();
+  ~SchedulerHistogram() {}
+
+  void add(double ms);
+  void reset();
+  int getCount(int bucket) const;
+
+  /** Returns the upper bound of bucket in milliseconds. The last
+      bucket has no upper bound and returns 0. **/
+  static double getBound(int bucket);
+
+  /** Returns the non-empty buckets as "<bound:count ..." **/
+  String toString() const;
+
+ private:
+  Atomic<int> counts[NumBuckets];
+};
+
+/*=======================================================================*
+                              Scheduler Clock
+ *=======================================================================*/
+
+/** Puts a scheduling thread to sleep until its next deadline and keeps
+    timing statistics for the thread. The thread sleeps in
+    Thread::wait() so adding a node and calling notify() wakes it
+    early. If a spin time is set the last part of the wait is spent
+    busy-waiting, which gives sub-millisecond accuracy at the cost of
+    some cpu. All times are in milliseconds on the
+    Time::getMillisecondCounterHiRes() clock. The statistics are only
+    written by the clock's thread and are kept in atomics so they can
+    be read from any thread without a lock, resetting them from
+    another thread may lose a sample or two. **/
+
+class SchedulerClock
+{
+ public:
+
+  SchedulerClock(String clockname);
+  ~SchedulerClock();
+
+  /** The name of the clock's thread, used in stats reports. **/
+  String name;
+
+  /** Sleeps thread until target time or until the thread is notified,
+      whichever comes first. Returns true if target time has been
+      reached, false if the thread was woken early. **/
+  bool waitUntil(Thread* thread, double target);
+
+  /** Sleeps thread until notified. Use when the queue is empty. **/
+  void waitIdle(Thread* thread);
+
+  /** Marks the start and end of a blocking call made outside the
+      clock (e.g. reading the console) so that time is not counted as
+      load. **/
+  void beginSleep();
+  void endSleep();
+
+  /** Records that an event due at target was dispatched at now. **/
+  void dispatched(double target, double now);
+
+  /** Records how long it took to process a dispatched event. **/
+  void callbackTime(double ms);
+
+  /** Records the number of events waiting in the thread's queue. **/
+  void queueDepth(int depth);
+
+  /** Sets the busy-wait time before each deadline, 0 disables. **/
+  void setSpinTime(double ms);
+  double getSpinTime();
+
+  // Statistics
+
+  void resetStats();
+  int getNumDispatched();
+  int getNumWakeups();
+  int getNumEarlyWakeups();
+  /** Mean, maximum and standard deviation of dispatch lateness. **/
+  double getMeanLateness();
+  double getMaxLateness();
+  double getJitter();
+  /** Mean and maximum time spent processing an event. **/
+  double getMeanCallbackTime();
+  double getMaxCallbackTime();
+  /** Current and largest number of events waiting in the queue. **/
+  int getQueueDepth();
+  int getMaxQueueDepth();
+  /** Events dispatched per second since the stats were reset. **/
+  double getRate();
+  /** Percentage of elapsed time the thread was awake (incl. spinning). **/
+  double getLoad();
+  String getStatsString();
+
+  SchedulerHistogram latenessHistogram;
+  SchedulerHistogram callbackHistogram;
+
+ private:
+  Atomic<int> spinmicros;
+  Atomic<int> numwakeups;
+  Atomic<int> numearly;
+  Atomic<int> numdispatched;
+  Atomic<double> latesum;
+  Atomic<double> latesumsq;
+  Atomic<double> latemax;
+  Atomic<int> numcallbacks;
+  Atomic<double> callbacksum;
+  Atomic<double> callbackmax;
+  Atomic<int> depth;
+  Atomic<int> maxdepth;
+  Atomic<double> resettime;
+  Atomic<double> busytime;
+  Atomic<double> sleeptime;
+  Atomic<double> lastchange;
+  Atomic<int> sleeping;
+};
+
+#endif
@@ -32,20 +32,32 @@ juce_ImplementSingleton(SchemeThread)
 // Execution Nodes for Scheme Thread's queue
 //
 
-XSchemeNode::XSchemeNode(double qtime)
-  : time (qtime),
-    userid (-1)
+// slots are big enough for every node class. the pool should cover
+// several thousand sprouted processes plus a burst of input.
+
+NodePool XSchemeNode::pool (T("scheme-nodes"),
+                            jmax(jmax(jmax((int)sizeof(XControlNode), (int)sizeof(XEvalNode)),
+                                      jmax((int)sizeof(XSalNode), (int)sizeof(XProcessNode))),
+                                 jmax(jmax((int)sizeof(XReplaceNode), (int)sizeof(XMidiNode)),
+                                      (int)sizeof(XOscNode))),
+                            8192);
+
+static Atomic<int> nodecounter;
+
+XSchemeNode::XSchemeNode(double qtime, int nodekind)
+  : kind (nodekind),
+    time (qtime),
+    userid (-1),
+    qindex (-1),
+    inboxnext (NULL)
 {
-  static CriticalSection protect;
-  const ScopedLock lock (protect);
-  static int nodecounter=0;
   nodeid=++nodecounter;
 }
 
 // XControlNode
 
 XControlNode::XControlNode(double qtime, int control, int ident)
-: XSchemeNode(qtime),
+: XSchemeNode(qtime, ControlNode),
   type (control)
 {
   userid=ident;
@@ -77,7 +89,7 @@ bool XControlNode::applyNode(SchemeThread* schemethread, double curtime)
 // XEvalNode
 
 XEvalNode::XEvalNode(double qtime, String sexpr)
-  : XSchemeNode(qtime),
+  : XSchemeNode(qtime, EvalNode),
     expr (sexpr)
 {
 }
@@ -117,7 +129,7 @@ bool XEvalNode::applyNode(SchemeThread* schemethread, double curtime)
 }
 
 XSalNode::XSalNode(double qtime, String input, int id, bool xpand, bool mult )
-  : XSchemeNode(qtime),
+  : XSchemeNode(qtime, SalNode),
     expand (xpand),
     multi (mult),
     vers(id),
@@ -193,8 +205,9 @@ bool XSalNode::applyNode(SchemeThread* st, double curtime)
 // XProcessNode
 //*********************************************************************************************************
 XProcessNode::XProcessNode(double qtime, s7_pointer proc, int qid, double startBeat, int metroIndex)
-  : XSchemeNode(qtime),
-    elapsed (0.0), beatState(startBeat), metroIndex(metroIndex)
+  : XSchemeNode(qtime, ProcessNode),
+    elapsed (0.0), beatState(startBeat), metroIndex(metroIndex),
+    idprev (NULL), idnext (NULL), metered (false), score (false), mindex (-1)
 {
   userid = qid;
   time = qtime;
@@ -212,7 +225,7 @@ bool XProcessNode::applyNode(SchemeThread* st, double curtime)
   s7_scheme* sc=st->scheme;
   bool more=false;
   double runtime, delta;
-  if (st->isScoreMode())
+  if (score)
     {
       // in score mode the scheduler runs in non-real time and
       // node times are in seconds. the node's current time
@@ -262,7 +275,7 @@ bool XProcessNode::applyNode(SchemeThread* st, double curtime)
       // values is in milliseconds if scheduler is running in
       // real time
       more=true;
-      if (st->isScoreMode())
+      if (score)
         {
           elapsed += delta;  // elapsed now user's next run time
           time += delta;
@@ -290,7 +303,7 @@ bool XProcessNode::applyNode(SchemeThread* st, double curtime)
 // XReplaceNode
 
 XReplaceNode::XReplaceNode(double qtime, s7_pointer proc, int qid)
-: XSchemeNode(qtime)
+: XSchemeNode(qtime, ReplaceNode)
 {
   userid = qid;
   time = qtime;
@@ -303,24 +316,24 @@ XReplaceNode::~XReplaceNode()
 
 bool XReplaceNode::applyNode(SchemeThread* schemethread, double curtime)
 {
-  XProcessNode* n;
-  bool firstNode = true;
   s7_scheme* sc = schemethread->scheme;
-  
-  for (int i = schemethread->schemeNodes.size() - 1; i >= 0; i--)
-    if (n = dynamic_cast<XProcessNode*>(schemethread->schemeNodes[i]))
-      if (n->userid == userid)
-      {
-        if(firstNode)
-        {
-          s7_gc_unprotect(sc, n->schemeproc);
-          n->schemeproc = schemeproc;
-          s7_gc_protect(sc, n->schemeproc);
-          firstNode = false;
-        }
-        else
-          schemethread->schemeNodes.remove(i, true);
-      }
+  XProcessNode* n = schemethread->schemeNodes.getProcesses(userid);
+
+  // the first process with our id gets the new procedure and the
+  // rest are removed
+  if (n != NULL)
+  {
+    s7_gc_unprotect(sc, n->schemeproc);
+    n->schemeproc = schemeproc;
+    s7_gc_protect(sc, n->schemeproc);
+    n = n->idnext;
+  }
+  while (n != NULL)
+  {
+    XProcessNode* next = n->idnext;
+    schemethread->schemeNodes.remove(n, true);
+    n = next;
+  }
   return false;
 }
 
@@ -338,13 +351,19 @@ void SchemeThread::midiin(const MidiMessage &msg)
       op=MidiFlags::Off;
       msg.getRawData()[0] = (MidiFlags::Off << 4) | (msg.getRawData()[0] & 0xF);
     }
-  MidiHook* hook=getMidiHook(op);
-  if (hook)
+  if (midiBatchMode.get() != MidiBatchOff)
     {
-      //schemeNodes.lockArray();
-      schemeNodes.addSorted(comparator, new XMidiNode(0.0, msg, hook));
-      //schemeNodes.unlockArray();
-      notify();
+      // queue a batch node for the first message since the last batch
+      // was delivered, the rest join it in the ring
+      if (midiBatchRing.push(msg) && midiBatchPending.compareAndSetBool(1, 0))
+        addNode(new XMidiNode(0.0, msg, true));
+      return;
+    }
+  // the node looks its hook up again when it runs, so a hook removed
+  // in the meantime is never called
+  if (getStatusHook(msg.getRawData()[0]))
+    {
+      addNode(new XMidiNode(0.0, msg));
     }
 }
 
@@ -363,6 +382,24 @@ void SchemeThread::addMidiHook(int op, s7_pointer proc)
   else
     midiHooks.insert(0, new MidiHook(op,proc));
   //midiHooks.unlockArray();
+  updateMidiHookTable();
+}
+
+void SchemeThread::updateMidiHookTable()
+{
+  // fill the table midiin isn't using and then swap it in. midiin
+  // only tests its entries so reading the old table is harmless.
+  MidiHookTable* table=(midiHookTable.get()==&midiHookTables[0]) ? &midiHookTables[1] : &midiHookTables[0];
+  MidiHook* defhook=getMidiHook(0, true);
+  for (int op=0x8; op<=0xF; op++)
+    {
+      MidiHook* hook=getMidiHook(op, true);
+      if (!hook)
+        hook=defhook;
+      for (int ch=0; ch<16; ch++)
+        table->hooks[((op-0x8)<<4) | ch]=hook;
+    }
+  midiHookTable.set(table);
 }
 
 MidiHook* SchemeThread::getMidiHook(int opr, bool strict)
@@ -387,6 +424,7 @@ void SchemeThread::removeMidiHook(MidiHook* hook)
   s7_gc_unprotect(scheme, hook->proc);
   midiHooks.removeObject(hook);
   //  midiHooks.unlockArray();
+  updateMidiHookTable();
 }
 
 bool SchemeThread::clearMidiHook(int op)
@@ -395,6 +433,7 @@ bool SchemeThread::clearMidiHook(int op)
   // if op==-1 remove all hooks
   if (op<0) 
     {
+      setMidiBatchHook(schemeFalse, false);
       int s=midiHooks.size();
       for (int i=0;i<s; i++)
         removeMidiHook(midiHooks.getLast());
@@ -414,8 +453,16 @@ bool SchemeThread::clearMidiHook(int op)
 
 bool XMidiNode::applyNode(SchemeThread* st, double curtime)
 {
+  if (batch)
+    {
+      st->applyMidiBatch();
+      return false;
+    }
   s7_scheme* sc=st->scheme;
   // called on Midi message nodes if an input hook is set
+  MidiHook* hook=st->getStatusHook(mmess.getRawData()[0]);
+  if (!hook)
+    return false;
   int op=(mmess.getRawData()[0] & 0xf0)>>4;
   int ch=mmess.getChannel()-1;
   int d1=mmess.getRawData()[1] & 0x7f;
@@ -425,14 +472,17 @@ bool XMidiNode::applyNode(SchemeThread* st, double curtime)
   // convert MidiOns with zero velocity to MidiOff
   if ((op==MidiFlags::On) && (d2==0))
     op=MidiFlags::Off;
-  // create list of message data
+  // create list of message data, ending with the message's arrival
+  // time in milliseconds
   s7_pointer args=s7_cons(sc, 
                           s7_make_integer(sc, ch),
                           s7_cons(sc,
                                   s7_make_integer(sc, d1),
                                   s7_cons(sc,
                                           s7_make_integer(sc, d2),
-                                          st->schemeNil)));
+                                          s7_cons(sc,
+                                                  s7_make_real(sc, mmess.getTimeStamp()*1000.0),
+                                                  st->schemeNil))));
   // ALWAYS PUSH OPCODE // push status opcode if default hook
   if (true) // (hook->op==0)
     args=s7_cons(sc, s7_make_integer(sc, op), args);
@@ -451,24 +501,112 @@ bool XMidiNode::applyNode(SchemeThread* st, double curtime)
   return false;
 }
 
+bool SchemeThread::setMidiBatchHook(s7_pointer proc, bool coalesce)
+{
+  // called by the scheme thread. returns true if a hook was set or
+  // cleared
+  bool had=(midiBatchHook != NULL);
+  midiBatchMode.set(MidiBatchOff);
+  if (midiBatchHook)
+    {
+      s7_gc_unprotect(scheme, midiBatchHook->proc);
+      delete midiBatchHook;
+      midiBatchHook=NULL;
+    }
+  if (proc==NULL || !s7_is_procedure(proc))
+    return had;
+  if (midiBatchRows==NULL)
+    {
+      midiBatchRows=s7_make_vector(scheme, MidiBatchSize*5);
+      midiBatchProt=s7_gc_protect(scheme, midiBatchRows);
+    }
+  s7_gc_protect(scheme, proc);
+  midiBatchHook=new MidiHook(0, proc);
+  midiBatchMode.set((coalesce) ? MidiBatchCoalesce : MidiBatchOn);
+  return true;
+}
+
+void SchemeThread::applyMidiBatch()
+{
+  // clear the pending flag first so a message that arrives while we
+  // drain the ring queues the next batch
+  midiBatchPending.set(0);
+  bool coalesce=(midiBatchMode.get()==MidiBatchCoalesce);
+  juce::uint32 bytes;
+  double time;
+  int num=0;
+  int ctrls[MidiBatchSize]; // controllers coalesced in this batch
+  int numctrls=0;
+  while (num<MidiBatchSize && midiBatchRing.pop(bytes, time))
+    {
+      // messages queued before the hook was cleared are dropped
+      if (midiBatchHook==NULL)
+        continue;
+      int op=(bytes & 0xF0)>>4;
+      int ch=bytes & 0xF;
+      int d1=(bytes>>8) & 0x7F;
+      int d2=(bytes>>16) & 0x7F;
+      int row=num;
+      if (coalesce && (op==MidiFlags::Ctrl))
+        {
+          // a controller already in the batch just gets its new value
+          if (midiBatchCtrls[ch][d1]<0)
+            {
+              midiBatchCtrls[ch][d1]=num++;
+              ctrls[numctrls++]=(ch<<7) | d1;
+            }
+          else
+            row=midiBatchCtrls[ch][d1];
+        }
+      else
+        num++;
+      int i=row*5;
+      s7_vector_set(scheme, midiBatchRows, i, s7_make_integer(scheme, op));
+      s7_vector_set(scheme, midiBatchRows, i+1, s7_make_integer(scheme, ch));
+      s7_vector_set(scheme, midiBatchRows, i+2, s7_make_integer(scheme, d1));
+      s7_vector_set(scheme, midiBatchRows, i+3, s7_make_integer(scheme, d2));
+      s7_vector_set(scheme, midiBatchRows, i+4, s7_make_integer(scheme, (s7_Int)(time*1000.0)));
+    }
+  for (int c=0; c<numctrls; c++)
+    midiBatchCtrls[ctrls[c]>>7][ctrls[c] & 0x7F]=-1;
+  // a full batch leaves messages behind, deliver them next
+  if (!midiBatchRing.isEmpty() && midiBatchPending.compareAndSetBool(1, 0))
+    addNode(new XMidiNode(0.0, MidiMessage(), true));
+  if (num==0)
+    return;
+  s7_pointer args=s7_cons(scheme, midiBatchRows, 
+                          s7_cons(scheme, s7_make_integer(scheme, num), schemeNil));
+  int prot=s7_gc_protect(scheme, args);
+  s7_call(scheme, midiBatchHook->proc, args);
+  s7_gc_unprotect_at(scheme, prot);
+}
+
 /*=======================================================================*
                               Osc Receiving
  *=======================================================================*/
 
-XOscNode::XOscNode(double qtime, String oscpath, String osctypes)
-  : XSchemeNode(qtime),
-    path (oscpath),
-    types (osctypes)
+// osc messages are copied into buffers from this pool. most messages
+// fit a slot, longer ones come from the heap.
+
+NodePool XOscNode::buffers (T("osc-buffers"), 512, 1024);
+
+XOscNode::XOscNode(double qtime, char* buffer, int typesstart, int argsstart)
+  : XSchemeNode(qtime, OscNode),
+    data (buffer),
+    typesoffset (typesstart),
+    argsoffset (argsstart)
 {
 }
 
 XOscNode::~XOscNode()
 {
-  ints.clear();
-  flos.clear();
-  strs.clear();
+  buffers.release(data);
 }
 
+//
+// Osc Hooks
+//
+
 bool SchemeThread::isOscHook(String path)
 {
   return (getOscHook(path,true)!=NULL) ;
@@ -476,38 +614,36 @@ bool SchemeThread::isOscHook(String path)
 
 void SchemeThread::addOscHook(String path, s7_pointer proc)
 {
-  //oscHooks.lockArray();
   s7_gc_protect(scheme, proc);
-  // the "default hook" is always at end
+  OscHook* hook=new OscHook(path,proc);
+  // the "default hook" is listed last
   if (path==String::empty)
-    oscHooks.add(new OscHook(path,proc));
+    oscHooks.add(hook);
   else
-    oscHooks.insert(0, new OscHook(path,proc));
-  //  oscHooks.unlockArray();
+    oscHooks.insert(0, hook);
+  oscHookTable.add(hook);
+  numOscHooks.set(oscHooks.size());
 }
 
 OscHook* SchemeThread::getOscHook(String path, bool strict)
 {
-  OscHook* hook=NULL;
-  //  oscHooks.lockArray();
-  for (int i=0; i<oscHooks.size() && !hook; i++)
+  // strict returns only a hook added under path
+  if (strict)
     {
-      OscHook* h=oscHooks.getUnchecked(i);
-      // hook matches oper if its the same or default hook set
-      if (h->path==path || (h->path==String::empty && !strict))
-        hook=h;
+      for (int i=0; i<oscHooks.size(); i++)
+        if (oscHooks.getUnchecked(i)->path==path)
+          return oscHooks.getUnchecked(i);
+      return NULL;
     }
-  //  oscHooks.unlockArray();
-  return hook;
+  return oscHookTable.find(path.toUTF8());
 }
 
 void SchemeThread::removeOscHook(OscHook* hook)
 {
-  // FIX: THIS MUST ALSO REMOVE ANY PENDING XMIDINODE WITH HOOK
-  //  oscHooks.lockArray();
   s7_gc_unprotect(scheme, hook->proc);
+  oscHookTable.remove(hook);
   oscHooks.removeObject(hook);
-  //  oscHooks.unlockArray();
+  numOscHooks.set(oscHooks.size());
 }
 
 bool SchemeThread::clearOscHook(String path)
@@ -535,113 +671,460 @@ bool SchemeThread::clearOscHook(String path)
 
 bool XOscNode::applyNode(SchemeThread* st, double curtime)
 {
-  //std::cout << "Osc message: "<< path.toUTF8() << " " << types.toUTF8();
-  ////st->lockOscHook();
-  //std::cout << "Osc hook!\n";
+  // hooks are matched here rather than in the osc thread, so a hook
+  // removed after the message arrived is never called
+  OscHook* hook=st->oscHookTable.find(getPath());
+  if (!hook)
+    return false;
   s7_scheme* sc=st->scheme;
-  // the osc message data starts with the string path
+  // the hook receives (path x y ...)
   s7_pointer snil = st->schemeNil;
-  s7_pointer data = s7_cons(sc, st->schemeFalse, snil) ; // (#f) placeholder
+  s7_pointer data = s7_cons(sc, s7_make_string(sc, getPath()), snil);
   s7_pointer tail = data;
-  
-  // iterate types adding floats and ints to message data
-  int F=0;
-  int I=0;
-  int S=0;
-  for (int i=0; i<types.length(); i++)
+  int loc = s7_gc_protect(sc, data);
+  const char* types=getTypes();
+  const char* arg=this->data+argsoffset;
+  for (int i=0; types[i]; i++)
     {
+      s7_pointer value=NULL;
       switch (types[i])
         {
         case 'i':  // LO_INT32
         case 'h':  // LO_INT64
-          s7_set_cdr(tail, s7_cons(sc, s7_make_integer(sc, ints[I++]), snil));
+          value=s7_make_integer(sc, *(s7_Int*)arg);
+          arg+=8;
           break;
         case 'f':  // LO_FLOAT32
         case 'd':  // LO_FLOAT64
         case 't':  // LO_TIMETAG
-          s7_set_cdr(tail, s7_cons(sc, s7_make_real(sc, flos[F++]), snil));
+          value=s7_make_real(sc, *(double*)arg);
+          arg+=8;
           break;
         case 's':  // LO_STRING
-          s7_set_cdr(tail, s7_cons(sc, s7_make_string(sc, strs[S++].toUTF8()), snil));
+          value=s7_make_string(sc, arg);
+          arg+=align((int)strlen(arg)+1);
           break;
         case 'S':  // LO_SYMBOL
-          s7_set_cdr(tail, s7_cons(sc, s7_make_symbol(sc, strs[S++].toUTF8()), snil));
+          value=s7_make_symbol(sc, arg);
+          arg+=align((int)strlen(arg)+1);
           break;
         case 'T':  // LO_TRUE
-          s7_set_cdr(tail, s7_cons(sc, s7_make_boolean(sc, true), snil));
+          value=s7_make_boolean(sc, true);
           break;
         case 'F':  // LO_FALSE
-          s7_set_cdr(tail, s7_cons(sc, s7_make_boolean(sc, false), snil));
+          value=s7_make_boolean(sc, false);
           break;
         case 'N':  // LO_NIL
-          s7_set_cdr(tail, s7_cons(sc, snil, snil));
+          value=snil;
           break;
         case 'I':  // LO_INFINITUM
-          s7_set_cdr(tail, s7_cons(sc, s7_name_to_value(sc, "most-positive-fixnum"), snil));
+          value=s7_name_to_value(sc, "most-positive-fixnum");
           break;
         case 'c':  // LO_CHAR
-          s7_set_cdr(tail, s7_cons(sc, s7_make_character(sc, (char)ints[I++]), snil));
+          value=s7_make_character(sc, (char)*(s7_Int*)arg);
+          arg+=8;
           break;
         case 'm':  // LO_MIDI
           {
-            s7_pointer m=s7_cons(sc, s7_make_integer(sc, ints[I+0]),
-                                 s7_cons(sc, s7_make_integer(sc, ints[I+1]),
-                                         s7_cons(sc, s7_make_integer(sc, ints[I+2]),
-                                                 s7_cons(sc, s7_make_integer(sc, ints[I+3]), snil))));
-            s7_set_cdr(tail, s7_cons(sc, s7_cons(sc, m, snil), snil));
-            I+=4;
+            const juce::uint8* m=(const juce::uint8*)arg;
+            value=s7_cons(sc, s7_make_integer(sc, m[0]),
+                          s7_cons(sc, s7_make_integer(sc, m[1]),
+                                  s7_cons(sc, s7_make_integer(sc, m[2]),
+                                          s7_cons(sc, s7_make_integer(sc, m[3]), snil))));
+            value=s7_cons(sc, value, snil);
+            arg+=8;
           }
           break;
         case 'b':  // LO_BLOB
           {
-            int l=(int)ints[I++]; // length of blob
-            s7_pointer m=snil;
-            for (int j=I+l-1; i>=I; j--)
-              m=s7_cons(sc, s7_make_integer(sc, ints[j]), m);
-            s7_set_cdr(tail, s7_cons(sc, s7_cons(sc, m, snil), snil));
-            I+=l;
+            int l=(int)*(s7_Int*)arg; // length of blob
+            const char* b=arg+8;
+            value=snil;
+            for (int j=l-1; j>=0; j--)
+              value=s7_cons(sc, s7_make_integer(sc, b[j]), value);
+            value=s7_cons(sc, value, snil);
+            arg+=8+align(l);
           }
           break;
         default:
           break;
         }
-      tail=s7_cdr(tail);
+      if (value)
+        {
+          s7_set_cdr(tail, s7_cons(sc, value, snil));
+          tail=s7_cdr(tail);
+        }
     }
-  // data is now (#f x y ...) 
-  int loc;
-  s7_pointer args, res;
-  if (hook->path==String::empty) // is default hook
+  // data is now (path x y ...) 
+  s7_pointer args=s7_cons(sc, data, snil);
+  s7_gc_unprotect_at(sc, loc);
+  loc = s7_gc_protect(sc, args);
+  s7_call(sc, hook->proc, args);
+  s7_gc_unprotect_at(sc, loc);
+  return false;
+}
+
+//
+// Metronome Queue
+//
+
+void XMetroQueue::remove(XProcessNode* node)
+{
+  int index=node->mindex;
+  jassert(index>=0 && index<heap.size() && heap.getUnchecked(index)==node);
+  heap.removeAt(index);
+  node->mindex=-1;
+}
+
+//
+// Scheduler Queue
+//
+
+static bool isMeteredNode(XSchemeNode* node)
+{
+  return (node->kind==XSchemeNode::ProcessNode) && ((XProcessNode*)node)->metered;
+}
+
+XSchemeQueue::XSchemeQueue()
+  : metros (NULL)
+{
+}
+
+XSchemeQueue::~XSchemeQueue()
+{
+  clear();
+}
+
+int XSchemeQueue::size() const
+{
+  return numnodes.get();
+}
+
+XSchemeNode* XSchemeQueue::getFirst() const
+{
+  return heap.getFirst();
+}
+
+void XSchemeQueue::add(XSchemeNode* node)
+{
+  ++numnodes;
+  if (isMeteredNode(node))
+    {
+      // the node only enters the time heap if it is now the first
+      // node on its metronome
+      XProcessNode* p=(XProcessNode*)node;
+      XMetroQueue* mq=getMetroQueue(p->metroIndex);
+      mq->add(p);
+      indexProcess(p);
+      updateMetroHead(mq);
+      return;
+    }
+  insert(node);
+  if (node->kind==XSchemeNode::ProcessNode)
+    indexProcess((XProcessNode*)node);
+}
+
+void XSchemeQueue::addAll(const Array<XSchemeNode*>& nodes)
+{
+  int num=nodes.size();
+  // sifting each node up costs O(k log n), appending everything and
+  // rebuilding costs O(n+k). rebuild if the batch is the bigger part.
+  if (num<size())
+    {
+      for (int i=0; i<num; i++)
+        add(nodes.getUnchecked(i));
+      return;
+    }
+  heap.ensureStorageAllocated(heap.size()+num);
+  for (int i=0; i<num; i++)
+    {
+      XSchemeNode* node=nodes.getUnchecked(i);
+      if (isMeteredNode(node))
+        getMetroQueue(((XProcessNode*)node)->metroIndex)->append((XProcessNode*)node);
+      else
+        heap.append(node);
+      if (node->kind==XSchemeNode::ProcessNode)
+        indexProcess((XProcessNode*)node);
+    }
+  numnodes += num;
+  // reorder each metronome and swap its new first node into the time
+  // heap before the time heap is rebuilt
+  for (int i=0; i<metroqueues.size(); i++)
+    {
+      XMetroQueue* mq=metroqueues.getUnchecked(i);
+      mq->rebuild();
+      XProcessNode* first=mq->getFirst();
+      if (first==mq->head)
+        continue;
+      first->time=getMetroTime(first);
+      if (mq->head != NULL)
+        {
+          heap.setUnchecked(mq->head->qindex, first);
+          mq->head->qindex=-1;
+        }
+      else
+        heap.append(first);
+      mq->head=first;
+    }
+  heap.rebuild();
+}
+
+void XSchemeQueue::addFront(XSchemeNode* node)
+{
+  // real time nodes are in milliseconds and score mode nodes are in
+  // seconds, so a negative time sorts before both. nodes added to the
+  // front still run in the order they were added.
+  jassert(!isMeteredNode(node));
+  node->time=-1.0;
+  add(node);
+}
+
+XSchemeNode* XSchemeQueue::removeFirst()
+{
+  if (heap.size()==0)
+    return NULL;
+  XSchemeNode* node=heap.getUnchecked(0);
+  remove(node, false);
+  return node;
+}
+
+void XSchemeQueue::remove(XSchemeNode* node, bool deleteNode)
+{
+  if (isMeteredNode(node))
     {
-      // default hook includes path as first element
-      // replace placeholder #f with path
-      s7_set_car(data, s7_make_string(sc, path.toUTF8()));
-      args=s7_cons(sc, data, snil);
-      // args now ((x y ...))
-      loc = s7_gc_protect(sc, args);
-      res = s7_call(sc, hook->proc, args);
+      XProcessNode* p=(XProcessNode*)node;
+      XMetroQueue* mq=getMetroQueue(p->metroIndex);
+      mq->remove(p);
+      if (mq->head==p)
+        {
+          // the next node on the metronome takes its place
+          extract(p);
+          mq->head=NULL;
+          updateMetroHead(mq);
+        }
     }
   else
+    extract(node);
+  --numnodes;
+  if (node->kind==XSchemeNode::ProcessNode)
+    unindexProcess((XProcessNode*)node);
+  if (deleteNode)
+    delete node;
+}
+
+void XSchemeQueue::rebuild()
+{
+  heap.rebuild();
+}
+
+void XSchemeQueue::clear()
+{
+  // the first node of each metronome is deleted with the time heap
+  for (int i=0; i<metroqueues.size(); i++)
     {
-      //      // no path so reuse placeholder's cons cell:
-      //      s7_set_car(data, s7_cdr(data)); 
-      //      // data now ((x y ...) x y ...)
-      //      s7_set_cdr(data, snil); 
-      //      // data now ((x y ...))
-      //      loc = s7_gc_protect(sc, data);
-      //      res=s7_call(sc, hook->proc, data);
-      s7_set_car(data, s7_make_string(sc, hook->path.toUTF8()));
-      args=s7_cons(sc, data, snil);
-      loc = s7_gc_protect(sc, args);
-      res = s7_call(sc, hook->proc, args);
+      XMetroQueue* mq=metroqueues.getUnchecked(i);
+      for (int j=mq->size()-1; j>=0; j--)
+        if (mq->getUnchecked(j) != mq->head)
+          delete mq->getUnchecked(j);
     }
-  s7_gc_unprotect_at(sc, loc);
-  // stubbed out because a void return seems to be the same as schemeError ???????
-  if (0) // (res == st->schemeError)
+  metroqueues.clear();
+  for (int i=heap.size()-1; i>=0; i--)
+    delete heap.getUnchecked(i);
+  heap.clear();
+  numnodes.set(0);
+  processes.clear();
+}
+
+void XSchemeQueue::setMetronomes(OwnedArray<Metronome, CriticalSection>* metronomes)
+{
+  metros=metronomes;
+}
+
+void XSchemeQueue::updateMetroTimes()
+{
+  for (int i=0; i<metroqueues.size(); i++)
+    updateMetroHead(metroqueues.getUnchecked(i), true);
+}
+
+void XSchemeQueue::removeMetro(int index)
+{
+  // the metronome's processes are stopped, since their beats mean
+  // nothing on another metronome, and the metronomes after it move
+  // down one index.
+  Array<XProcessNode*> doomed;
+  for (ProcessIndex::iterator it=processes.begin(); it!=processes.end(); it++)
+    for (XProcessNode* node=it->second; node != NULL; node=node->idnext)
+      if (node->metroIndex==index)
+        doomed.add(node);
+      else if (node->metroIndex>index)
+        node->metroIndex--;
+  for (int i=0; i<doomed.size(); i++)
+    remove(doomed.getUnchecked(i), true);
+  if (index<metroqueues.size())
+    metroqueues.remove(index);
+}
+
+XProcessNode* XSchemeQueue::getProcesses(int userid) const
+{
+  ProcessIndex::const_iterator it=processes.find(userid);
+  return (it==processes.end()) ? NULL : it->second;
+}
+
+void XSchemeQueue::removeProcesses(int userid)
+{
+  XProcessNode* node=getProcesses(userid);
+  while (node != NULL)
     {
-      st->removeOscHook(hook);
-      Console::getInstance()->printError(T(">>> Removed OSC receiver.\n"));
+      XProcessNode* next=node->idnext;
+      remove(node, true);
+      node=next;
     }
-  return false;
+}
+
+void XSchemeQueue::removeAllProcesses()
+{
+  // removing most of the queue one node at a time would be O(k log
+  // n), so empty the metronome queues, compact the heap in place and
+  // reorder it once. the first node of each metronome is deleted
+  // with the time heap.
+  for (int i=0; i<metroqueues.size(); i++)
+    {
+      XMetroQueue* mq=metroqueues.getUnchecked(i);
+      for (int j=mq->size()-1; j>=0; j--)
+        if (mq->getUnchecked(j) != mq->head)
+          delete mq->getUnchecked(j);
+      mq->clear();
+    }
+  int size=0;
+  for (int i=0; i<heap.size(); i++)
+    {
+      XSchemeNode* node=heap.getUnchecked(i);
+      if (node->kind==XSchemeNode::ProcessNode)
+        delete node;
+      else
+        heap.setUnchecked(size++, node);
+    }
+  heap.removeLast(heap.size()-size);
+  numnodes.set(size);
+  processes.clear();
+  heap.rebuild();
+}
+
+XMetroQueue* XSchemeQueue::getMetroQueue(int index)
+{
+  while (metroqueues.size()<=index)
+    metroqueues.add(new XMetroQueue());
+  return metroqueues.getUnchecked(index);
+}
+
+void XSchemeQueue::updateMetroHead(XMetroQueue* mq, bool retime)
+{
+  // make the metronome's first node its node in the time heap. nodes
+  // behind the first may have stale times so a node is always retimed
+  // when it moves to the front.
+  XProcessNode* first=mq->getFirst();
+  if (first==mq->head)
+    {
+      if (first != NULL && retime)
+        {
+          first->time=getMetroTime(first);
+          heap.update(first->qindex);
+        }
+      return;
+    }
+  if (mq->head != NULL)
+    extract(mq->head);
+  mq->head=first;
+  if (first != NULL)
+    {
+      first->time=getMetroTime(first);
+      insert(first);
+    }
+}
+
+double XSchemeQueue::getMetroTime(XProcessNode* node)
+{
+  jassert(metros != NULL);
+  return metros->getUnchecked(node->metroIndex)->getTimeAtBeat(node->beatState) * 1000.0;
+}
+
+void XSchemeQueue::insert(XSchemeNode* node)
+{
+  heap.add(node);
+}
+
+void XSchemeQueue::extract(XSchemeNode* node)
+{
+  int index=node->qindex;
+  jassert(index>=0 && index<heap.size() && heap.getUnchecked(index)==node);
+  heap.removeAt(index);
+  node->qindex=-1;
+}
+
+void XSchemeQueue::indexProcess(XProcessNode* node)
+{
+  // push node on the front of its userid's list
+  XProcessNode*& head=processes[node->userid];
+  node->idprev=NULL;
+  node->idnext=head;
+  if (head != NULL)
+    head->idprev=node;
+  head=node;
+}
+
+void XSchemeQueue::unindexProcess(XProcessNode* node)
+{
+  if (node->idprev != NULL)
+    node->idprev->idnext=node->idnext;
+  else if (node->idnext != NULL)
+    processes[node->userid]=node->idnext;
+  else
+    processes.erase(node->userid);
+  if (node->idnext != NULL)
+    node->idnext->idprev=node->idprev;
+  node->idprev=NULL;
+  node->idnext=NULL;
+}
+
+//
+// Scheduler Inbox
+//
+
+XSchemeInbox::~XSchemeInbox()
+{
+  XSchemeNode* node=popAll();
+  while (node != NULL)
+    {
+      XSchemeNode* next=node->inboxnext;
+      delete node;
+      node=next;
+    }
+}
+
+void XSchemeInbox::push(XSchemeNode* node)
+{
+  XSchemeNode* top;
+  do
+    {
+      top=head.get();
+      node->inboxnext=top;
+    }
+  while (!head.compareAndSetBool(node, top));
+}
+
+XSchemeNode* XSchemeInbox::popAll()
+{
+  // nodes are stacked newest first so reverse them
+  XSchemeNode* node=head.exchange(NULL);
+  XSchemeNode* list=NULL;
+  while (node != NULL)
+    {
+      XSchemeNode* next=node->inboxnext;
+      node->inboxnext=list;
+      list=node;
+      node=next;
+    }
+  return list;
 }
 
 //
@@ -666,8 +1149,17 @@ SchemeThread::SchemeThread()
     schemeNil (NULL),
     schemeError (NULL),
     schemeVoid (NULL),
-    scheme (NULL)
-{
+    scheme (NULL),
+    midiBatchRing (4096),
+    midiBatchHook (NULL),
+    midiBatchRows (NULL),
+    midiBatchProt (0),
+    clock (T("scheme"))
+{
+  midiHookTable.set(&midiHookTables[0]);
+  for (int c=0; c<16; c++)
+    for (int n=0; n<128; n++)
+      midiBatchCtrls[c][n]=-1;
 #ifdef GRACE
   showvoid=Preferences::getInstance()->
     getBoolProp(T("SchemeShowVoidValues"), true);
@@ -677,6 +1169,7 @@ SchemeThread::SchemeThread()
   Metronome* m = new Metronome();
   m->identifier = 0;
   metros.add(m);
+  schemeNodes.setMetronomes(&metros);
 }
 
 SchemeThread::~SchemeThread()
@@ -684,6 +1177,8 @@ SchemeThread::~SchemeThread()
   stopThread(100);
   schemeNodes.clear();
   midiHooks.clear();
+  updateMidiHookTable();
+  numOscHooks.set(0);
   oscHooks.clear();
   metros.clear();
 }
@@ -859,7 +1354,7 @@ void SchemeThread::run()
     {
       while ( true ) 
 	{
-          //	  schemeNodes.lockArray();
+          drainInbox();
 	  node=schemeNodes.getFirst();
           //	  schemeNodes.unlockArray();
 	  if ( node == NULL )
@@ -870,20 +1365,23 @@ void SchemeThread::run()
 	  // milliseconds.
 	  qtime=node->time;
 	  utime = Time::getMillisecondCounterHiRes();
-	  // this should probably test if the difference between qtime
-	  // and utime is less that 1ms, if not then it probably
-	  // shouldn't sleep (?)
 	  if ( qtime > utime )
 	    {
 	      // if scoremode is true then qtime will be in seconds
-	      // so this will not happen (which is what we want)
-	      wait(1);
+	      // so this will not happen (which is what we want). sleep
+	      // until the node is due, adding a node wakes us early.
+	      clock.waitUntil(this, qtime);
 	    }
 	  else
 	    {
               //	      schemeNodes.lockArray();
-	      schemeNodes.remove(0, false);
+	      node=schemeNodes.removeFirst();
               //	      schemeNodes.unlockArray();
+              // only real time process nodes have a meaningful
+              // lateness, input and eval nodes are queued at time 0
+              if (!isScoreMode() && node->time>0.0)
+                clock.dispatched(node->time, utime);
+              clock.queueDepth(schemeNodes.size());
 	      // NOTE: the node to process has now been popped from the
 	      // queue.  i did this while trying to debug the random
 	      // crashing. im not sure if this is the right thing to do or
@@ -891,12 +1389,19 @@ void SchemeThread::run()
 	      // no effect on this node. Search for the word POP to see the
 	      // places this affects...
 	      //lock.enter();
+              // time the scheme callbacks but not evals, which can
+              // take as long as the user likes
+              bool timed=(node->kind==XSchemeNode::ProcessNode ||
+                          node->kind==XSchemeNode::MidiNode ||
+                          node->kind==XSchemeNode::OscNode);
 	      bool keep=node->applyNode(this, 0.0);
+              if (timed)
+                clock.callbackTime(Time::getMillisecondCounterHiRes()-utime);
 	      //lock.exit();
 	      if (keep)
 		{
                   //		  schemeNodes.lockArray();
-		  schemeNodes.addSorted(comparator,node);
+		  schemeNodes.add(node);
 		  //          schemeNodes.remove(0, false);
                   //		  schemeNodes.unlockArray();
 		}
@@ -904,6 +1409,10 @@ void SchemeThread::run()
 		{
 		  delete node;
 		}
+              // a sprout that opened a score renders it straight
+              // through instead of going round this loop
+              if (sprouted && isScoreMode())
+                renderScore();
 	    }
 	  node=NULL;
 	}
@@ -914,14 +1423,67 @@ void SchemeThread::run()
       scoretime=0.0;
       //      setScoreMode(ScoreTypes::Empty); only done in closeScore
 #ifdef GRACE
-      wait(-1);
+      clock.waitIdle(this);
 #else
+      clock.beginSleep();
       read();
+      clock.endSleep();
 #endif
     }
   // leaving killed process....
 }
 
+void SchemeThread::renderScore()
+{
+  // only the processes sprouted into the score and nodes at the front
+  // of the queue (stops and replaces) run here. everything else,
+  // including real time processes that were already running, waits
+  // until the score is closed.
+  Array<XSchemeNode*> deferred;
+  int events=0;
+  double scoreend=0.0;
+  double start=Time::getMillisecondCounterHiRes();
+  while (!threadShouldExit())
+    {
+      // only look at the inbox if something has been posted, a stop
+      // from the console goes to the front of the queue.
+      if (!inbox.isEmpty())
+        drainInbox();
+      XSchemeNode* node=schemeNodes.removeFirst();
+      if (node == NULL)
+        break;
+      if (node->kind==XSchemeNode::ProcessNode && ((XProcessNode*)node)->score)
+        {
+          // score mode node times are in seconds
+          scoreend=node->time;
+          events++;
+        }
+      else if (node->kind==XSchemeNode::ProcessNode || node->time>=0.0)
+        {
+          deferred.add(node);
+          continue;
+        }
+      if (node->applyNode(this, 0.0))
+        schemeNodes.add(node);
+      else
+        delete node;
+    }
+  double elapsed=(Time::getMillisecondCounterHiRes()-start)/1000.0;
+  closeScore();
+  sprouted=false;
+  scoretime=0.0;
+  for (int i=0; i<deferred.size(); i++)
+    schemeNodes.add(deferred.getUnchecked(i));
+  if (!isQuiet())
+    {
+      String text=String::empty;
+      text << T("Rendered ") << String(scoreend, 3) << T(" seconds of score in ")
+           << String(elapsed, 3) << T(" seconds, ") << events << T(" events (")
+           << ((elapsed>0.0) ? (int)(events/elapsed) : events) << T(" events/sec)\n");
+      Console::getInstance()->printOutput(text);
+    }
+}
+
 void SchemeThread::closeScore()
 {
   if (!isScoreMode()) return;
@@ -945,19 +1507,47 @@ void SchemeThread::closeScore()
 
 void SchemeThread::clear()
 {
-  // this should NEVER be called from scheme code (an EVAL node) or
-  // else the run() loop will bomb since it assumes index[0] exists
-  //  schemeNodes.lockArray();
+  // the queue belongs to the scheduler so this must only be called
+  // on the scheduler thread.
   schemeNodes.clear();
-  //  schemeNodes.unlockArray();
+  XSchemeNode* node=inbox.popAll();
+  while (node != NULL)
+    {
+      XSchemeNode* next=node->inboxnext;
+      delete node;
+      node=next;
+    }
+}
+
+void SchemeThread::addNode(XSchemeNode* node, bool front)
+{
+  if (Thread::getCurrentThreadId() == getThreadId())
+    {
+      if (front)
+        schemeNodes.addFront(node);
+      else
+        schemeNodes.add(node);
+    }
+  else
+    {
+      if (front)
+        node->time=-1.0; // same as XSchemeQueue::addFront()
+      inbox.push(node);
+      notify();
+    }
 }
 
-void SchemeThread::addNode(XSchemeNode* node)
+void SchemeThread::drainInbox()
 {
-  //  schemeNodes.lockArray();
-  schemeNodes.addSorted(comparator, node);
-  //  schemeNodes.unlockArray();
-  notify();
+  // move nodes posted by other threads into the queue
+  XSchemeNode* node=inbox.popAll();
+  while (node != NULL)
+    {
+      XSchemeNode* next=node->inboxnext;
+      node->inboxnext=NULL;
+      schemeNodes.add(node);
+      node=next;
+    }
 }
 
 // addNode for processes
@@ -986,33 +1576,81 @@ void SchemeThread::sprout(double _time, s7_pointer proc, int _id, int metroId, d
   
   s7_gc_protect(scheme, proc); // don't let gc touch it
   
-  XProcessNode* n;
   bool duplicateID = false;
   
   if(!(_id == 0)) //if there is NOT a default id, check for duplicate id's
-  {
-    for (int i = schemeNodes.size() - 1; i >= 0; i--)
-      if (n = dynamic_cast<XProcessNode*>(schemeNodes[i]))
-        if (n->userid == _id)
-        {
-          duplicateID = true;
-          break;
-        }
-  }
+    duplicateID = (schemeNodes.getProcesses(_id) != NULL);
   
   if(duplicateID)
   {
-    schemeNodes.insert(0, new XReplaceNode(0.0, proc, _id));
-    notify();
+    addNode(new XReplaceNode(0.0, proc, _id), true);
   }
   else
   {
     sprouted=true;  // tell scheduler that we have a process running
-    //  schemeNodes.lockArray();
-    schemeNodes.addSorted(comparator, new XProcessNode( _time, proc, _id, startBeat, metroIndex));
-    //  schemeNodes.unlockArray();
-    notify();
+    XProcessNode* node = new XProcessNode( _time, proc, _id, startBeat, metroIndex);
+    node->metered = !isScoreMode(); // real time processes are queued by beat
+    node->score = isScoreMode();
+    addNode(node);
+  }
+}
+
+void SchemeThread::sprout(const Array<s7_pointer>& procs, const Array<double>& times,
+                          const Array<int>& ids, int metroId, double startBeat)
+{
+  // batch version of sprout(): the metronome is looked up once and the
+  // new processes go into the queue in a single operation.
+  int metroIndex = getMetroIndexFromId(metroId);
+  Metronome* metro = metros[metroIndex];
+  bool score = isScoreMode();
+  double nowBeat = 0.0, beatTime = 0.0;
+  if (!score)
+  {
+    if (startBeat > 0)
+      beatTime = metro->getTimeAtBeat(startBeat) * 1000;
+    else
+      nowBeat = metro->getNowBeat();
   }
+  Array<XSchemeNode*> nodes;
+  nodes.ensureStorageAllocated(procs.size());
+  std::set<int> batchids; // ids sprouted by this batch
+  for (int i = 0; i < procs.size(); i++)
+  {
+    s7_pointer proc = procs.getUnchecked(i);
+    double time = times.getUnchecked(i);
+    double beat = startBeat;
+    int id = ids.getUnchecked(i);
+    if (score)
+      time += scoretime;
+    else if (startBeat > 0)
+      time = beatTime;
+    else
+    {
+      beat = nowBeat + time;
+      time = metro->getTimeAtBeat(beat) * 1000;
+    }
+    s7_gc_protect(scheme, proc); // don't let gc touch it
+    // a duplicate id replaces the running process just like sprout()
+    if (id != 0 && (schemeNodes.getProcesses(id) != NULL || batchids.count(id) > 0))
+      addNode(new XReplaceNode(0.0, proc, id), true);
+    else
+    {
+      if (id != 0)
+        batchids.insert(id);
+      XProcessNode* node = new XProcessNode(time, proc, id, beat, metroIndex);
+      node->metered = !score;
+      node->score = score;
+      nodes.add(node);
+    }
+  }
+  if (nodes.size() == 0)
+    return;
+  sprouted = true;  // tell scheduler that we have a process running
+  if (Thread::getCurrentThreadId() == getThreadId())
+    schemeNodes.addAll(nodes);
+  else
+    for (int i = 0; i < nodes.size(); i++)
+      addNode(nodes.getUnchecked(i));
 }
 
 void SchemeThread::eval(char* str)
@@ -1022,18 +1660,12 @@ void SchemeThread::eval(char* str)
 
 void SchemeThread::eval(String s)
 {
-  //  schemeNodes.lockArray();
-  schemeNodes.addSorted(comparator, new XEvalNode(0.0, s));
-  //  schemeNodes.unlockArray();
-  notify();
+  addNode(new XEvalNode(0.0, s));
 }
 
 void SchemeThread::quit()
 {
-  //  schemeNodes.lockArray();
-  schemeNodes.addSorted(comparator, new XControlNode(0.0, XControlNode::QueueQuit));
-  //  schemeNodes.unlockArray();
-  notify();
+  addNode(new XControlNode(0.0, XControlNode::QueueQuit));
 }
 
 void SchemeThread::setPaused(bool p) {}
@@ -1041,38 +1673,24 @@ void SchemeThread::setPaused(bool p) {}
 void SchemeThread::stop(int ident, bool all)
 {
   // always add stop nodes to the front of the queue.
-  //  schemeNodes.lockArray();
   if(all)
-    schemeNodes.insert(0, new XControlNode (0.0, XControlNode::QueueStopAll, ident));
+    addNode(new XControlNode (0.0, XControlNode::QueueStopAll, ident), true);
   else
-    schemeNodes.insert(0, new XControlNode (0.0, XControlNode::QueueStop, ident));
-  //  schemeNodes.unlockArray();
-  notify();
+    addNode(new XControlNode (0.0, XControlNode::QueueStop, ident), true);
 }
 
 void SchemeThread::stopProcesses(int ident)
 {
   // this is called by a STOP node from process().  stop all processes
-  // with id from running. iterate queue in reverse order so removal index
-  // remains valid.  NOTE: POP removed the (STOP) node that got us here so this
-  // deletes up to and including index 0. otherwise dont include index 0
+  // with id from running. the queue indexes its processes by id so
+  // this only visits the matching nodes.
 
-  //  schemeNodes.lockArray();
-
-      // else selectively remove all nodes with id process queue in
-      // reverse order so removal index always valid
-  for (int i=schemeNodes.size()-1; i>=0; i--)
-    if (XProcessNode* n = dynamic_cast<XProcessNode*>(schemeNodes[i]))
-      if (n->userid == ident) 
-        schemeNodes.remove(i, true);
-  //  schemeNodes.unlockArray();
+  schemeNodes.removeProcesses(ident);
 }
 
 void SchemeThread::stopAll()
 {
-  for (int i=schemeNodes.size()-1; i>=0; i--)
-    if (dynamic_cast<XProcessNode*>(schemeNodes[i]) != NULL)
-      schemeNodes.remove(i,true); 
+  schemeNodes.removeAllProcesses();
   // if stopped all processes also clear any pending messages and send
   // all notes off
   // GET RID OF THIS!
@@ -1081,29 +1699,23 @@ void SchemeThread::stopAll()
 
 bool SchemeThread::isQueueEmpty()
 {
-  //  schemeNodes.lockArray();
-  int size=schemeNodes.size();
-  //  schemeNodes.unlockArray();
-  return (size == 0);
+  // called by other threads so don't touch the queue itself
+  return schemeNodes.isEmpty() && inbox.isEmpty();
 }
 
 void SchemeThread::interruptScheme()
 {
-  schemeNodes.clear(); // remove any running nodes from scheduler
+  clear(); // remove any running nodes from scheduler
   clearMidiHook(-1);
   clearOscHook(juce::String("*"));
 }
 
 void SchemeThread::updateNodeTimes()
 {
-  for(int i=schemeNodes.size()-1; i>=0; i--)
-  {
-    if(XProcessNode* n = dynamic_cast<XProcessNode*>(schemeNodes[i]))
-    {
-      n->time = metros[n->metroIndex]->getTimeAtBeat(n->beatState) * 1000.0;
-    }
-  }
-  schemeNodes.sort(comparator);
+  // processes are queued by beat on their metronome, and a tempo change
+  // doesn't change the order of beats, so only the next process on
+  // each metronome needs a new time.
+  schemeNodes.updateMetroTimes();
 }
 
 /*=======================================================================*
@@ -1136,6 +1748,7 @@ void SchemeThread::deleteMetro(int id)
   int index=getMetroIndexFromId(id);
   if (index>0)
   {
+    schemeNodes.removeMetro(index);
     metros.remove(index);
   }
 }
@@ -12,6 +12,11 @@
 
 #include "Syntax.h"
 #include "Metronome.h"
+#include "SchedulerClock.h"
+#include "NodePool.h"
+#include "BinaryHeap.h"
+#include "OscHookTable.h"
+#include "MidiCapture.h"
 
 class SchemeThread;
 
@@ -19,15 +24,6 @@ class SchemeThread;
                                 Input Hook Classes
  *=======================================================================*/
 
-class OscHook
-{
- public:
-  String path;
-  s7_pointer proc;
-  OscHook (String oscpath, s7_pointer func) : path (oscpath), proc (func) {}
-  ~OscHook () {}
-};
-
 class MidiHook
 {
  public:
@@ -37,6 +33,22 @@ class MidiHook
   ~MidiHook () {}
 };
 
+/** The midi hook that receives each status byte, ie each opcode and
+    channel, or NULL. Opcodes without their own hook hold the default
+    hook. **/
+
+class MidiHookTable
+{
+ public:
+  MidiHook* hooks[128]; // status bytes 0x80 to 0xFF
+  MidiHookTable () {for (int i=0; i<128; i++) hooks[i]=NULL;}
+  ~MidiHookTable () {}
+  MidiHook* getHook(int status) const
+  {
+    return (status & 0x80) ? hooks[status & 0x7F] : NULL;
+  }
+};
+
 /*=======================================================================*
                            Scheme Execution Node Classes
  *=======================================================================*/
@@ -44,12 +56,23 @@ class MidiHook
 class XSchemeNode 
 {
  public:
+  /** Node kinds, so the scheduler can test a node's class without
+      RTTI. **/
+  enum {ControlNode=1, EvalNode, SalNode, ProcessNode, ReplaceNode,
+        MidiNode, OscNode};
+  int kind;
   double time;
   int nodeid;
   int userid;  // user's id
-  XSchemeNode(double qtime);
+  int qindex;  // position in scheduler queue or -1
+  XSchemeNode* inboxnext; // link while waiting in the scheduler's inbox
+  XSchemeNode(double qtime, int nodekind);
   virtual ~XSchemeNode(){}
   virtual bool applyNode(SchemeThread* scheme, double curtime)=0;
+  // all node classes are allocated from a preallocated pool
+  static NodePool pool;
+  static void* operator new(size_t size) {return pool.allocate(size);}
+  static void operator delete(void* ptr) {pool.release(ptr);}
 };
 
 class XControlNode : public XSchemeNode
@@ -96,6 +119,15 @@ class XProcessNode : public XSchemeNode
   //****************************************metro use*******************//
   int metroIndex;
   double beatState;
+  // links to the other queued processes with the same userid
+  XProcessNode* idprev;
+  XProcessNode* idnext;
+  // true if the node is queued by beat on its metronome (real time)
+  bool metered;
+  // true if the node was sprouted into an open score, its times are
+  // then score seconds
+  bool score;
+  int mindex;  // position in its metronome's queue or -1
   XProcessNode(double qtime, s7_pointer proc, int qid, double startBeat, int metroIndex = 0);
   //****************************************metro use****************//
   ~XProcessNode();
@@ -115,25 +147,34 @@ class XMidiNode : public XSchemeNode
 {
 public:
   const MidiMessage mmess;
-  MidiHook* hook;
-  XMidiNode(double qtime, const MidiMessage &mess, MidiHook* huk)
-    : XSchemeNode (qtime), mmess (mess), hook (huk) {}
+  bool batch; // delivers the batched messages rather than mmess
+  XMidiNode(double qtime, const MidiMessage &mess, bool isbatch=false)
+    : XSchemeNode (qtime, MidiNode), mmess (mess), batch (isbatch) {}
   ~XMidiNode(){}
   bool applyNode(SchemeThread* scheme, double curtime);
 };
 
+/** An incoming osc message, copied once into a single buffer taken
+    from the buffers pool. The buffer holds the message's path and
+    type tags followed by its arguments, each 8 byte aligned: numbers
+    as an s7_Int or double, strings null terminated, midi as 4 bytes
+    and blobs as an s7_Int length and their bytes. The arguments are
+    only decoded when a hook receives the message. **/
+
 class XOscNode : public XSchemeNode
 {
  public:
-  String path;
-  String types;
-  OscHook* hook;
-  Array<s7_Int> ints;
-  Array<double> flos;
-  StringArray strs;
-  XOscNode(double qtime, String oscpath, String osctypes) ;
+  char* data;
+  int typesoffset;
+  int argsoffset;
+  XOscNode(double qtime, char* buffer, int typesstart, int argsstart) ;
   ~XOscNode() ;
+  const char* getPath() const {return data;}
+  const char* getTypes() const {return data+typesoffset;}
   bool applyNode(SchemeThread* scheme, double curtime) ;
+  static NodePool buffers;
+  /** Rounds size up to the buffer's 8 byte alignment. **/
+  static int align(int size) {return (size+7) & ~7;}
 };
 
 class XSchemeNodeComparator
@@ -153,6 +194,197 @@ class XSchemeNodeComparator
   }
 };
 
+/** Orders the processes on a metronome by beat, then nodeid. **/
+
+class XMetroNodeComparator
+{
+ public:
+  static int compareElements(XProcessNode* e1, XProcessNode* e2)
+  {
+    if (e1->beatState < e2->beatState)
+      return -1;
+    else if (e2->beatState < e1->beatState)
+      return 1;
+    // else both on same beat, return node that was added first
+    else if (e1->nodeid<e2->nodeid)
+      return -1;
+    else
+      return 1;
+  }
+};
+
+/** Keeps a node's qindex at its position in the scheduler queue. **/
+
+class XSchemeQueueIndex
+{
+ public:
+  static void setIndex(XSchemeNode* node, int index) {node->qindex=index;}
+};
+
+/** Keeps a node's mindex at its position in its metronome's
+    queue. **/
+
+class XMetroQueueIndex
+{
+ public:
+  static void setIndex(XProcessNode* node, int index) {node->mindex=index;}
+};
+
+/*=======================================================================*
+                              Scheduler Queue
+ *=======================================================================*/
+
+/** The real time processes running on one metronome, kept in a
+    binary heap ordered by beat (then nodeid). A tempo change never
+    changes the order of a metronome's beats so the heap never needs
+    reordering, only its first node has to be given a new time. **/
+
+class XMetroQueue
+{
+ public:
+  XMetroQueue() : head (NULL) {}
+  ~XMetroQueue() {}
+
+  /** The node standing for this metronome in the scheduler queue's
+      time heap or NULL. **/
+  XProcessNode* head;
+
+  int size() const {return heap.size();}
+  XProcessNode* getUnchecked(int index) const {return heap.getUnchecked(index);}
+  XProcessNode* getFirst() const {return heap.getFirst();}
+
+  /** Adds node at its beat. **/
+  void add(XProcessNode* node) {heap.add(node);}
+
+  /** Adds node without ordering it, call rebuild() afterwards. **/
+  void append(XProcessNode* node) {heap.append(node);}
+
+  void remove(XProcessNode* node);
+  void rebuild() {heap.rebuild();}
+  void clear() {heap.clear(); head=NULL;}
+
+ private:
+  BinaryHeap<XProcessNode*, XMetroNodeComparator, XMetroQueueIndex> heap;
+};
+
+/** A binary heap of scheduler nodes ordered by XSchemeNodeComparator
+    (time, then nodeid so nodes at the same time run in the order they
+    were added). Insertion and removal of the first node are O(log n)
+    and each node records its heap position so it can be removed from
+    the middle of the queue in O(log n) as well. Real time process
+    nodes are held by beat in an XMetroQueue for their metronome and
+    only the first node of each metronome is in the time heap, so a
+    tempo change retimes one node per metronome instead of resorting
+    the queue. Queued process nodes are also indexed by userid so they
+    can be found without scanning the queue. The queue owns its nodes
+    and is private to the scheduler thread: other threads post nodes
+    through the scheduler's XSchemeInbox so the queue itself needs no
+    lock. **/
+
+class XSchemeQueue
+{
+ public:
+  XSchemeQueue();
+  ~XSchemeQueue();
+
+  /** Returns the number of nodes in the queue. **/
+  int size() const;
+
+  /** Returns true if the queue is empty. Safe to call from any
+      thread. **/
+  bool isEmpty() const {return numnodes.get()==0;}
+
+  /** Returns the earliest node or NULL if the queue is empty. **/
+  XSchemeNode* getFirst() const;
+
+  /** Adds a node to the queue at its time. **/
+  void add(XSchemeNode* node);
+
+  /** Adds nodes to the queue. A large batch is appended and the heap
+      rebuilt once, which is O(n) instead of O(k log n). **/
+  void addAll(const Array<XSchemeNode*>& nodes);
+
+  /** Adds a node ahead of every timed node in the queue. **/
+  void addFront(XSchemeNode* node);
+
+  /** Removes and returns the earliest node, the caller then owns
+      it. **/
+  XSchemeNode* removeFirst();
+
+  /** Removes node from the queue and optionally deletes it. **/
+  void remove(XSchemeNode* node, bool deleteNode=true);
+
+  /** Reorders the queue after node times have been changed in
+      place. **/
+  void rebuild();
+
+  /** Sets the metronomes used to time the first process on each
+      metronome. **/
+  void setMetronomes(OwnedArray<Metronome, CriticalSection>* metronomes);
+
+  /** Gives the first process on each metronome its new time after a
+      tempo change. **/
+  void updateMetroTimes();
+
+  /** Removes and deletes the processes running on the metronome at
+      index and renumbers the processes on the metronomes after it. Call
+      this before the metronome itself is removed. **/
+  void removeMetro(int index);
+
+  /** Removes and deletes every node in the queue. **/
+  void clear();
+
+  /** Returns the first queued process node with userid or NULL. The
+      rest are linked through the node's idnext. **/
+  XProcessNode* getProcesses(int userid) const;
+
+  /** Removes and deletes every process node with userid. **/
+  void removeProcesses(int userid);
+
+  /** Removes and deletes every process node in the queue. **/
+  void removeAllProcesses();
+
+ private:
+  BinaryHeap<XSchemeNode*, XSchemeNodeComparator, XSchemeQueueIndex> heap;
+  Atomic<int> numnodes;
+  typedef std::map <int, XProcessNode*> ProcessIndex;
+  ProcessIndex processes;
+  OwnedArray<XMetroQueue> metroqueues;
+  OwnedArray<Metronome, CriticalSection>* metros;
+  XMetroQueue* getMetroQueue(int index);
+  void updateMetroHead(XMetroQueue* mq, bool retime=false);
+  double getMetroTime(XProcessNode* node);
+  void insert(XSchemeNode* node);
+  void extract(XSchemeNode* node);
+  void indexProcess(XProcessNode* node);
+  void unindexProcess(XProcessNode* node);
+};
+
+/** A lock-free list of nodes posted to the scheduler by other threads
+    (midi and osc input, the gui, the console). Any number of threads
+    can push nodes, only the scheduler thread removes them, which it
+    does all at once before it looks at its queue. Since the scheduler
+    never removes single nodes the list cannot suffer from ABA. **/
+
+class XSchemeInbox
+{
+ public:
+  XSchemeInbox() {}
+  ~XSchemeInbox();
+
+  /** Adds node to the inbox. Never blocks. **/
+  void push(XSchemeNode* node);
+
+  /** Empties the inbox and returns its nodes linked through inboxnext
+      in the order they were pushed. **/
+  XSchemeNode* popAll();
+
+  bool isEmpty() const {return head.get()==NULL;}
+
+ private:
+  Atomic<XSchemeNode*> head;
+};
+
 /*=======================================================================*
                               Scheme Thread Singleton
  *=======================================================================*/
@@ -207,17 +439,44 @@ class SchemeThread : public Thread
     interrupted=flag;
   }
 
-  // Midi Receiving
-  OwnedArray<MidiHook, CriticalSection> midiHooks;
+  // Midi Receiving. The hooks are only changed by the scheme
+  // thread, which then rebuilds the table that isn't being read and
+  // swaps it in, so midiin() finds a message's hook without a lock.
+  OwnedArray<MidiHook> midiHooks;
+  MidiHookTable midiHookTables[2];
+  Atomic<MidiHookTable*> midiHookTable;
+  void updateMidiHookTable();
   void midiin(const MidiMessage &mess);
   bool isMidiHook(int opr);
   MidiHook* getMidiHook(int opr, bool strict=false);
+  MidiHook* getStatusHook(int status) {return midiHookTable.get()->getHook(status);}
   void removeMidiHook(MidiHook* hook);
   bool clearMidiHook(int opr);
   void addMidiHook(int opr, s7_pointer proc);
 
-  // Midi Receiving
-  OwnedArray<OscHook, CriticalSection> oscHooks;
+  // Batched Midi Receiving. When a batch hook is set it receives
+  // every message instead of the hooks above: midiin() adds messages
+  // to midiBatchRing and queues one batch node, which hands all the
+  // messages that arrived since it was queued to the hook in a
+  // single call, as rows of a vector that is reused for every batch.
+  enum {MidiBatchSize=1024}; // rows per call
+  enum {MidiBatchOff=0, MidiBatchOn, MidiBatchCoalesce};
+  Atomic<int> midiBatchMode;
+  Atomic<int> midiBatchPending; // 1 while a batch node is queued
+  MidiInRing midiBatchRing;
+  MidiHook* midiBatchHook;
+  s7_pointer midiBatchRows;
+  int midiBatchProt;
+  int midiBatchCtrls[16][128];  // row of each controller in the batch or -1
+  bool setMidiBatchHook(s7_pointer proc, bool coalesce);
+  void applyMidiBatch();
+
+  // Osc Receiving. Hooks are only changed and looked up by the scheme
+  // thread, the osc thread just checks that there are some.
+  OwnedArray<OscHook> oscHooks;
+  OscHookTable oscHookTable;
+  Atomic<int> numOscHooks;
+  bool isOscHooked() {return numOscHooks.get()>0;}
   bool isOscHook(String path=String::empty);
   OscHook* getOscHook(String path, bool strict=false);
   void removeOscHook(OscHook* hook);
@@ -230,6 +489,13 @@ class SchemeThread : public Thread
   bool isScoreMode();
   bool isScoreMode(int mode);
   void closeScore();
+
+  /** Runs the score that was just sprouted to completion as fast as
+      possible and then closes it. Only process nodes and nodes added
+      to the front of the queue (stops and replacements) are run while
+      rendering, any other node (evals, input, quit) waits until the
+      score is closed. **/
+  void renderScore();
   
   bool saleval;
   bool isSalEval();
@@ -238,8 +504,16 @@ class SchemeThread : public Thread
   double scoretime;
   double getScoreTime();
     
-  OwnedArray<XSchemeNode, CriticalSection> schemeNodes;
-  XSchemeNodeComparator comparator;  
+  XSchemeQueue schemeNodes;
+
+  /** Nodes posted by other threads, moved to schemeNodes by the
+      scheduler. **/
+  XSchemeInbox inbox;
+  void drainInbox();
+
+  /** Sleeps the scheduler until its next node is due and keeps the
+      scheduler's timing statistics. **/
+  SchedulerClock clock;
 
   // These next methods are defined in the scheme implementation files
   // (SndLib.cpp and Chicken.cpp)
@@ -250,6 +524,11 @@ class SchemeThread : public Thread
   String getLispVersion();
 
   void sprout(double _time, s7_pointer c=0, int _id=0, int metroId = 0, double startBeat = 0);
+
+  /** Sprouts many processes in one scheduler operation. procs, times
+      and ids must be the same length. **/
+  void sprout(const Array<s7_pointer>& procs, const Array<double>& times,
+              const Array<int>& ids, int metroId = 0, double startBeat = 0);
   void eval(String str);
   void eval(char* str);
   void load(File file, bool addtorecent=false);
@@ -258,7 +537,11 @@ class SchemeThread : public Thread
   void read();
   void run();
   void clear();
-  void addNode(XSchemeNode* node);
+  /** Adds node to the scheduler. On the scheduler thread the node goes
+      straight into the queue, other threads post it to the inbox and
+      wake the scheduler. If front is true the node is run before any
+      timed node. **/
+  void addNode(XSchemeNode* node, bool front=false);
   bool isPaused() { return pausing; }
   void setPaused(bool b);
   void stop(int id = 0, bool all = false);
@@ -305,8 +588,8 @@ class SchemeThread : public Thread
   bool syncMetros(int metroId, double beatsAhead, int masterMetroId, double tempo,
     bool isbeats, int mode);
 
-  /** Iterates through the schemeNodes array and checks the process nodes' 
-      scheduled time against its current metronome settings.  This must
+  /** Checks the scheduled time of the next process node on each
+      metronome against its current metronome settings.  This must
       be called when a metronome's tempo is changed so that events scheduled
       before the tempo change will still occur at the correct time.**/
   void updateNodeTimes();
@@ -3824,125 +3824,212 @@ static const unsigned char temp8[] = {59,59,59,32,42,42,42,42,42,42,42,42,42,42,
   110,41,10,9,32,32,32,40,108,105,115,116,32,40,109,112,58,111,112,101,110,45,111,117,116,112,117,116,32,111,117,116,41,10,9,9,32,40,109,112,
   58,111,112,101,110,45,105,110,112,117,116,32,105,110,41,41,41,10,9,32,32,40,111,117,116,10,9,32,32,32,40,109,112,58,111,112,101,110,45,111,
   117,116,112,117,116,32,111,117,116,41,41,10,9,32,32,40,105,110,10,9,32,32,32,40,109,112,58,111,112,101,110,45,105,110,112,117,116,32,105,110,
-  41,41,41,41,41,10,10,40,100,101,102,105,110,101,32,40,109,112,58,111,112,101,110,45,111,117,116,112,117,116,32,46,32,100,101,118,41,10,32,32,
-  40,105,102,32,40,97,110,100,32,40,112,97,105,114,63,32,100,101,118,41,10,9,32,32,32,40,110,117,108,108,63,32,40,99,100,114,32,100,101,118,
-  41,41,10,9,32,32,32,40,105,110,116,101,103,101,114,63,32,40,99,97,114,32,100,101,118,41,41,10,9,32,32,32,40,62,61,32,40,99,97,114,
-  32,100,101,118,41,32,48,41,10,9,32,32,32,40,102,102,105,95,109,112,95,111,112,101,110,95,111,117,116,112,117,116,32,40,99,97,114,32,100,101,
-  118,41,41,41,10,32,32,32,32,32,32,40,99,97,114,32,100,101,118,41,10,32,32,32,32,32,32,40,101,114,114,111,114,32,34,126,83,32,105,115,
-  32,110,111,116,32,97,32,109,105,100,105,32,100,101,118,105,99,101,32,110,117,109,98,101,114,34,32,100,101,118,41,41,41,10,10,40,100,101,102,105,
-  110,101,32,40,109,112,58,111,112,101,110,45,105,110,112,117,116,32,46,32,100,101,118,41,10,32,32,40,105,102,32,40,97,110,100,32,40,112,97,105,
-  114,63,32,100,101,118,41,10,9,32,32,32,40,110,117,108,108,63,32,40,99,100,114,32,100,101,118,41,41,10,9,32,32,32,40,105,110,116,101,103,
-  101,114,63,32,40,99,97,114,32,100,101,118,41,41,10,9,32,32,32,40,62,61,32,40,99,97,114,32,100,101,118,41,32,48,41,10,9,32,32,32,
-  40,102,102,105,95,109,112,95,111,112,101,110,95,105,110,112,117,116,32,40,99,97,114,32,100,101,118,41,41,41,10,32,32,32,32,32,32,40,99,97,
-  114,32,100,101,118,41,10,32,32,32,32,32,32,40,101,114,114,111,114,32,34,126,83,32,105,115,32,110,111,116,32,97,32,109,105,100,105,32,100,101,
-  118,105,99,101,32,110,117,109,98,101,114,34,32,100,101,118,41,41,41,10,10,40,100,101,102,105,110,101,32,40,109,112,58,99,108,111,115,101,45,111,
-  117,116,112,117,116,32,46,32,100,101,118,41,10,32,32,40,105,102,32,40,97,110,100,32,40,112,97,105,114,63,32,100,101,118,41,10,9,32,32,32,
+  41,41,41,41,41,10,10,59,59,32,109,112,58,111,112,101,110,45,111,117,116,112,117,116,32,111,112,101,110,115,32,97,32,109,105,100,105,32,111,117,
+  116,112,117,116,32,100,101,118,105,99,101,32,111,110,32,97,110,32,111,117,116,112,117,116,32,112,111,114,116,44,32,112,111,114,116,10,59,59,32,48,
+  32,40,116,104,101,32,100,101,102,97,117,108,116,41,32,105,115,32,116,104,101,32,109,97,105,110,32,111,117,116,112,117,116,46,32,101,97,99,104,32,
+  112,111,114,116,32,104,97,115,32,105,116,115,32,111,119,110,32,111,117,116,112,117,116,10,59,59,32,116,104,114,101,97,100,32,115,111,32,97,32,115,
+  108,111,119,32,100,101,118,105,99,101,32,100,111,101,115,110,39,116,32,104,111,108,100,32,117,112,32,116,104,101,32,111,116,104,101,114,115,46,10,10,
+  40,100,101,102,105,110,101,32,40,109,112,58,111,112,101,110,45,111,117,116,112,117,116,32,46,32,100,101,118,41,10,32,32,40,105,102,32,40,97,110,
+  100,32,40,112,97,105,114,63,32,100,101,118,41,10,9,32,32,32,40,105,110,116,101,103,101,114,63,32,40,99,97,114,32,100,101,118,41,41,10,9,
+  32,32,32,40,62,61,32,40,99,97,114,32,100,101,118,41,32,48,41,10,9,32,32,32,40,111,114,32,40,110,117,108,108,63,32,40,99,100,114,32,
+  100,101,118,41,41,10,9,32,32,32,32,32,32,32,40,97,110,100,32,40,110,117,108,108,63,32,40,99,100,100,114,32,100,101,118,41,41,10,9,9,
+  32,32,32,32,40,105,110,116,101,103,101,114,63,32,40,99,97,100,114,32,100,101,118,41,41,41,41,10,9,32,32,32,40,102,102,105,95,109,112,95,
+  111,112,101,110,95,111,117,116,112,117,116,32,40,99,97,114,32,100,101,118,41,32,40,105,102,32,40,110,117,108,108,63,32,40,99,100,114,32,100,101,
+  118,41,41,32,48,32,40,99,97,100,114,32,100,101,118,41,41,41,41,10,32,32,32,32,32,32,40,99,97,114,32,100,101,118,41,10,32,32,32,32,
+  32,32,40,101,114,114,111,114,32,34,126,83,32,105,115,32,110,111,116,32,97,32,109,105,100,105,32,100,101,118,105,99,101,32,110,117,109,98,101,114,
+  32,97,110,100,32,112,111,114,116,34,32,100,101,118,41,41,41,10,10,40,100,101,102,105,110,101,32,40,109,112,58,111,112,101,110,45,105,110,112,117,
+  116,32,46,32,100,101,118,41,10,32,32,40,105,102,32,40,97,110,100,32,40,112,97,105,114,63,32,100,101,118,41,10,9,32,32,32,40,110,117,108,
+  108,63,32,40,99,100,114,32,100,101,118,41,41,10,9,32,32,32,40,105,110,116,101,103,101,114,63,32,40,99,97,114,32,100,101,118,41,41,10,9,
+  32,32,32,40,62,61,32,40,99,97,114,32,100,101,118,41,32,48,41,10,9,32,32,32,40,102,102,105,95,109,112,95,111,112,101,110,95,105,110,112,
+  117,116,32,40,99,97,114,32,100,101,118,41,41,41,10,32,32,32,32,32,32,40,99,97,114,32,100,101,118,41,10,32,32,32,32,32,32,40,101,114,
+  114,111,114,32,34,126,83,32,105,115,32,110,111,116,32,97,32,109,105,100,105,32,100,101,118,105,99,101,32,110,117,109,98,101,114,34,32,100,101,118,
+  41,41,41,10,10,40,100,101,102,105,110,101,32,40,109,112,58,99,108,111,115,101,45,111,117,116,112,117,116,32,46,32,100,101,118,41,10,32,32,40,
+  105,102,32,40,97,110,100,32,40,112,97,105,114,63,32,100,101,118,41,10,9,32,32,32,40,110,117,108,108,63,32,40,99,100,114,32,100,101,118,41,
+  41,10,9,32,32,32,40,105,110,116,101,103,101,114,63,32,40,99,97,114,32,100,101,118,41,41,32,10,9,32,32,32,40,62,61,32,40,99,97,114,
+  32,100,101,118,41,32,48,41,41,10,32,32,32,32,32,32,40,102,102,105,95,109,112,95,99,108,111,115,101,95,111,117,116,112,117,116,32,40,99,97,
+  114,32,100,101,118,41,41,10,32,32,32,32,32,32,40,101,114,114,111,114,32,34,126,83,32,105,115,32,110,111,116,32,97,32,109,105,100,105,32,100,
+  101,118,105,99,101,32,110,117,109,98,101,114,34,32,100,101,118,41,41,41,10,10,40,100,101,102,105,110,101,32,40,109,112,58,99,108,111,115,101,45,
+  105,110,112,117,116,32,46,32,100,101,118,41,10,32,32,40,105,102,32,40,97,110,100,32,40,112,97,105,114,63,32,100,101,118,41,10,9,32,32,32,
   40,110,117,108,108,63,32,40,99,100,114,32,100,101,118,41,41,10,9,32,32,32,40,105,110,116,101,103,101,114,63,32,40,99,97,114,32,100,101,118,
   41,41,32,10,9,32,32,32,40,62,61,32,40,99,97,114,32,100,101,118,41,32,48,41,41,10,32,32,32,32,32,32,40,102,102,105,95,109,112,95,
-  99,108,111,115,101,95,111,117,116,112,117,116,32,40,99,97,114,32,100,101,118,41,41,10,32,32,32,32,32,32,40,101,114,114,111,114,32,34,126,83,
-  32,105,115,32,110,111,116,32,97,32,109,105,100,105,32,100,101,118,105,99,101,32,110,117,109,98,101,114,34,32,100,101,118,41,41,41,10,10,40,100,
-  101,102,105,110,101,32,40,109,112,58,99,108,111,115,101,45,105,110,112,117,116,32,46,32,100,101,118,41,10,32,32,40,105,102,32,40,97,110,100,32,
-  40,112,97,105,114,63,32,100,101,118,41,10,9,32,32,32,40,110,117,108,108,63,32,40,99,100,114,32,100,101,118,41,41,10,9,32,32,32,40,105,
-  110,116,101,103,101,114,63,32,40,99,97,114,32,100,101,118,41,41,32,10,9,32,32,32,40,62,61,32,40,99,97,114,32,100,101,118,41,32,48,41,
-  41,10,32,32,32,32,32,32,40,102,102,105,95,109,112,95,99,108,111,115,101,95,105,110,112,117,116,32,40,99,97,114,32,100,101,118,41,41,10,32,
-  32,32,32,32,32,40,101,114,114,111,114,32,34,126,83,32,105,115,32,110,111,116,32,97,32,109,105,100,105,32,100,101,118,105,99,101,32,110,117,109,
-  98,101,114,34,32,100,101,118,41,41,41,10,10,40,100,101,102,105,110,101,32,40,109,112,58,111,112,101,110,45,115,99,111,114,101,32,112,97,116,104,
-  32,46,32,97,114,103,115,41,10,32,32,40,102,102,105,95,109,112,95,111,112,101,110,95,115,99,111,114,101,32,112,97,116,104,32,97,114,103,115,41,
-  10,32,32,41,10,10,40,100,101,102,105,110,101,32,40,109,112,58,99,108,111,115,101,45,115,99,111,114,101,32,41,10,32,32,40,102,102,105,95,109,
-  112,95,99,108,111,115,101,95,115,99,111,114,101,32,41,10,32,32,41,10,10,40,100,101,102,105,110,101,45,109,97,99,114,111,32,40,119,105,116,104,
-  45,109,105,100,105,32,97,114,103,115,32,46,32,98,111,100,121,41,10,32,32,40,105,102,32,40,110,111,116,32,40,112,97,105,114,63,32,97,114,103,
-  115,41,41,10,32,32,32,32,32,32,40,101,114,114,111,114,32,34,119,105,116,104,45,109,105,100,105,58,32,97,114,103,117,109,101,110,116,115,32,110,
-  111,116,32,97,32,108,105,115,116,58,32,126,83,34,32,97,114,103,115,41,41,10,32,32,96,40,100,121,110,97,109,105,99,45,119,105,110,100,32,10,
-  32,32,32,32,32,32,32,40,108,97,109,98,100,97,32,40,41,32,10,32,32,32,32,32,32,32,32,32,40,109,112,58,111,112,101,110,45,115,99,111,
-  114,101,32,44,40,99,97,114,32,97,114,103,115,41,32,44,64,40,99,100,114,32,97,114,103,115,41,41,10,32,32,32,32,32,32,32,32,32,40,102,
-  102,105,95,115,99,104,101,100,95,115,101,116,95,115,99,111,114,101,95,109,111,100,101,32,42,115,99,111,114,101,45,116,121,112,101,45,109,105,100,105,
-  42,41,41,10,32,32,32,32,32,32,32,40,108,97,109,98,100,97,32,40,41,32,44,64,98,111,100,121,32,40,118,111,105,100,41,41,10,32,32,32,
-  32,32,32,32,40,108,97,109,98,100,97,32,40,41,10,32,32,32,32,32,32,32,32,32,40,102,102,105,95,115,99,104,101,100,95,115,101,116,95,115,
-  99,111,114,101,95,109,111,100,101,32,48,41,10,32,32,32,32,32,32,32,32,32,40,109,112,58,99,108,111,115,101,45,115,99,111,114,101,41,41,41,
-  41,10,10,40,100,101,102,105,110,101,42,32,40,109,112,58,109,105,100,105,32,116,105,109,101,32,100,117,114,32,107,101,121,32,97,109,112,32,99,104,
-  97,110,41,10,32,32,40,102,102,105,95,109,112,95,115,101,110,100,95,110,111,116,101,32,116,105,109,101,32,100,117,114,32,107,101,121,32,97,109,112,
-  32,99,104,97,110,41,41,10,10,59,40,100,101,102,105,110,101,32,40,109,112,58,109,105,100,105,32,46,32,97,114,103,115,41,10,59,32,32,40,119,
-  105,116,104,45,111,112,116,107,101,121,115,32,40,97,114,103,115,32,40,116,105,109,101,32,48,41,32,40,100,117,114,32,46,53,41,32,40,107,101,121,
-  32,54,48,41,32,40,97,109,112,32,46,53,41,32,40,99,104,97,110,32,48,41,41,10,59,32,32,32,32,40,102,102,105,95,109,112,95,115,101,110,
-  100,95,110,111,116,101,32,116,105,109,101,32,100,117,114,32,107,101,121,32,97,109,112,32,99,104,97,110,41,41,41,10,10,40,100,101,102,105,110,101,
-  32,40,109,112,58,111,102,102,32,46,32,97,114,103,115,41,10,32,32,40,119,105,116,104,45,111,112,116,107,101,121,115,32,40,97,114,103,115,32,40,
-  116,105,109,101,32,48,41,32,40,107,101,121,32,54,48,41,32,40,99,104,97,110,32,48,41,41,10,32,32,32,32,40,102,102,105,95,109,112,95,115,
-  101,110,100,95,100,97,116,97,32,109,109,58,111,102,102,32,116,105,109,101,32,99,104,97,110,32,107,101,121,32,48,41,41,41,10,10,40,100,101,102,
-  105,110,101,32,40,109,112,58,111,110,32,46,32,97,114,103,115,41,10,32,32,40,119,105,116,104,45,111,112,116,107,101,121,115,32,40,97,114,103,115,
-  32,40,116,105,109,101,32,48,41,32,40,107,101,121,32,54,48,41,32,40,118,101,108,32,54,52,41,32,40,99,104,97,110,32,48,41,41,10,32,32,
-  32,32,40,102,102,105,95,109,112,95,115,101,110,100,95,100,97,116,97,32,109,109,58,111,110,32,116,105,109,101,32,99,104,97,110,32,107,101,121,32,
-  118,101,108,41,41,41,10,10,40,100,101,102,105,110,101,32,40,109,112,58,116,111,117,99,104,32,46,32,97,114,103,115,41,10,32,32,40,119,105,116,
-  104,45,111,112,116,107,101,121,115,32,40,97,114,103,115,32,40,116,105,109,101,32,48,41,32,40,107,101,121,32,48,41,32,40,118,97,108,32,48,41,
-  32,40,99,104,97,110,32,48,41,41,10,32,32,32,32,40,102,102,105,95,109,112,95,115,101,110,100,95,100,97,116,97,32,109,109,58,116,111,117,99,
-  104,32,116,105,109,101,32,99,104,97,110,32,107,101,121,32,118,97,108,41,41,41,10,10,40,100,101,102,105,110,101,32,40,109,112,58,99,116,114,108,
-  32,46,32,97,114,103,115,41,10,32,32,40,119,105,116,104,45,111,112,116,107,101,121,115,32,40,97,114,103,115,32,40,116,105,109,101,32,48,41,32,
-  40,110,117,109,32,48,41,32,40,118,97,108,32,48,41,32,40,99,104,97,110,32,48,41,41,10,32,32,32,32,40,102,102,105,95,109,112,95,115,101,
-  110,100,95,100,97,116,97,32,109,109,58,99,116,114,108,32,116,105,109,101,32,99,104,97,110,32,110,117,109,32,118,97,108,41,41,41,10,10,40,100,
-  101,102,105,110,101,32,40,109,112,58,112,114,111,103,32,46,32,97,114,103,115,41,10,32,32,40,119,105,116,104,45,111,112,116,107,101,121,115,32,40,
-  97,114,103,115,32,40,116,105,109,101,32,48,41,32,40,118,97,108,32,48,41,32,40,99,104,97,110,32,48,41,41,10,32,32,32,32,40,102,102,105,
-  95,109,112,95,115,101,110,100,95,100,97,116,97,32,109,109,58,112,114,111,103,32,116,105,109,101,32,99,104,97,110,32,118,97,108,32,48,41,41,41,
-  10,10,40,100,101,102,105,110,101,32,40,109,112,58,112,114,101,115,115,32,46,32,97,114,103,115,41,10,32,32,40,119,105,116,104,45,111,112,116,107,
-  101,121,115,32,40,97,114,103,115,32,40,116,105,109,101,32,48,41,32,40,118,97,108,32,48,41,32,40,99,104,97,110,32,48,41,41,10,32,32,32,
-  32,40,102,102,105,95,109,112,95,115,101,110,100,95,100,97,116,97,32,109,109,58,112,114,101,115,115,32,116,105,109,101,32,99,104,97,110,32,118,97,
-  108,32,48,41,41,41,10,10,40,100,101,102,105,110,101,32,40,109,112,58,98,101,110,100,32,46,32,97,114,103,115,41,10,32,32,40,119,105,116,104,
-  45,111,112,116,107,101,121,115,32,40,97,114,103,115,32,40,116,105,109,101,32,48,41,32,40,118,97,108,32,56,49,57,50,41,32,40,99,104,97,110,
-  32,48,41,41,10,32,32,32,32,40,102,102,105,95,109,112,95,115,101,110,100,95,100,97,116,97,32,109,109,58,98,101,110,100,32,116,105,109,101,32,
-  99,104,97,110,32,118,97,108,32,48,41,41,41,10,10,40,100,101,102,105,110,101,32,40,109,112,58,116,117,110,105,110,103,32,46,32,97,114,103,115,
-  41,10,32,32,40,108,101,116,32,40,40,97,114,103,32,40,105,102,32,40,110,117,108,108,63,32,97,114,103,115,41,32,49,32,40,99,97,114,32,97,
-  114,103,115,41,41,41,41,10,32,32,32,32,40,105,102,32,40,97,110,100,32,40,105,110,116,101,103,101,114,63,32,97,114,103,41,10,9,32,32,32,
-  32,32,40,60,32,48,32,97,114,103,32,49,55,41,41,10,9,40,102,102,105,95,109,112,95,115,101,116,95,116,117,110,105,110,103,32,97,114,103,41,
-  10,9,40,101,114,114,111,114,32,34,126,83,32,105,115,32,110,111,116,32,97,32,116,117,110,105,110,103,32,100,105,118,105,115,105,111,110,32,49,32,
-  116,111,32,49,54,34,32,97,114,103,41,41,41,41,10,10,40,100,101,102,105,110,101,32,40,109,112,58,105,110,115,116,114,117,109,101,110,116,115,32,
-  46,32,97,114,103,115,41,10,32,32,40,102,102,105,95,109,112,95,115,101,116,95,105,110,115,116,114,117,109,101,110,116,115,32,97,114,103,115,41,41,
-  10,10,40,100,101,102,105,110,101,32,40,109,112,58,112,108,97,121,115,101,113,41,10,32,32,40,102,102,105,95,109,112,95,112,108,97,121,95,115,101,
-  113,41,41,10,10,40,100,101,102,105,110,101,32,40,109,112,58,115,97,118,101,115,101,113,41,10,32,32,40,102,102,105,95,109,112,95,115,97,118,101,
-  95,115,101,113,41,41,10,10,40,100,101,102,105,110,101,32,40,109,112,58,99,111,112,121,115,101,113,41,10,32,32,40,102,102,105,95,109,112,95,99,
-  111,112,121,95,115,101,113,41,41,10,10,40,100,101,102,105,110,101,32,40,109,112,58,112,108,111,116,115,101,113,41,10,32,32,40,102,102,105,95,109,
-  112,95,112,108,111,116,95,115,101,113,41,41,10,10,40,100,101,102,105,110,101,32,40,109,112,58,99,108,101,97,114,115,101,113,41,10,32,32,40,102,
-  102,105,95,109,112,95,99,108,101,97,114,95,115,101,113,41,41,10,10,40,100,101,102,105,110,101,32,40,109,112,58,114,101,99,111,114,100,115,101,113,
-  32,46,32,97,114,103,115,41,10,32,32,40,108,101,116,32,40,40,114,101,99,32,40,105,102,32,40,110,117,108,108,63,32,97,114,103,115,41,32,35,
-  102,32,40,99,97,114,32,97,114,103,115,41,41,41,41,10,32,32,32,32,40,102,102,105,95,109,112,95,115,101,116,95,114,101,99,111,114,100,95,115,
-  101,113,32,114,101,99,41,41,41,10,10,59,59,32,105,110,112,117,116,32,112,111,114,116,10,10,59,32,40,109,112,58,114,101,99,101,105,118,101,32,
-  112,114,111,99,41,10,59,32,40,109,112,58,114,101,99,101,105,118,101,32,35,102,41,10,59,32,40,109,112,58,114,101,99,101,105,118,101,32,111,112,
-  32,112,114,111,99,41,10,59,32,40,109,112,58,114,101,99,101,105,118,101,41,10,10,40,100,101,102,105,110,101,32,40,109,112,58,114,101,99,101,105,
-  118,101,32,46,32,97,114,103,115,41,10,32,32,40,105,102,32,40,110,117,108,108,63,32,97,114,103,115,41,32,59,32,99,108,101,97,114,32,97,108,
-  108,32,104,111,111,107,115,10,32,32,32,32,32,32,40,102,102,105,95,109,112,95,115,101,116,95,109,105,100,105,95,104,111,111,107,32,45,49,32,35,
-  102,41,10,32,32,32,32,32,32,40,108,101,116,32,40,40,97,114,103,32,40,99,97,114,32,97,114,103,115,41,41,10,32,32,32,32,32,32,32,32,
-  32,32,32,32,40,114,101,115,116,32,40,99,100,114,32,97,114,103,115,41,41,41,10,32,32,32,32,32,32,32,32,40,105,102,32,40,110,117,108,108,
-  63,32,114,101,115,116,41,32,59,32,115,101,116,116,105,110,103,32,111,114,32,99,108,101,97,114,105,110,103,32,100,101,102,97,117,108,116,32,104,111,
-  111,107,10,32,32,32,32,32,32,32,32,32,32,32,32,40,105,102,32,40,110,111,116,32,97,114,103,41,32,10,32,32,32,32,32,32,32,32,32,32,
-  32,32,32,32,32,32,40,102,102,105,95,109,112,95,115,101,116,95,109,105,100,105,95,104,111,111,107,32,48,32,35,102,41,32,59,32,99,108,101,97,
-  114,32,100,101,102,97,117,108,116,32,104,111,111,107,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,10,32,32,32,32,32,32,32,32,32,32,
-  32,32,32,32,32,32,40,105,102,32,40,97,110,100,32,40,112,114,111,99,101,100,117,114,101,63,32,97,114,103,41,10,32,32,32,32,32,32,32,32,
-  32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,108,101,116,32,40,40,97,114,32,40,112,114,111,99,101,100,117,114,101,45,97,114,
-  105,116,121,32,97,114,103,41,41,41,32,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,
-  111,114,32,40,61,32,40,99,97,114,32,97,114,32,41,32,49,41,40,61,32,40,99,97,100,114,32,97,114,32,41,32,49,41,41,41,41,10,32,32,
-  32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,102,102,105,95,109,112,95,115,101,116,95,109,105,100,105,95,104,111,111,107,32,
-  48,32,97,114,103,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,109,112,58,114,101,
-  99,101,105,118,101,58,32,97,114,103,117,109,101,110,116,32,110,111,116,32,35,102,32,111,114,32,97,32,112,114,111,99,101,100,117,114,101,32,111,102,
-  32,111,110,101,32,97,114,103,117,109,101,110,116,58,32,126,83,34,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-  32,32,32,32,32,32,97,114,103,41,41,41,10,32,32,32,32,32,32,32,32,32,32,32,32,59,59,32,114,101,115,116,32,105,115,32,40,60,112,114,
-  111,99,124,35,102,62,41,10,32,32,32,32,32,32,32,32,32,32,32,32,40,108,101,116,32,40,40,111,112,32,97,114,103,41,10,32,32,32,32,32,
-  32,32,32,32,32,32,32,32,32,32,32,32,32,40,112,114,111,99,32,40,99,97,114,32,114,101,115,116,41,41,10,32,32,32,32,32,32,32,32,32,
-  32,32,32,32,32,32,32,32,32,40,114,101,115,116,32,40,99,100,114,32,114,101,115,116,41,41,41,10,32,32,32,32,32,32,32,32,32,32,32,32,
-  32,32,40,105,102,32,40,110,117,108,108,63,32,114,101,115,116,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,105,102,
-  32,40,97,110,100,32,40,105,110,116,101,103,101,114,63,32,111,112,41,32,40,111,114,32,40,60,61,32,109,109,58,111,102,102,32,111,112,32,109,109,
-  58,98,101,110,100,41,32,40,61,32,111,112,32,48,41,41,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-  40,105,102,32,40,111,114,32,40,110,111,116,32,112,114,111,99,41,32,59,59,32,99,108,101,97,114,47,115,101,116,32,118,97,108,105,100,32,104,111,
-  111,107,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,97,110,100,32,40,112,
-  114,111,99,101,100,117,114,101,63,32,112,114,111,99,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-  32,32,32,32,32,32,32,32,32,32,32,40,108,101,116,32,40,40,97,114,32,40,112,114,111,99,101,100,117,114,101,45,97,114,105,116,121,32,112,114,
-  111,99,41,41,41,32,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-  32,32,32,32,40,111,114,32,40,61,32,40,99,97,114,32,97,114,32,41,32,49,41,40,61,32,40,99,97,100,114,32,97,114,32,41,32,49,41,41,
-  41,41,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,102,102,105,95,109,112,95,115,101,
-  116,95,109,105,100,105,95,104,111,111,107,32,111,112,32,112,114,111,99,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-  32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,109,112,58,114,101,99,101,105,118,101,58,32,114,101,99,101,105,118,101,114,32,110,111,116,32,
-  35,102,32,111,114,32,97,32,112,114,111,99,101,100,117,114,101,32,111,102,32,111,110,101,32,97,114,103,117,109,101,110,116,58,32,126,83,34,10,32,
-  32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,114,111,99,41,41,10,32,
-  32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,109,112,58,114,101,99,101,105,118,101,58,
-  32,105,110,118,97,108,105,100,32,114,101,99,101,105,118,101,32,111,112,99,111,100,101,58,32,126,83,34,32,111,112,41,41,10,32,32,32,32,32,32,
-  32,32,32,32,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,109,112,58,114,101,99,101,105,118,101,58,32,116,111,111,32,109,97,110,121,
-  32,97,114,103,117,109,101,110,116,115,58,32,126,83,34,32,97,114,103,115,41,41,41,41,41,41,41,10,10,40,100,101,102,105,110,101,32,40,109,112,
+  99,108,111,115,101,95,105,110,112,117,116,32,40,99,97,114,32,100,101,118,41,41,10,32,32,32,32,32,32,40,101,114,114,111,114,32,34,126,83,32,
+  105,115,32,110,111,116,32,97,32,109,105,100,105,32,100,101,118,105,99,101,32,110,117,109,98,101,114,34,32,100,101,118,41,41,41,10,10,40,100,101,
+  102,105,110,101,32,40,109,112,58,111,112,101,110,45,115,99,111,114,101,32,112,97,116,104,32,46,32,97,114,103,115,41,10,32,32,40,102,102,105,95,
+  109,112,95,111,112,101,110,95,115,99,111,114,101,32,112,97,116,104,32,97,114,103,115,41,10,32,32,41,10,10,40,100,101,102,105,110,101,32,40,109,
+  112,58,99,108,111,115,101,45,115,99,111,114,101,32,41,10,32,32,40,102,102,105,95,109,112,95,99,108,111,115,101,95,115,99,111,114,101,32,41,10,
+  32,32,41,10,10,40,100,101,102,105,110,101,45,109,97,99,114,111,32,40,119,105,116,104,45,109,105,100,105,32,97,114,103,115,32,46,32,98,111,100,
+  121,41,10,32,32,40,105,102,32,40,110,111,116,32,40,112,97,105,114,63,32,97,114,103,115,41,41,10,32,32,32,32,32,32,40,101,114,114,111,114,
+  32,34,119,105,116,104,45,109,105,100,105,58,32,97,114,103,117,109,101,110,116,115,32,110,111,116,32,97,32,108,105,115,116,58,32,126,83,34,32,97,
+  114,103,115,41,41,10,32,32,96,40,100,121,110,97,109,105,99,45,119,105,110,100,32,10,32,32,32,32,32,32,32,40,108,97,109,98,100,97,32,40,
+  41,32,10,32,32,32,32,32,32,32,32,32,40,109,112,58,111,112,101,110,45,115,99,111,114,101,32,44,40,99,97,114,32,97,114,103,115,41,32,44,
+  64,40,99,100,114,32,97,114,103,115,41,41,10,32,32,32,32,32,32,32,32,32,40,102,102,105,95,115,99,104,101,100,95,115,101,116,95,115,99,111,
+  114,101,95,109,111,100,101,32,42,115,99,111,114,101,45,116,121,112,101,45,109,105,100,105,42,41,41,10,32,32,32,32,32,32,32,40,108,97,109,98,
+  100,97,32,40,41,32,44,64,98,111,100,121,32,40,118,111,105,100,41,41,10,32,32,32,32,32,32,32,40,108,97,109,98,100,97,32,40,41,10,32,
+  32,32,32,32,32,32,32,32,40,102,102,105,95,115,99,104,101,100,95,115,101,116,95,115,99,111,114,101,95,109,111,100,101,32,48,41,10,32,32,32,
+  32,32,32,32,32,32,40,109,112,58,99,108,111,115,101,45,115,99,111,114,101,41,41,41,41,10,10,40,100,101,102,105,110,101,42,32,40,109,112,58,
+  109,105,100,105,32,116,105,109,101,32,100,117,114,32,107,101,121,32,97,109,112,32,99,104,97,110,32,112,111,114,116,41,10,32,32,40,102,102,105,95,
+  109,112,95,115,101,110,100,95,110,111,116,101,32,116,105,109,101,32,100,117,114,32,107,101,121,32,97,109,112,32,99,104,97,110,32,112,111,114,116,41,
+  41,10,10,59,40,100,101,102,105,110,101,32,40,109,112,58,109,105,100,105,32,46,32,97,114,103,115,41,10,59,32,32,40,119,105,116,104,45,111,112,
+  116,107,101,121,115,32,40,97,114,103,115,32,40,116,105,109,101,32,48,41,32,40,100,117,114,32,46,53,41,32,40,107,101,121,32,54,48,41,32,40,
+  97,109,112,32,46,53,41,32,40,99,104,97,110,32,48,41,41,10,59,32,32,32,32,40,102,102,105,95,109,112,95,115,101,110,100,95,110,111,116,101,
+  32,116,105,109,101,32,100,117,114,32,107,101,121,32,97,109,112,32,99,104,97,110,41,41,41,10,10,40,100,101,102,105,110,101,32,40,109,112,58,111,
+  102,102,32,46,32,97,114,103,115,41,10,32,32,40,119,105,116,104,45,111,112,116,107,101,121,115,32,40,97,114,103,115,32,40,116,105,109,101,32,48,
+  41,32,40,107,101,121,32,54,48,41,32,40,99,104,97,110,32,48,41,32,40,112,111,114,116,32,45,49,41,41,10,32,32,32,32,40,102,102,105,95,
+  109,112,95,115,101,110,100,95,100,97,116,97,32,109,109,58,111,102,102,32,116,105,109,101,32,99,104,97,110,32,107,101,121,32,48,32,112,111,114,116,
+  41,41,41,10,10,40,100,101,102,105,110,101,32,40,109,112,58,111,110,32,46,32,97,114,103,115,41,10,32,32,40,119,105,116,104,45,111,112,116,107,
+  101,121,115,32,40,97,114,103,115,32,40,116,105,109,101,32,48,41,32,40,107,101,121,32,54,48,41,32,40,118,101,108,32,54,52,41,32,40,99,104,
+  97,110,32,48,41,32,40,112,111,114,116,32,45,49,41,41,10,32,32,32,32,40,102,102,105,95,109,112,95,115,101,110,100,95,100,97,116,97,32,109,
+  109,58,111,110,32,116,105,109,101,32,99,104,97,110,32,107,101,121,32,118,101,108,32,112,111,114,116,41,41,41,10,10,40,100,101,102,105,110,101,32,
+  40,109,112,58,116,111,117,99,104,32,46,32,97,114,103,115,41,10,32,32,40,119,105,116,104,45,111,112,116,107,101,121,115,32,40,97,114,103,115,32,
+  40,116,105,109,101,32,48,41,32,40,107,101,121,32,48,41,32,40,118,97,108,32,48,41,32,40,99,104,97,110,32,48,41,32,40,112,111,114,116,32,
+  45,49,41,41,10,32,32,32,32,40,102,102,105,95,109,112,95,115,101,110,100,95,100,97,116,97,32,109,109,58,116,111,117,99,104,32,116,105,109,101,
+  32,99,104,97,110,32,107,101,121,32,118,97,108,32,112,111,114,116,41,41,41,10,10,40,100,101,102,105,110,101,32,40,109,112,58,99,116,114,108,32,
+  46,32,97,114,103,115,41,10,32,32,40,119,105,116,104,45,111,112,116,107,101,121,115,32,40,97,114,103,115,32,40,116,105,109,101,32,48,41,32,40,
+  110,117,109,32,48,41,32,40,118,97,108,32,48,41,32,40,99,104,97,110,32,48,41,32,40,112,111,114,116,32,45,49,41,41,10,32,32,32,32,40,
+  102,102,105,95,109,112,95,115,101,110,100,95,100,97,116,97,32,109,109,58,99,116,114,108,32,116,105,109,101,32,99,104,97,110,32,110,117,109,32,118,
+  97,108,32,112,111,114,116,41,41,41,10,10,40,100,101,102,105,110,101,32,40,109,112,58,112,114,111,103,32,46,32,97,114,103,115,41,10,32,32,40,
+  119,105,116,104,45,111,112,116,107,101,121,115,32,40,97,114,103,115,32,40,116,105,109,101,32,48,41,32,40,118,97,108,32,48,41,32,40,99,104,97,
+  110,32,48,41,32,40,112,111,114,116,32,45,49,41,41,10,32,32,32,32,40,102,102,105,95,109,112,95,115,101,110,100,95,100,97,116,97,32,109,109,
+  58,112,114,111,103,32,116,105,109,101,32,99,104,97,110,32,118,97,108,32,48,32,112,111,114,116,41,41,41,10,10,40,100,101,102,105,110,101,32,40,
+  109,112,58,112,114,101,115,115,32,46,32,97,114,103,115,41,10,32,32,40,119,105,116,104,45,111,112,116,107,101,121,115,32,40,97,114,103,115,32,40,
+  116,105,109,101,32,48,41,32,40,118,97,108,32,48,41,32,40,99,104,97,110,32,48,41,32,40,112,111,114,116,32,45,49,41,41,10,32,32,32,32,
+  40,102,102,105,95,109,112,95,115,101,110,100,95,100,97,116,97,32,109,109,58,112,114,101,115,115,32,116,105,109,101,32,99,104,97,110,32,118,97,108,
+  32,48,32,112,111,114,116,41,41,41,10,10,40,100,101,102,105,110,101,32,40,109,112,58,98,101,110,100,32,46,32,97,114,103,115,41,10,32,32,40,
+  119,105,116,104,45,111,112,116,107,101,121,115,32,40,97,114,103,115,32,40,116,105,109,101,32,48,41,32,40,118,97,108,32,56,49,57,50,41,32,40,
+  99,104,97,110,32,48,41,32,40,112,111,114,116,32,45,49,41,41,10,32,32,32,32,40,102,102,105,95,109,112,95,115,101,110,100,95,100,97,116,97,
+  32,109,109,58,98,101,110,100,32,116,105,109,101,32,99,104,97,110,32,118,97,108,32,48,32,112,111,114,116,41,41,41,10,10,59,59,32,109,112,58,
+  116,117,110,105,110,103,32,115,101,116,115,32,116,104,101,32,109,105,99,114,111,116,117,110,105,110,103,46,32,97,110,32,105,110,116,101,103,101,114,32,
+  49,32,116,111,32,49,54,32,100,105,118,105,100,101,115,32,101,97,99,104,10,59,59,32,115,101,109,105,116,111,110,101,32,101,113,117,97,108,108,121,
+  44,32,97,32,108,105,115,116,32,111,102,32,99,101,110,116,32,111,102,102,115,101,116,115,32,40,108,105,107,101,32,116,104,101,32,115,116,101,112,115,
+  32,111,102,32,97,32,115,99,97,108,97,10,59,59,32,102,105,108,101,44,32,115,116,97,114,116,105,110,103,32,119,105,116,104,32,48,41,32,115,101,
+  116,115,32,97,110,32,117,110,101,113,117,97,108,32,100,105,118,105,115,105,111,110,32,97,110,100,32,58,98,101,110,100,32,103,105,118,101,115,10,59,
+  59,32,101,97,99,104,32,110,111,116,101,32,105,116,115,32,111,119,110,32,99,104,97,110,110,101,108,32,97,110,100,32,112,105,116,99,104,32,98,101,
+  110,100,46,10,10,40,100,101,102,105,110,101,32,40,109,112,58,116,117,110,105,110,103,32,46,32,97,114,103,115,41,10,32,32,40,108,101,116,32,40,
+  40,97,114,103,32,40,105,102,32,40,110,117,108,108,63,32,97,114,103,115,41,32,49,32,40,99,97,114,32,97,114,103,115,41,41,41,41,10,32,32,
+  32,32,40,99,111,110,100,32,40,40,97,110,100,32,40,105,110,116,101,103,101,114,63,32,97,114,103,41,10,9,9,40,60,32,48,32,97,114,103,32,
+  49,55,41,41,10,9,32,32,32,40,102,102,105,95,109,112,95,115,101,116,95,116,117,110,105,110,103,32,97,114,103,41,41,10,9,32,32,40,40,101,
+  113,63,32,97,114,103,32,58,98,101,110,100,41,10,9,32,32,32,40,102,102,105,95,109,112,95,115,101,116,95,110,111,116,101,95,98,101,110,100,115,
+  32,35,116,41,41,10,9,32,32,40,40,97,110,100,32,40,112,97,105,114,63,32,97,114,103,41,10,9,9,40,102,102,105,95,109,112,95,115,101,116,
+  95,116,117,110,105,110,103,95,111,102,102,115,101,116,115,32,97,114,103,41,41,41,10,9,32,32,40,101,108,115,101,10,9,32,32,32,40,101,114,114,
+  111,114,32,34,126,83,32,105,115,32,110,111,116,32,97,32,116,117,110,105,110,103,32,100,105,118,105,115,105,111,110,32,49,32,116,111,32,49,54,44,
+  32,108,105,115,116,32,111,102,32,99,101,110,116,32,111,102,102,115,101,116,115,32,111,114,32,58,98,101,110,100,34,32,97,114,103,41,41,41,41,41,
+  10,10,59,59,32,109,112,58,108,111,111,107,97,104,101,97,100,32,115,101,116,115,32,116,104,101,32,110,117,109,98,101,114,32,111,102,32,109,105,108,
+  108,105,115,101,99,111,110,100,115,32,97,104,101,97,100,32,111,102,32,116,105,109,101,32,116,104,97,116,10,59,59,32,111,117,116,112,117,116,32,105,
+  115,32,104,97,110,100,101,100,32,111,118,101,114,32,119,105,116,104,32,105,116,115,32,116,105,109,101,32,115,116,97,109,112,46,32,48,32,40,116,104,
+  101,32,100,101,102,97,117,108,116,41,32,115,101,110,100,115,10,59,59,32,101,97,99,104,32,109,101,115,115,97,103,101,32,119,104,101,110,32,105,116,
+  32,105,115,32,100,117,101,46,32,111,110,32,108,105,110,117,120,32,116,104,101,32,111,117,116,112,117,116,32,103,111,101,115,32,116,111,32,97,110,32,
+  97,108,115,97,10,59,59,32,115,101,113,117,101,110,99,101,114,32,113,117,101,117,101,32,116,104,97,116,32,115,101,110,100,115,32,105,116,32,111,110,
+  32,116,105,109,101,44,32,108,97,116,101,32,109,101,115,115,97,103,101,115,32,103,111,32,111,117,116,32,97,116,10,59,59,32,111,110,99,101,46,32,
+  101,108,115,101,119,104,101,114,101,32,106,117,99,101,39,115,32,109,105,100,105,32,111,117,116,112,117,116,32,116,104,114,101,97,100,32,115,101,110,100,
+  115,32,105,116,44,32,119,104,105,99,104,32,108,111,119,101,114,115,10,59,59,32,116,104,101,32,97,118,101,114,97,103,101,32,108,97,116,101,110,101,
+  115,115,32,98,117,116,32,110,111,116,32,116,104,101,32,106,105,116,116,101,114,58,32,105,116,32,114,111,117,110,100,115,32,116,105,109,101,115,32,116,
+  111,32,97,32,119,104,111,108,101,10,59,59,32,109,105,108,108,105,115,101,99,111,110,100,32,97,110,100,32,100,114,111,112,115,32,109,101,115,115,97,
+  103,101,115,32,109,111,114,101,32,116,104,97,110,32,50,48,48,32,109,115,32,108,97,116,101,46,10,10,40,100,101,102,105,110,101,32,40,109,112,58,
+  108,111,111,107,97,104,101,97,100,32,46,32,97,114,103,115,41,10,32,32,40,108,101,116,32,40,40,97,114,103,32,40,105,102,32,40,110,117,108,108,
+  63,32,97,114,103,115,41,32,48,32,40,99,97,114,32,97,114,103,115,41,41,41,41,10,32,32,32,32,40,105,102,32,40,97,110,100,32,40,114,101,
+  97,108,63,32,97,114,103,41,32,40,62,61,32,97,114,103,32,48,41,41,10,9,40,102,102,105,95,109,112,95,115,101,116,95,108,111,111,107,97,104,
+  101,97,100,32,97,114,103,41,10,9,40,101,114,114,111,114,32,34,126,83,32,105,115,32,110,111,116,32,97,32,108,111,111,107,97,104,101,97,100,32,
+  116,105,109,101,32,105,110,32,109,105,108,108,105,115,101,99,111,110,100,115,32,62,61,32,48,34,32,97,114,103,41,41,41,41,10,10,59,59,32,109,
+  112,58,114,101,116,114,105,103,103,101,114,32,116,117,114,110,115,32,114,101,116,114,105,103,103,101,114,32,109,111,100,101,32,111,110,32,111,114,32,111,
+  102,102,46,32,105,110,32,114,101,116,114,105,103,103,101,114,32,109,111,100,101,32,97,10,59,59,32,110,111,116,101,32,111,110,32,102,111,114,32,97,
+  32,107,101,121,32,116,104,97,116,32,105,115,32,115,116,105,108,108,32,115,111,117,110,100,105,110,103,32,115,101,110,100,115,32,116,104,97,116,32,107,
+  101,121,39,115,32,110,111,116,101,32,111,102,102,10,59,59,32,102,105,114,115,116,44,32,111,116,104,101,114,119,105,115,101,32,116,104,101,32,101,97,
+  114,108,105,101,115,116,32,110,111,116,101,32,111,102,102,32,101,110,100,115,32,116,104,101,32,107,101,121,46,10,10,40,100,101,102,105,110,101,32,40,
+  109,112,58,114,101,116,114,105,103,103,101,114,32,46,32,97,114,103,115,41,10,32,32,40,108,101,116,32,40,40,97,114,103,32,40,105,102,32,40,110,
+  117,108,108,63,32,97,114,103,115,41,32,35,116,32,40,99,97,114,32,97,114,103,115,41,41,41,41,10,32,32,32,32,40,102,102,105,95,109,112,95,
+  115,101,116,95,114,101,116,114,105,103,103,101,114,32,40,105,102,32,97,114,103,32,35,116,32,35,102,41,41,41,41,10,10,59,59,32,109,112,58,101,
+  120,116,101,110,100,32,116,117,114,110,115,32,101,120,116,101,110,100,32,109,111,100,101,32,111,110,32,111,114,32,111,102,102,46,32,105,110,32,101,120,
+  116,101,110,100,32,109,111,100,101,32,97,32,110,111,116,101,32,111,110,32,102,111,114,10,59,59,32,97,32,107,101,121,32,116,104,97,116,32,105,115,
+  32,115,116,105,108,108,32,115,111,117,110,100,105,110,103,32,107,101,101,112,115,32,116,104,101,32,107,101,121,32,115,111,117,110,100,105,110,103,32,117,
+  110,116,105,108,32,116,104,101,32,108,97,116,101,114,10,59,59,32,110,111,116,101,32,101,110,100,115,46,32,114,101,116,114,105,103,103,101,114,32,109,
+  111,100,101,32,116,97,107,101,115,32,112,114,101,99,101,100,101,110,99,101,46,10,10,40,100,101,102,105,110,101,32,40,109,112,58,101,120,116,101,110,
+  100,32,46,32,97,114,103,115,41,10,32,32,40,108,101,116,32,40,40,97,114,103,32,40,105,102,32,40,110,117,108,108,63,32,97,114,103,115,41,32,
+  35,116,32,40,99,97,114,32,97,114,103,115,41,41,41,41,10,32,32,32,32,40,102,102,105,95,109,112,95,115,101,116,95,101,120,116,101,110,100,32,
+  40,105,102,32,97,114,103,32,35,116,32,35,102,41,41,41,41,10,10,40,100,101,102,105,110,101,32,40,109,112,58,105,110,115,116,114,117,109,101,110,
+  116,115,32,46,32,97,114,103,115,41,10,32,32,40,102,102,105,95,109,112,95,115,101,116,95,105,110,115,116,114,117,109,101,110,116,115,32,97,114,103,
+  115,41,41,10,10,59,59,32,109,112,58,112,111,114,116,115,32,114,111,117,116,101,115,32,101,97,99,104,32,99,104,97,110,110,101,108,32,116,111,32,
+  97,110,32,111,117,116,112,117,116,32,112,111,114,116,44,32,108,105,107,101,32,109,112,58,105,110,115,116,114,117,109,101,110,116,115,10,59,59,32,116,
+  104,101,32,102,105,114,115,116,32,118,97,108,117,101,32,105,115,32,102,111,114,32,99,104,97,110,110,101,108,32,48,46,32,109,101,115,115,97,103,101,
+  115,32,119,105,116,104,32,97,110,32,101,120,112,108,105,99,105,116,32,112,111,114,116,32,103,111,10,59,59,32,116,104,101,114,101,32,105,110,115,116,
+  101,97,100,46,10,10,40,100,101,102,105,110,101,32,40,109,112,58,112,111,114,116,115,32,46,32,97,114,103,115,41,10,32,32,40,102,102,105,95,109,
+  112,95,115,101,116,95,99,104,97,110,110,101,108,95,112,111,114,116,115,32,97,114,103,115,41,41,10,10,59,59,32,109,112,58,108,97,116,101,110,99,
+  121,32,115,101,116,115,32,116,104,101,32,108,97,116,101,110,99,121,32,105,110,32,109,105,108,108,105,115,101,99,111,110,100,115,32,111,102,32,116,104,
+  101,32,100,101,118,105,99,101,32,111,110,32,97,110,10,59,59,32,111,117,116,112,117,116,32,112,111,114,116,46,32,116,104,101,32,111,116,104,101,114,
+  32,112,111,114,116,115,32,97,114,101,32,104,101,108,100,32,98,97,99,107,32,115,111,32,116,104,101,121,32,115,111,117,110,100,32,116,111,103,101,116,
+  104,101,114,46,10,10,40,100,101,102,105,110,101,32,40,109,112,58,108,97,116,101,110,99,121,32,112,111,114,116,32,109,115,41,10,32,32,40,105,102,
+  32,40,97,110,100,32,40,105,110,116,101,103,101,114,63,32,112,111,114,116,41,32,40,62,61,32,112,111,114,116,32,48,41,32,40,114,101,97,108,63,
+  32,109,115,41,32,40,62,61,32,109,115,32,48,41,41,10,32,32,32,32,32,32,40,102,102,105,95,109,112,95,115,101,116,95,111,117,116,112,117,116,
+  95,108,97,116,101,110,99,121,32,112,111,114,116,32,109,115,41,10,32,32,32,32,32,32,40,101,114,114,111,114,32,34,126,83,32,126,83,32,105,115,
+  32,110,111,116,32,97,110,32,111,117,116,112,117,116,32,112,111,114,116,32,97,110,100,32,108,97,116,101,110,99,121,32,105,110,32,109,105,108,108,105,
+  115,101,99,111,110,100,115,32,62,61,32,48,34,32,112,111,114,116,32,109,115,41,41,41,10,10,40,100,101,102,105,110,101,32,40,109,112,58,112,108,
+  97,121,115,101,113,41,10,32,32,40,102,102,105,95,109,112,95,112,108,97,121,95,115,101,113,41,41,10,10,40,100,101,102,105,110,101,32,40,109,112,
+  58,115,97,118,101,115,101,113,41,10,32,32,40,102,102,105,95,109,112,95,115,97,118,101,95,115,101,113,41,41,10,10,40,100,101,102,105,110,101,32,
+  40,109,112,58,99,111,112,121,115,101,113,41,10,32,32,40,102,102,105,95,109,112,95,99,111,112,121,95,115,101,113,41,41,10,10,40,100,101,102,105,
+  110,101,32,40,109,112,58,112,108,111,116,115,101,113,41,10,32,32,40,102,102,105,95,109,112,95,112,108,111,116,95,115,101,113,41,41,10,10,40,100,
+  101,102,105,110,101,32,40,109,112,58,99,108,101,97,114,115,101,113,41,10,32,32,40,102,102,105,95,109,112,95,99,108,101,97,114,95,115,101,113,41,
+  41,10,10,40,100,101,102,105,110,101,32,40,109,112,58,114,101,99,111,114,100,115,101,113,32,46,32,97,114,103,115,41,10,32,32,40,108,101,116,32,
+  40,40,114,101,99,32,40,105,102,32,40,110,117,108,108,63,32,97,114,103,115,41,32,35,102,32,40,99,97,114,32,97,114,103,115,41,41,41,41,10,
+  32,32,32,32,40,102,102,105,95,109,112,95,115,101,116,95,114,101,99,111,114,100,95,115,101,113,32,114,101,99,41,41,41,10,10,59,59,32,105,110,
+  112,117,116,32,112,111,114,116,10,10,59,32,40,109,112,58,114,101,99,101,105,118,101,32,112,114,111,99,41,10,59,32,40,109,112,58,114,101,99,101,
+  105,118,101,32,35,102,41,10,59,32,40,109,112,58,114,101,99,101,105,118,101,32,111,112,32,112,114,111,99,41,10,59,32,40,109,112,58,114,101,99,
+  101,105,118,101,41,10,10,40,100,101,102,105,110,101,32,40,109,112,58,114,101,99,101,105,118,101,32,46,32,97,114,103,115,41,10,32,32,40,105,102,
+  32,40,110,117,108,108,63,32,97,114,103,115,41,32,59,32,99,108,101,97,114,32,97,108,108,32,104,111,111,107,115,10,32,32,32,32,32,32,40,102,
+  102,105,95,109,112,95,115,101,116,95,109,105,100,105,95,104,111,111,107,32,45,49,32,35,102,41,10,32,32,32,32,32,32,40,108,101,116,32,40,40,
+  97,114,103,32,40,99,97,114,32,97,114,103,115,41,41,10,32,32,32,32,32,32,32,32,32,32,32,32,40,114,101,115,116,32,40,99,100,114,32,97,
+  114,103,115,41,41,41,10,32,32,32,32,32,32,32,32,40,105,102,32,40,110,117,108,108,63,32,114,101,115,116,41,32,59,32,115,101,116,116,105,110,
+  103,32,111,114,32,99,108,101,97,114,105,110,103,32,100,101,102,97,117,108,116,32,104,111,111,107,10,32,32,32,32,32,32,32,32,32,32,32,32,40,
+  105,102,32,40,110,111,116,32,97,114,103,41,32,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,102,102,105,95,109,112,95,115,101,
+  116,95,109,105,100,105,95,104,111,111,107,32,48,32,35,102,41,32,59,32,99,108,101,97,114,32,100,101,102,97,117,108,116,32,104,111,111,107,32,32,
+  32,32,32,32,32,32,32,32,32,32,32,32,32,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,105,102,32,40,97,110,100,32,40,
+  112,114,111,99,101,100,117,114,101,63,32,97,114,103,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+  32,40,108,101,116,32,40,40,97,114,32,40,112,114,111,99,101,100,117,114,101,45,97,114,105,116,121,32,97,114,103,41,41,41,32,10,32,32,32,32,
+  32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,111,114,32,40,61,32,40,99,97,114,32,97,114,32,41,32,
+  49,41,40,61,32,40,99,97,100,114,32,97,114,32,41,32,49,41,41,41,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+  32,32,40,102,102,105,95,109,112,95,115,101,116,95,109,105,100,105,95,104,111,111,107,32,48,32,97,114,103,41,10,32,32,32,32,32,32,32,32,32,
+  32,32,32,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,109,112,58,114,101,99,101,105,118,101,58,32,97,114,103,117,109,101,110,116,32,
+  110,111,116,32,35,102,32,111,114,32,97,32,112,114,111,99,101,100,117,114,101,32,111,102,32,111,110,101,32,97,114,103,117,109,101,110,116,58,32,126,
+  83,34,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,114,103,41,41,41,10,32,32,32,
+  32,32,32,32,32,32,32,32,32,59,59,32,114,101,115,116,32,105,115,32,40,60,112,114,111,99,124,35,102,62,41,10,32,32,32,32,32,32,32,32,
+  32,32,32,32,40,108,101,116,32,40,40,111,112,32,97,114,103,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,112,114,
+  111,99,32,40,99,97,114,32,114,101,115,116,41,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,114,101,115,116,32,40,
+  99,100,114,32,114,101,115,116,41,41,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,105,102,32,40,110,117,108,108,63,32,114,101,115,
+  116,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,105,102,32,40,97,110,100,32,40,105,110,116,101,103,101,114,63,32,
+  111,112,41,32,40,111,114,32,40,60,61,32,109,109,58,111,102,102,32,111,112,32,109,109,58,98,101,110,100,41,32,40,61,32,111,112,32,48,41,41,
+  41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,105,102,32,40,111,114,32,40,110,111,116,32,112,114,111,
+  99,41,32,59,59,32,99,108,101,97,114,47,115,101,116,32,118,97,108,105,100,32,104,111,111,107,10,32,32,32,32,32,32,32,32,32,32,32,32,32,
+  32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,97,110,100,32,40,112,114,111,99,101,100,117,114,101,63,32,112,114,111,99,41,10,
+  32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,108,101,116,32,
+  40,40,97,114,32,40,112,114,111,99,101,100,117,114,101,45,97,114,105,116,121,32,112,114,111,99,41,41,41,32,10,32,32,32,32,32,32,32,32,32,
+  32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,111,114,32,40,61,32,40,99,97,114,32,
+  97,114,32,41,32,49,41,40,61,32,40,99,97,100,114,32,97,114,32,41,32,49,41,41,41,41,41,10,32,32,32,32,32,32,32,32,32,32,32,32,
+  32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,102,102,105,95,109,112,95,115,101,116,95,109,105,100,105,95,104,111,111,107,32,111,112,32,112,
+  114,111,99,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,109,
+  112,58,114,101,99,101,105,118,101,58,32,114,101,99,101,105,118,101,114,32,110,111,116,32,35,102,32,111,114,32,97,32,112,114,111,99,101,100,117,114,
+  101,32,111,102,32,111,110,101,32,97,114,103,117,109,101,110,116,58,32,126,83,34,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+  32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,114,111,99,41,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+  32,32,32,32,32,40,101,114,114,111,114,32,34,109,112,58,114,101,99,101,105,118,101,58,32,105,110,118,97,108,105,100,32,114,101,99,101,105,118,101,
+  32,111,112,99,111,100,101,58,32,126,83,34,32,111,112,41,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,101,114,114,
+  111,114,32,34,109,112,58,114,101,99,101,105,118,101,58,32,116,111,111,32,109,97,110,121,32,97,114,103,117,109,101,110,116,115,58,32,126,83,34,32,
+  97,114,103,115,41,41,41,41,41,41,41,10,10,59,32,40,109,112,58,114,101,99,101,105,118,101,45,98,97,116,99,104,32,112,114,111,99,41,10,59,
+  32,40,109,112,58,114,101,99,101,105,118,101,45,98,97,116,99,104,32,112,114,111,99,32,58,99,111,97,108,101,115,99,101,32,35,116,41,10,59,32,
+  40,109,112,58,114,101,99,101,105,118,101,45,98,97,116,99,104,32,35,102,41,10,59,32,112,114,111,99,32,105,115,32,99,97,108,108,101,100,32,119,
+  105,116,104,32,97,32,118,101,99,116,111,114,32,97,110,100,32,97,32,114,111,119,32,99,111,117,110,116,46,32,101,97,99,104,32,114,111,119,32,105,
+  115,32,102,105,118,101,10,59,32,105,110,116,101,103,101,114,115,58,32,111,112,32,99,104,97,110,32,100,97,116,97,49,32,100,97,116,97,50,32,109,
+  115,101,99,46,32,116,104,101,32,118,101,99,116,111,114,32,105,115,32,114,101,117,115,101,100,32,102,111,114,32,101,118,101,114,121,10,59,32,99,97,
+  108,108,46,32,119,104,105,108,101,32,97,32,98,97,116,99,104,32,114,101,99,101,105,118,101,114,32,105,115,32,115,101,116,32,105,116,32,114,101,99,
+  101,105,118,101,115,32,97,108,108,32,109,105,100,105,32,105,110,112,117,116,46,10,59,32,99,111,97,108,101,115,99,101,32,107,101,101,112,115,32,111,
+  110,108,121,32,116,104,101,32,108,97,115,116,32,118,97,108,117,101,32,111,102,32,101,97,99,104,32,99,111,110,116,114,111,108,108,101,114,32,105,110,
+  32,97,32,98,97,116,99,104,46,10,10,40,100,101,102,105,110,101,32,40,109,112,58,114,101,99,101,105,118,101,45,98,97,116,99,104,32,112,114,111,
+  99,32,46,32,97,114,103,115,41,10,32,32,40,119,105,116,104,45,111,112,116,107,101,121,115,32,40,97,114,103,115,32,40,99,111,97,108,101,115,99,
+  101,32,35,102,41,41,10,32,32,32,32,40,105,102,32,40,111,114,32,40,110,111,116,32,112,114,111,99,41,10,32,32,32,32,32,32,32,32,32,32,
+  32,32,40,97,110,100,32,40,112,114,111,99,101,100,117,114,101,63,32,112,114,111,99,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+  32,32,40,108,101,116,32,40,40,97,114,32,40,112,114,111,99,101,100,117,114,101,45,97,114,105,116,121,32,112,114,111,99,41,41,41,10,32,32,32,
+  32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,111,114,32,40,61,32,40,99,97,114,32,97,114,41,32,50,41,32,40,61,32,40,99,
+  97,100,114,32,97,114,41,32,50,41,41,41,41,41,10,32,32,32,32,32,32,32,32,40,102,102,105,95,109,112,95,115,101,116,95,109,105,100,105,95,
+  98,97,116,99,104,95,104,111,111,107,32,112,114,111,99,32,40,105,102,32,99,111,97,108,101,115,99,101,32,35,116,32,35,102,41,41,10,32,32,32,
+  32,32,32,32,32,40,101,114,114,111,114,32,34,109,112,58,114,101,99,101,105,118,101,45,98,97,116,99,104,58,32,114,101,99,101,105,118,101,114,32,
+  110,111,116,32,35,102,32,111,114,32,97,32,112,114,111,99,101,100,117,114,101,32,111,102,32,116,119,111,32,97,114,103,117,109,101,110,116,115,58,32,
+  126,83,34,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,114,111,99,41,41,41,41,10,10,40,100,101,102,105,110,101,32,40,109,112,
   58,114,101,99,101,105,118,101,63,32,46,32,97,114,103,115,41,10,32,32,40,105,102,32,40,110,117,108,108,63,32,97,114,103,115,41,10,32,32,32,
   32,32,32,40,102,102,105,95,109,112,95,105,115,95,109,105,100,105,95,104,111,111,107,32,45,49,41,10,32,32,32,32,32,32,40,105,102,32,40,110,
   117,108,108,63,32,40,99,100,114,32,97,114,103,115,41,41,10,32,32,32,32,32,32,32,32,32,32,40,108,101,116,32,40,40,111,112,32,40,99,97,
@@ -4214,36 +4301,43 @@ static const unsigned char temp8[] = {59,59,59,32,42,42,42,42,42,42,42,42,42,42,
   126,83,34,32,10,9,9,9,32,32,32,32,32,115,97,118,10,9,9,9,32,32,32,32,32,41,41,10,9,32,32,32,32,32,35,116,41,41,41,41,
   41,41,41,10,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,58,111,112,101,110,34,32,39,40,35,58,
   111,112,116,107,101,121,32,111,117,116,32,105,110,41,41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,
-  58,109,105,100,105,34,32,39,40,35,58,111,112,116,107,101,121,32,116,105,109,101,32,100,117,114,32,107,101,121,32,97,109,112,32,99,104,97,110,41,
-  41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,58,111,102,102,34,32,39,40,35,58,111,112,116,107,
-  101,121,32,116,105,109,101,32,107,101,121,32,99,104,97,110,41,41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,
-  34,109,112,58,111,110,34,32,39,40,35,58,111,112,116,107,101,121,32,116,105,109,101,32,107,101,121,32,118,101,108,32,99,104,97,110,41,41,10,40,
-  100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,58,116,111,117,99,104,34,32,39,40,35,58,111,112,116,107,101,
-  121,32,116,105,109,101,32,107,101,121,32,118,97,108,32,99,104,97,110,41,41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,
-  103,101,32,34,109,112,58,99,116,114,108,34,32,39,40,35,58,111,112,116,107,101,121,32,116,105,109,101,32,110,117,109,32,118,97,108,32,99,104,97,
-  110,41,41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,58,112,114,111,103,34,32,39,40,35,58,111,
-  112,116,107,101,121,32,116,105,109,101,32,118,97,108,32,99,104,97,110,41,41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,
-  103,101,32,34,109,112,58,112,114,101,115,115,34,32,39,40,35,58,111,112,116,107,101,121,32,116,105,109,101,32,118,97,108,32,99,104,97,110,41,41,
-  10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,58,98,101,110,100,34,32,39,40,35,58,111,112,116,107,
-  101,121,32,116,105,109,101,32,118,97,108,32,99,104,97,110,41,41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,
+  58,109,105,100,105,34,32,39,40,35,58,111,112,116,107,101,121,32,116,105,109,101,32,100,117,114,32,107,101,121,32,97,109,112,32,99,104,97,110,32,
+  112,111,114,116,41,41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,58,111,102,102,34,32,39,40,35,
+  58,111,112,116,107,101,121,32,116,105,109,101,32,107,101,121,32,99,104,97,110,32,112,111,114,116,41,41,10,40,100,101,102,105,110,101,45,115,101,110,
+  100,45,109,101,115,115,97,103,101,32,34,109,112,58,111,110,34,32,39,40,35,58,111,112,116,107,101,121,32,116,105,109,101,32,107,101,121,32,118,101,
+  108,32,99,104,97,110,32,112,111,114,116,41,41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,58,116,
+  111,117,99,104,34,32,39,40,35,58,111,112,116,107,101,121,32,116,105,109,101,32,107,101,121,32,118,97,108,32,99,104,97,110,32,112,111,114,116,41,
+  41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,58,99,116,114,108,34,32,39,40,35,58,111,112,116,
+  107,101,121,32,116,105,109,101,32,110,117,109,32,118,97,108,32,99,104,97,110,32,112,111,114,116,41,41,10,40,100,101,102,105,110,101,45,115,101,110,
+  100,45,109,101,115,115,97,103,101,32,34,109,112,58,112,114,111,103,34,32,39,40,35,58,111,112,116,107,101,121,32,116,105,109,101,32,118,97,108,32,
+  99,104,97,110,32,112,111,114,116,41,41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,58,112,114,101,
+  115,115,34,32,39,40,35,58,111,112,116,107,101,121,32,116,105,109,101,32,118,97,108,32,99,104,97,110,32,112,111,114,116,41,41,10,40,100,101,102,
+  105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,58,98,101,110,100,34,32,39,40,35,58,111,112,116,107,101,121,32,116,105,
+  109,101,32,118,97,108,32,99,104,97,110,32,112,111,114,116,41,41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,
   34,109,112,58,109,109,34,32,32,39,40,35,58,111,112,116,107,101,121,32,109,109,32,41,41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,
   101,115,115,97,103,101,32,34,109,112,58,105,110,104,111,111,107,34,32,39,40,35,58,111,112,116,107,101,121,32,102,117,110,99,41,41,10,40,100,101,
   102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,58,116,117,110,105,110,103,34,32,39,40,35,58,111,112,116,107,101,121,
-  32,100,105,118,32,41,41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,58,105,110,115,116,114,117,109,
+  32,100,105,118,32,41,41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,58,108,111,111,107,97,104,101,
+  97,100,34,32,39,40,35,58,111,112,116,107,101,121,32,109,115,32,41,41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,
+  101,32,34,109,112,58,114,101,116,114,105,103,103,101,114,34,32,39,40,35,58,111,112,116,107,101,121,32,98,111,111,108,32,41,41,10,40,100,101,102,
+  105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,58,101,120,116,101,110,100,34,32,39,40,35,58,111,112,116,107,101,121,32,
+  98,111,111,108,32,41,41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,58,105,110,115,116,114,117,109,
   101,110,116,115,34,32,39,40,35,58,114,101,115,116,32,97,114,103,115,32,41,41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,
-  97,103,101,32,34,109,112,58,114,101,99,111,114,100,115,101,113,34,32,39,40,35,58,111,112,116,107,101,121,32,114,101,99,32,41,41,10,40,100,101,
-  102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,58,112,108,97,121,115,101,113,34,32,39,40,41,41,10,40,100,101,102,
-  105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,58,115,97,118,101,115,101,113,34,32,39,40,41,41,10,40,100,101,102,105,
-  110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,58,99,111,112,121,115,101,113,34,32,39,40,41,41,10,40,100,101,102,105,110,
-  101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,58,99,108,101,97,114,115,101,113,34,32,39,40,41,41,10,40,100,101,102,105,110,
-  101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,58,105,110,99,104,97,110,115,34,32,39,40,35,58,114,101,115,116,32,97,114,103,
-  115,41,41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,58,105,110,111,112,115,34,32,39,40,35,58,
-  114,101,115,116,32,97,114,103,115,41,41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,99,115,58,105,34,32,
-  39,40,35,58,114,101,115,116,32,97,114,103,115,41,41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,99,115,
-  58,102,34,32,39,40,35,58,114,101,115,116,32,97,114,103,115,41,41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,
-  32,34,99,115,58,100,97,116,97,34,32,39,40,97,114,103,41,41,10,59,32,116,104,105,115,32,110,101,101,100,115,32,116,111,32,98,101,32,104,101,
-  114,101,32,111,114,32,101,118,97,108,45,102,114,111,109,45,115,116,114,105,110,103,32,99,111,109,112,97,105,110,115,32,97,98,111,117,116,32,116,104,
-  101,32,108,97,115,116,10,59,32,109,97,99,114,111,10,35,102,10,10,10,10,0,0};
+  97,103,101,32,34,109,112,58,112,111,114,116,115,34,32,39,40,35,58,114,101,115,116,32,97,114,103,115,32,41,41,10,40,100,101,102,105,110,101,45,
+  115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,58,108,97,116,101,110,99,121,34,32,39,40,112,111,114,116,32,109,115,41,41,10,40,100,
+  101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,58,114,101,99,111,114,100,115,101,113,34,32,39,40,35,58,111,112,
+  116,107,101,121,32,114,101,99,32,41,41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,58,112,108,97,
+  121,115,101,113,34,32,39,40,41,41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,58,115,97,118,101,
+  115,101,113,34,32,39,40,41,41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,58,99,111,112,121,115,
+  101,113,34,32,39,40,41,41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,58,99,108,101,97,114,115,
+  101,113,34,32,39,40,41,41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,109,112,58,105,110,99,104,97,110,
+  115,34,32,39,40,35,58,114,101,115,116,32,97,114,103,115,41,41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,
+  34,109,112,58,105,110,111,112,115,34,32,39,40,35,58,114,101,115,116,32,97,114,103,115,41,41,10,40,100,101,102,105,110,101,45,115,101,110,100,45,
+  109,101,115,115,97,103,101,32,34,99,115,58,105,34,32,39,40,35,58,114,101,115,116,32,97,114,103,115,41,41,10,40,100,101,102,105,110,101,45,115,
+  101,110,100,45,109,101,115,115,97,103,101,32,34,99,115,58,102,34,32,39,40,35,58,114,101,115,116,32,97,114,103,115,41,41,10,40,100,101,102,105,
+  110,101,45,115,101,110,100,45,109,101,115,115,97,103,101,32,34,99,115,58,100,97,116,97,34,32,39,40,97,114,103,41,41,10,59,32,116,104,105,115,
+  32,110,101,101,100,115,32,116,111,32,98,101,32,104,101,114,101,32,111,114,32,101,118,97,108,45,102,114,111,109,45,115,116,114,105,110,103,32,99,111,
+  109,112,97,105,110,115,32,97,98,111,117,116,32,116,104,101,32,108,97,115,116,10,59,32,109,97,99,114,111,10,35,102,10,10,10,10,0,0};
 const char* SchemeSources::ports_scm = (const char*) temp8;
 
 static const unsigned char temp9[] = {59,59,59,32,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
@@ -4375,247 +4469,288 @@ static const unsigned char temp9[] = {59,59,59,32,42,42,42,42,42,42,42,42,42,42,
   101,114,114,111,114,32,34,115,112,114,111,117,116,45,104,111,111,107,58,32,104,111,111,107,32,105,115,32,110,111,116,32,97,32,112,114,111,99,101,100,
   117,114,101,32,111,114,32,35,102,58,32,126,83,34,32,40,99,97,114,32,104,111,111,107,41,41,41,41,41,13,10,32,32,42,115,112,114,111,117,116,
   45,104,111,111,107,42,41,13,10,13,10,40,100,101,102,105,110,101,32,40,115,112,114,111,117,116,32,112,114,111,99,32,46,32,97,114,103,115,41,13,
-  10,32,32,59,59,32,40,115,112,114,111,117,116,32,123,112,114,111,99,124,108,105,115,116,125,32,91,97,104,101,97,100,124,108,105,115,116,93,32,91,
-  105,100,124,108,105,115,116,124,102,105,108,101,93,32,46,46,46,41,13,10,32,32,40,108,101,116,32,40,40,115,116,97,114,116,32,48,41,13,10,9,
-  40,105,100,32,48,41,13,10,9,40,102,105,108,101,32,35,102,41,13,10,32,32,32,32,32,32,32,32,40,109,101,116,114,111,32,48,41,13,10,32,
-  32,32,32,32,32,32,32,40,115,116,97,114,116,66,101,97,116,32,48,41,13,10,32,32,32,32,32,32,32,32,41,13,10,32,32,32,32,59,59,32,
-  112,97,114,115,101,32,97,114,103,115,32,97,110,100,32,99,104,101,99,107,32,102,111,114,32,105,108,108,101,103,97,108,32,118,97,108,117,101,115,32,
-  98,101,102,111,114,101,32,115,112,114,111,117,116,105,110,103,13,10,32,32,32,32,59,59,32,97,110,121,116,104,105,110,103,46,32,102,105,114,115,116,
-  32,109,97,107,101,32,115,117,114,101,32,97,108,108,32,112,114,111,99,115,32,97,114,101,32,114,101,97,108,108,121,32,112,114,111,99,101,100,117,114,
-  101,115,46,46,46,13,10,32,32,32,32,40,111,114,32,40,112,114,111,99,101,100,117,114,101,63,32,112,114,111,99,41,13,10,9,40,97,110,100,32,
-  40,112,97,105,114,63,32,112,114,111,99,41,13,10,9,32,32,32,32,32,40,100,111,32,40,40,116,97,105,108,32,112,114,111,99,32,40,99,100,114,
-  32,116,97,105,108,41,41,41,13,10,9,9,32,40,40,110,117,108,108,63,32,116,97,105,108,41,32,35,116,41,13,10,9,32,32,32,32,32,32,32,
-  40,105,102,32,40,110,111,116,32,40,112,114,111,99,101,100,117,114,101,63,32,40,99,97,114,32,116,97,105,108,41,41,41,13,10,9,9,32,32,32,
-  40,101,114,114,111,114,32,34,126,83,32,105,115,32,110,111,116,32,97,32,112,114,111,99,101,115,115,34,32,112,114,111,99,41,41,41,41,13,10,9,
-  40,101,114,114,111,114,32,34,126,83,32,105,115,32,110,111,116,32,97,32,112,114,111,99,101,115,115,34,32,112,114,111,99,41,9,41,13,10,32,32,
-  32,32,59,59,32,112,97,114,115,101,32,111,112,116,107,101,121,32,97,114,103,115,32,117,110,116,105,108,32,102,105,108,101,32,105,110,102,111,44,32,
-  97,108,108,111,119,32,107,101,121,32,97,114,103,115,32,102,111,114,32,115,116,97,114,116,32,97,110,100,32,105,100,13,10,32,32,32,32,40,100,111,
-  32,40,40,116,97,105,108,32,97,114,103,115,32,40,99,100,114,32,116,97,105,108,41,41,13,10,32,32,32,32,32,32,32,32,32,40,107,101,121,119,
-  32,35,102,41,32,32,59,32,116,114,117,101,32,105,102,32,101,110,99,111,117,110,116,101,114,101,100,32,107,101,121,119,111,114,100,13,10,32,32,32,
-  32,32,32,32,32,32,40,97,114,103,110,32,48,32,40,43,32,97,114,103,110,32,49,41,41,41,13,10,32,32,32,32,32,32,32,32,40,40,111,114,
-  32,40,110,117,108,108,63,32,116,97,105,108,41,32,102,105,108,101,41,13,10,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,97,114,103,115,
-  32,116,97,105,108,41,41,13,10,32,32,32,32,32,32,40,99,111,110,100,32,40,40,115,116,114,105,110,103,63,32,40,99,97,114,32,116,97,105,108,
-  41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,102,105,108,101,32,40,99,97,114,32,116,97,105,108,41,41,41,
-  13,10,32,32,32,32,32,32,32,32,32,32,32,32,40,40,107,101,121,119,111,114,100,63,32,40,99,97,114,32,116,97,105,108,41,41,13,10,32,32,
-  32,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,107,101,121,119,32,35,116,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,
-  40,105,102,32,40,110,117,108,108,63,32,40,99,100,114,32,116,97,105,108,41,41,32,40,101,114,114,111,114,32,34,77,105,115,115,105,110,103,32,97,
-  114,103,32,118,97,108,117,101,32,102,111,114,32,126,83,34,32,40,99,97,114,32,116,97,105,108,41,41,41,13,10,32,32,32,32,32,32,32,32,32,
-  32,32,32,32,40,99,111,110,100,32,40,40,101,113,63,32,40,99,97,114,32,116,97,105,108,41,32,58,115,116,97,114,116,41,13,10,32,32,32,32,
-  32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,115,116,97,114,116,32,40,99,97,100,114,32,116,97,105,108,41,41,
-  13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,116,97,105,108,32,40,99,100,114,32,116,97,
-  105,108,41,41,32,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,40,101,113,63,32,40,99,97,114,32,116,97,
-  105,108,41,32,58,105,100,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,105,100,32,40,
-  99,97,100,114,32,116,97,105,108,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,116,
-  97,105,108,32,40,99,100,114,32,116,97,105,108,41,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,101,108,
-  115,101,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,105,110,118,97,108,105,100,32,
-  107,101,121,119,111,114,100,58,32,126,83,34,32,40,99,97,114,32,116,97,105,108,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-  32,32,32,32,32,32,41,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,40,107,101,121,119,32,13,10,32,32,32,32,32,32,32,32,32,
-  32,32,32,32,40,101,114,114,111,114,32,34,101,120,112,101,99,116,101,100,32,107,101,121,32,97,114,103,32,98,117,116,32,103,111,116,32,126,83,32,
-  105,110,115,116,101,97,100,34,32,40,99,97,114,32,116,97,105,108,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,41,13,10,32,32,
-  32,32,32,32,32,32,32,32,32,32,40,40,61,32,97,114,103,110,32,48,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,40,115,101,116,
-  33,32,115,116,97,114,116,32,40,99,97,114,32,116,97,105,108,41,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,40,40,61,32,97,114,
-  103,110,32,49,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,105,100,32,40,99,97,114,32,116,97,105,108,41,41,
-  41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,40,101,108,115,101,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,40,101,114,114,111,
-  114,32,34,105,108,108,101,103,97,108,32,115,112,114,111,117,116,32,97,114,103,117,109,101,110,116,115,32,126,83,34,32,97,114,103,115,41,41,41,41,
-  13,10,13,10,32,32,32,32,59,59,32,109,97,107,101,32,115,117,114,101,32,97,108,108,32,115,116,97,114,116,115,32,97,114,101,32,118,97,108,105,
-  100,32,115,116,97,114,116,32,116,105,109,101,115,46,46,46,13,10,32,32,32,32,40,105,102,32,40,112,114,111,99,101,100,117,114,101,63,32,115,116,
-  97,114,116,41,13,10,32,32,32,32,32,32,32,32,40,98,101,103,105,110,13,10,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,115,116,
-  97,114,116,66,101,97,116,32,40,99,97,114,32,40,115,116,97,114,116,41,41,41,13,10,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,
-  109,101,116,114,111,32,40,99,97,100,114,32,40,115,116,97,114,116,41,41,41,13,10,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,115,
-  116,97,114,116,32,48,41,41,41,13,10,32,32,32,32,40,111,114,32,40,97,110,100,32,40,110,117,109,98,101,114,63,32,115,116,97,114,116,41,32,
-  40,62,61,32,115,116,97,114,116,32,48,41,41,13,10,9,40,97,110,100,32,40,112,97,105,114,63,32,115,116,97,114,116,41,13,10,9,32,32,32,
-  32,32,40,100,111,32,40,40,116,97,105,108,32,115,116,97,114,116,32,40,99,100,114,32,116,97,105,108,41,41,41,13,10,9,9,32,40,40,110,117,
-  108,108,63,32,116,97,105,108,41,32,35,116,41,13,10,9,32,32,32,32,32,32,32,40,105,102,32,40,111,114,32,40,110,111,116,32,40,110,117,109,
-  98,101,114,63,32,40,99,97,114,32,116,97,105,108,41,41,41,13,10,9,9,32,32,32,32,32,32,32,40,60,32,40,99,97,114,32,116,97,105,108,
-  41,32,48,41,41,13,10,9,9,32,32,32,40,101,114,114,111,114,32,34,126,83,32,105,115,32,110,111,116,32,97,32,112,114,111,99,101,115,115,32,
-  115,116,97,114,116,32,116,105,109,101,32,102,111,114,32,115,112,114,111,117,116,34,13,10,9,9,9,32,32,40,99,97,114,32,116,97,105,108,41,41,
-  41,41,41,13,10,9,40,101,114,114,111,114,32,34,126,83,32,105,115,32,110,111,116,32,97,32,112,114,111,99,101,115,115,32,115,116,97,114,116,32,
-  116,105,109,101,32,102,111,114,32,115,112,114,111,117,116,34,32,115,116,97,114,116,41,41,13,10,32,32,32,32,59,59,32,109,97,107,101,32,115,117,
-  114,101,32,97,108,108,32,105,100,115,32,97,114,101,32,105,110,116,101,103,101,114,115,13,10,32,32,32,32,40,111,114,32,40,111,114,32,40,105,110,
-  116,101,103,101,114,63,32,105,100,41,32,40,115,116,114,105,110,103,63,32,105,100,41,41,13,10,9,40,97,110,100,32,40,112,97,105,114,63,32,105,
-  100,41,13,10,9,32,32,32,32,32,40,100,111,32,40,40,116,97,105,108,32,105,100,32,40,99,100,114,32,116,97,105,108,41,41,41,13,10,9,9,
-  32,40,40,110,117,108,108,63,32,116,97,105,108,41,32,35,116,41,13,10,9,32,32,32,32,32,32,32,40,105,102,32,40,110,111,116,32,40,111,114,
-  32,40,105,110,116,101,103,101,114,63,32,40,99,97,114,32,116,97,105,108,41,41,32,40,115,116,114,105,110,103,63,32,40,99,97,114,32,116,97,105,
-  108,41,41,41,41,13,10,9,9,32,32,32,40,101,114,114,111,114,32,34,126,83,32,105,115,32,110,111,116,32,97,32,112,114,111,99,101,115,115,32,
-  105,100,32,102,111,114,32,115,112,114,111,117,116,34,13,10,9,9,9,32,32,40,99,97,114,32,116,97,105,108,41,41,41,41,41,13,10,9,40,101,
-  114,114,111,114,32,34,126,83,32,105,115,32,110,111,116,32,97,32,112,114,111,99,101,115,115,32,105,100,34,32,105,100,41,41,13,10,32,32,32,32,
-  59,59,109,97,107,101,32,115,117,114,101,32,109,101,116,114,111,32,105,115,32,97,32,118,97,108,105,100,32,109,101,116,114,111,110,111,109,101,13,10,
-  32,32,32,32,40,105,102,32,40,110,111,116,32,40,109,101,116,114,111,63,32,109,101,116,114,111,41,41,13,10,32,32,32,32,32,32,32,32,40,101,
-  114,114,111,114,32,34,109,101,116,114,111,32,126,83,32,105,115,32,110,111,116,32,97,32,118,97,108,105,100,32,109,101,116,114,111,110,111,109,101,46,
-  34,32,109,101,116,114,111,41,41,13,10,32,32,32,32,59,59,109,97,107,101,32,115,117,114,101,32,115,116,97,114,116,66,101,97,116,32,105,115,32,
-  97,32,112,111,115,105,116,105,118,101,32,110,117,109,98,101,114,13,10,32,32,32,32,40,105,102,32,40,110,111,116,32,40,111,114,32,40,110,117,109,
-  98,101,114,63,32,115,116,97,114,116,66,101,97,116,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,62,61,32,48,32,
-  115,116,97,114,116,66,101,97,116,41,41,41,13,10,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,126,83,32,105,115,32,110,111,116,32,
-  97,32,118,97,108,105,100,32,115,116,97,114,116,32,98,101,97,116,34,32,115,116,97,114,116,66,101,97,116,41,41,13,10,32,32,32,32,59,59,32,
-  111,112,101,110,32,111,117,116,112,117,116,32,102,105,108,101,32,111,114,32,115,105,103,110,97,108,32,101,114,114,111,114,13,10,32,32,32,32,40,105,
-  102,32,102,105,108,101,32,40,97,112,112,108,121,32,111,112,101,110,45,102,105,108,101,32,102,105,108,101,32,97,114,103,115,41,41,13,10,32,32,32,
-  32,40,105,102,32,42,115,112,114,111,117,116,45,104,111,111,107,42,32,40,42,115,112,114,111,117,116,45,104,111,111,107,42,32,102,105,108,101,41,41,
-  13,10,32,32,32,32,59,59,32,101,118,101,114,121,116,104,105,110,103,32,111,107,44,32,100,111,32,112,114,111,99,101,115,115,32,115,112,114,111,117,
-  116,105,110,103,33,13,10,32,32,32,32,40,108,101,116,32,40,40,110,101,120,116,115,116,97,114,116,13,10,9,32,32,32,40,108,97,109,98,100,97,
-  32,40,41,13,10,9,32,32,32,32,32,40,105,102,32,40,112,97,105,114,63,32,115,116,97,114,116,41,13,10,9,9,32,40,108,101,116,32,40,40,
-  118,32,40,99,97,114,32,115,116,97,114,116,41,41,41,13,10,9,9,32,32,32,40,115,101,116,33,32,115,116,97,114,116,32,40,105,102,32,40,110,
-  117,108,108,63,32,40,99,100,114,32,115,116,97,114,116,41,41,13,10,9,9,9,9,32,32,32,40,99,97,114,32,115,116,97,114,116,41,32,40,99,
-  100,114,32,115,116,97,114,116,41,41,41,13,10,9,9,32,32,32,118,41,13,10,9,9,32,115,116,97,114,116,41,41,41,13,10,9,32,32,40,110,
-  101,120,116,105,100,32,13,10,9,32,32,32,40,108,97,109,98,100,97,32,40,41,13,10,9,32,32,32,32,32,40,105,102,32,40,112,97,105,114,63,
-  32,105,100,41,13,10,9,9,32,40,108,101,116,32,40,40,118,32,40,99,97,114,32,105,100,41,41,41,13,10,9,9,32,32,32,40,115,101,116,33,
-  32,105,100,32,40,105,102,32,40,110,117,108,108,63,32,40,99,100,114,32,105,100,41,41,13,10,9,9,9,9,40,99,97,114,32,105,100,41,32,40,
-  99,100,114,32,105,100,41,41,41,13,10,9,9,32,32,32,118,41,13,10,9,9,32,105,100,41,41,41,41,13,10,32,32,32,32,32,32,40,105,102,
-  32,40,112,97,105,114,63,32,112,114,111,99,41,13,10,9,32,32,40,100,111,32,40,40,112,32,112,114,111,99,32,40,99,100,114,32,112,41,41,41,
-  13,10,9,32,32,32,32,32,32,40,40,110,117,108,108,63,32,112,41,32,112,114,111,99,41,13,10,9,32,32,32,32,40,102,102,105,95,115,99,104,
-  101,100,95,115,112,114,111,117,116,32,40,99,97,114,32,112,41,32,40,110,101,120,116,115,116,97,114,116,41,13,10,9,9,9,32,32,32,32,32,32,
-  40,115,116,114,105,110,103,45,104,97,115,104,32,40,110,101,120,116,105,100,41,41,32,109,101,116,114,111,32,115,116,97,114,116,66,101,97,116,41,41,
-  13,10,9,32,32,40,102,102,105,95,115,99,104,101,100,95,115,112,114,111,117,116,32,112,114,111,99,32,40,110,101,120,116,115,116,97,114,116,41,32,
-  40,115,116,114,105,110,103,45,104,97,115,104,32,40,110,101,120,116,105,100,41,41,32,109,101,116,114,111,32,115,116,97,114,116,66,101,97,116,41,41,
-  13,10,32,32,32,32,32,32,40,118,111,105,100,41,41,41,41,13,10,13,10,40,100,101,102,105,110,101,32,40,110,111,119,41,13,10,32,32,40,102,
-  102,105,95,110,111,119,41,41,13,10,13,10,59,40,100,101,102,105,110,101,32,40,115,99,111,114,101,45,116,105,109,101,41,13,10,59,32,32,40,102,
-  102,105,95,115,99,111,114,101,95,116,105,109,101,32,41,41,13,10,59,13,10,59,40,100,101,102,105,110,101,32,40,115,99,111,114,101,45,109,111,100,
-  101,63,32,41,13,10,59,32,32,40,102,102,105,95,115,99,111,114,101,95,109,111,100,101,95,112,41,41,13,10,13,10,40,100,101,102,105,110,101,32,
-  40,112,97,117,115,101,32,41,13,10,32,32,40,102,102,105,95,115,99,104,101,100,95,112,97,117,115,101,32,41,41,13,10,13,10,40,100,101,102,105,
-  110,101,32,40,112,97,117,115,101,100,63,32,41,13,10,32,32,40,102,102,105,95,115,99,104,101,100,95,112,97,117,115,101,100,95,112,41,41,13,10,
-  13,10,40,100,101,102,105,110,101,32,40,99,111,110,116,105,110,117,101,32,41,13,10,32,32,40,102,102,105,95,115,99,104,101,100,95,99,111,110,116,
-  105,110,117,101,32,41,41,13,10,13,10,59,40,100,101,102,105,110,101,32,40,115,116,111,112,32,46,32,112,114,111,99,105,100,41,13,10,59,32,32,
-  40,108,101,116,32,40,40,105,100,32,45,49,41,41,13,10,59,32,32,40,105,102,32,40,110,117,108,108,63,32,112,114,111,99,105,100,41,13,10,59,
-  32,32,32,32,32,32,40,102,102,105,95,115,99,104,101,100,95,115,116,111,112,32,105,100,41,13,10,59,32,32,32,32,32,32,40,100,111,32,40,40,
-  116,97,105,108,32,112,114,111,99,105,100,32,40,99,100,114,32,116,97,105,108,41,41,41,13,10,59,32,32,32,32,32,32,32,9,32,32,40,40,110,
-  117,108,108,63,32,116,97,105,108,41,32,35,102,41,13,10,59,32,32,32,32,32,32,32,32,40,115,101,116,33,32,105,100,32,40,99,97,114,32,116,
-  97,105,108,41,41,13,10,59,32,32,32,32,32,32,32,9,40,105,102,32,40,102,105,120,110,117,109,63,32,105,100,41,13,10,59,32,32,32,32,32,
-  9,32,32,32,32,40,102,102,105,95,115,99,104,101,100,95,115,116,111,112,32,105,100,41,13,10,59,32,32,32,32,32,9,32,32,32,32,40,101,114,
-  114,111,114,32,34,126,83,32,105,115,32,110,111,116,32,97,32,112,114,111,99,101,115,115,32,105,100,34,32,105,100,41,41,41,41,13,10,59,32,32,
-  40,118,111,105,100,41,41,41,13,10,13,10,59,105,102,32,121,111,117,32,99,97,108,108,32,115,116,111,112,40,41,44,32,105,116,32,119,105,108,108,
-  32,115,116,111,112,32,101,118,101,114,121,116,104,105,110,103,13,10,59,105,102,32,121,111,117,32,99,97,108,108,32,115,116,111,112,40,41,32,119,105,
-  116,104,32,97,32,117,115,101,114,32,73,68,44,32,105,116,32,119,105,108,108,32,115,116,111,112,32,116,104,97,116,32,105,100,32,112,114,111,99,13,
-  10,59,105,102,32,121,111,117,32,99,97,108,108,32,115,116,111,112,40,41,32,119,105,116,104,32,48,32,97,115,32,116,104,101,32,73,68,44,32,105,
-  116,32,119,105,108,108,32,115,116,111,112,32,97,108,108,32,100,101,102,97,117,108,116,32,112,114,111,99,101,115,115,101,115,13,10,13,10,40,100,101,
-  102,105,110,101,42,32,40,115,116,111,112,32,46,32,112,114,111,99,105,100,41,13,10,32,32,40,108,101,116,32,40,40,105,100,32,48,41,41,32,32,
-  13,10,32,32,32,32,40,105,102,32,40,110,117,108,108,63,32,112,114,111,99,105,100,41,13,10,32,32,32,32,32,32,32,32,40,102,102,105,95,115,
-  99,104,101,100,95,115,116,111,112,95,97,108,108,41,13,10,32,32,32,32,32,32,32,32,40,100,111,32,40,40,116,97,105,108,32,112,114,111,99,105,
-  100,32,40,99,100,114,32,116,97,105,108,41,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,40,40,110,117,108,108,63,32,116,97,105,108,
-  41,32,35,102,41,13,10,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,105,100,32,40,99,97,114,32,116,97,105,108,41,41,13,10,32,
-  32,32,32,32,32,32,32,32,32,40,105,102,32,40,111,114,32,40,102,105,120,110,117,109,63,32,105,100,41,32,40,115,116,114,105,110,103,63,32,105,
-  100,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,102,102,105,95,115,99,104,101,100,95,115,116,111,112,32,40,115,116,114,105,
-  110,103,45,104,97,115,104,32,105,100,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,126,83,32,105,
-  115,32,110,111,116,32,97,32,112,114,111,99,101,115,115,32,105,100,34,32,105,100,41,41,41,41,13,10,32,32,32,32,40,118,111,105,100,41,41,41,
-  13,10,32,13,10,59,40,100,101,102,105,110,101,32,40,104,117,115,104,32,41,13,10,59,32,32,40,102,102,105,95,115,99,104,101,100,95,104,117,115,
-  104,41,41,13,10,13,10,40,100,101,102,105,110,101,32,40,98,117,115,121,63,32,41,13,10,32,32,40,102,102,105,95,115,99,104,101,100,95,98,117,
-  115,121,95,112,41,41,13,10,13,10,59,59,59,13,10,59,59,59,32,109,101,116,114,111,110,111,109,101,32,102,117,110,99,116,105,111,110,115,13,10,
-  59,59,59,13,10,13,10,40,100,101,102,105,110,101,32,42,109,101,116,114,111,42,32,48,41,32,59,59,32,116,104,101,32,100,101,102,97,117,108,116,
-  32,109,101,116,114,111,44,32,105,110,105,116,105,97,108,108,121,32,115,101,116,32,116,111,32,116,104,101,32,115,121,115,116,101,109,32,109,101,116,114,
-  111,13,10,13,10,40,100,101,102,105,110,101,32,40,109,101,116,114,111,63,32,105,100,41,13,10,32,32,40,97,110,100,32,40,105,110,116,101,103,101,
-  114,63,32,105,100,41,32,40,102,102,105,95,115,99,104,101,100,95,109,101,116,114,111,95,105,100,95,118,97,108,105,100,32,105,100,41,41,41,13,10,
-  13,10,40,100,101,102,105,110,101,42,32,40,100,101,108,101,116,101,45,109,101,116,114,111,32,109,101,116,114,111,41,13,10,32,32,40,105,102,32,40,
-  110,111,116,32,40,109,101,116,114,111,63,32,109,101,116,114,111,41,41,13,10,32,32,32,32,32,32,40,101,114,114,111,114,32,34,109,101,116,114,111,
-  32,126,83,32,105,115,32,110,111,116,32,97,32,118,97,108,105,100,32,109,101,116,114,111,110,111,109,101,46,34,32,109,101,116,114,111,41,13,10,32,
-  32,32,32,32,32,40,105,102,32,40,101,113,118,63,32,109,101,116,114,111,32,48,41,13,10,32,32,32,32,32,32,32,32,32,32,40,101,114,114,111,
-  114,32,34,100,101,102,97,117,108,116,32,109,101,116,114,111,110,111,109,101,32,40,48,41,32,99,97,110,110,111,116,32,98,101,32,100,101,108,101,116,
-  101,100,46,34,41,41,41,13,10,32,32,40,102,102,105,95,115,99,104,101,100,95,100,101,108,101,116,101,95,109,101,116,114,111,32,109,101,116,114,111,
-  41,41,13,10,13,10,40,100,101,102,105,110,101,42,32,40,109,97,107,101,45,109,101,116,114,111,32,116,101,109,112,111,41,13,10,32,32,40,105,102,
-  32,40,111,114,32,40,110,111,116,32,40,110,117,109,98,101,114,63,32,116,101,109,112,111,41,41,32,40,60,61,32,116,101,109,112,111,32,48,41,41,
-  13,10,32,32,32,32,32,32,40,101,114,114,111,114,32,34,116,101,109,112,111,32,126,83,32,105,115,32,110,111,116,32,97,32,110,117,109,98,101,114,
-  32,103,114,101,97,116,101,114,32,116,104,97,110,32,48,46,34,32,116,101,109,112,111,41,41,13,10,32,32,40,102,102,105,95,115,99,104,101,100,95,
-  109,97,107,101,95,109,101,116,114,111,32,116,101,109,112,111,41,41,13,10,13,10,40,100,101,102,105,110,101,42,32,40,109,101,116,114,111,32,116,101,
-  109,112,111,32,46,32,97,114,103,115,41,13,10,32,32,40,105,102,32,40,111,114,32,40,110,111,116,32,40,110,117,109,98,101,114,63,32,116,101,109,
+  10,32,32,59,59,32,40,115,112,114,111,117,116,32,123,112,114,111,99,124,108,105,115,116,124,118,101,99,116,111,114,125,32,91,97,104,101,97,100,124,
+  108,105,115,116,124,118,101,99,116,111,114,93,32,91,105,100,124,108,105,115,116,124,118,101,99,116,111,114,124,102,105,108,101,93,32,46,46,46,41,13,
+  10,32,32,40,108,101,116,32,40,40,115,116,97,114,116,32,48,41,13,10,9,40,105,100,32,48,41,13,10,9,40,102,105,108,101,32,35,102,41,13,
+  10,32,32,32,32,32,32,32,32,40,109,101,116,114,111,32,48,41,13,10,32,32,32,32,32,32,32,32,40,115,116,97,114,116,66,101,97,116,32,48,
+  41,13,10,32,32,32,32,32,32,32,32,41,13,10,32,32,32,32,59,59,32,118,101,99,116,111,114,115,32,111,102,32,112,114,111,99,115,32,97,114,
+  101,32,115,112,114,111,117,116,101,100,32,108,105,107,101,32,108,105,115,116,115,13,10,32,32,32,32,40,105,102,32,40,118,101,99,116,111,114,63,32,
+  112,114,111,99,41,32,40,115,101,116,33,32,112,114,111,99,32,40,118,101,99,116,111,114,45,62,108,105,115,116,32,112,114,111,99,41,41,41,13,10,
+  32,32,32,32,59,59,32,112,97,114,115,101,32,97,114,103,115,32,97,110,100,32,99,104,101,99,107,32,102,111,114,32,105,108,108,101,103,97,108,32,
+  118,97,108,117,101,115,32,98,101,102,111,114,101,32,115,112,114,111,117,116,105,110,103,13,10,32,32,32,32,59,59,32,97,110,121,116,104,105,110,103,
+  46,32,102,105,114,115,116,32,109,97,107,101,32,115,117,114,101,32,97,108,108,32,112,114,111,99,115,32,97,114,101,32,114,101,97,108,108,121,32,112,
+  114,111,99,101,100,117,114,101,115,46,46,46,13,10,32,32,32,32,40,111,114,32,40,112,114,111,99,101,100,117,114,101,63,32,112,114,111,99,41,13,
+  10,9,40,97,110,100,32,40,112,97,105,114,63,32,112,114,111,99,41,13,10,9,32,32,32,32,32,40,100,111,32,40,40,116,97,105,108,32,112,114,
+  111,99,32,40,99,100,114,32,116,97,105,108,41,41,41,13,10,9,9,32,40,40,110,117,108,108,63,32,116,97,105,108,41,32,35,116,41,13,10,9,
+  32,32,32,32,32,32,32,40,105,102,32,40,110,111,116,32,40,112,114,111,99,101,100,117,114,101,63,32,40,99,97,114,32,116,97,105,108,41,41,41,
+  13,10,9,9,32,32,32,40,101,114,114,111,114,32,34,126,83,32,105,115,32,110,111,116,32,97,32,112,114,111,99,101,115,115,34,32,112,114,111,99,
+  41,41,41,41,13,10,9,40,101,114,114,111,114,32,34,126,83,32,105,115,32,110,111,116,32,97,32,112,114,111,99,101,115,115,34,32,112,114,111,99,
+  41,9,41,13,10,32,32,32,32,59,59,32,112,97,114,115,101,32,111,112,116,107,101,121,32,97,114,103,115,32,117,110,116,105,108,32,102,105,108,101,
+  32,105,110,102,111,44,32,97,108,108,111,119,32,107,101,121,32,97,114,103,115,32,102,111,114,32,115,116,97,114,116,32,97,110,100,32,105,100,13,10,
+  32,32,32,32,40,100,111,32,40,40,116,97,105,108,32,97,114,103,115,32,40,99,100,114,32,116,97,105,108,41,41,13,10,32,32,32,32,32,32,32,
+  32,32,40,107,101,121,119,32,35,102,41,32,32,59,32,116,114,117,101,32,105,102,32,101,110,99,111,117,110,116,101,114,101,100,32,107,101,121,119,111,
+  114,100,13,10,32,32,32,32,32,32,32,32,32,40,97,114,103,110,32,48,32,40,43,32,97,114,103,110,32,49,41,41,41,13,10,32,32,32,32,32,
+  32,32,32,40,40,111,114,32,40,110,117,108,108,63,32,116,97,105,108,41,32,102,105,108,101,41,13,10,32,32,32,32,32,32,32,32,32,40,115,101,
+  116,33,32,97,114,103,115,32,116,97,105,108,41,41,13,10,32,32,32,32,32,32,40,99,111,110,100,32,40,40,115,116,114,105,110,103,63,32,40,99,
+  97,114,32,116,97,105,108,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,102,105,108,101,32,40,99,97,114,32,
+  116,97,105,108,41,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,40,40,107,101,121,119,111,114,100,63,32,40,99,97,114,32,116,97,105,
+  108,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,107,101,121,119,32,35,116,41,13,10,32,32,32,32,32,32,
+  32,32,32,32,32,32,32,40,105,102,32,40,110,117,108,108,63,32,40,99,100,114,32,116,97,105,108,41,41,32,40,101,114,114,111,114,32,34,77,105,
+  115,115,105,110,103,32,97,114,103,32,118,97,108,117,101,32,102,111,114,32,126,83,34,32,40,99,97,114,32,116,97,105,108,41,41,41,13,10,32,32,
+  32,32,32,32,32,32,32,32,32,32,32,40,99,111,110,100,32,40,40,101,113,63,32,40,99,97,114,32,116,97,105,108,41,32,58,115,116,97,114,116,
+  41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,115,116,97,114,116,32,40,99,97,100,114,
+  32,116,97,105,108,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,116,97,105,108,32,
+  40,99,100,114,32,116,97,105,108,41,41,32,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,40,101,113,63,32,
+  40,99,97,114,32,116,97,105,108,41,32,58,105,100,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,115,101,
+  116,33,32,105,100,32,40,99,97,100,114,32,116,97,105,108,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+  40,115,101,116,33,32,116,97,105,108,32,40,99,100,114,32,116,97,105,108,41,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+  32,32,32,32,40,101,108,115,101,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,105,
+  110,118,97,108,105,100,32,107,101,121,119,111,114,100,58,32,126,83,34,32,40,99,97,114,32,116,97,105,108,41,41,13,10,32,32,32,32,32,32,32,
+  32,32,32,32,32,32,32,32,32,32,32,32,32,41,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,40,107,101,121,119,32,13,10,32,32,
+  32,32,32,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,101,120,112,101,99,116,101,100,32,107,101,121,32,97,114,103,32,98,117,116,32,
+  103,111,116,32,126,83,32,105,110,115,116,101,97,100,34,32,40,99,97,114,32,116,97,105,108,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,
+  32,32,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,40,40,61,32,97,114,103,110,32,48,41,13,10,32,32,32,32,32,32,32,32,32,32,
+  32,32,32,40,115,101,116,33,32,115,116,97,114,116,32,40,99,97,114,32,116,97,105,108,41,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,
+  32,40,40,61,32,97,114,103,110,32,49,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,105,100,32,40,99,97,114,
+  32,116,97,105,108,41,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,40,101,108,115,101,13,10,32,32,32,32,32,32,32,32,32,32,32,
+  32,32,40,101,114,114,111,114,32,34,105,108,108,101,103,97,108,32,115,112,114,111,117,116,32,97,114,103,117,109,101,110,116,115,32,126,83,34,32,97,
+  114,103,115,41,41,41,41,13,10,13,10,32,32,32,32,40,105,102,32,40,118,101,99,116,111,114,63,32,115,116,97,114,116,41,32,40,115,101,116,33,
+  32,115,116,97,114,116,32,40,118,101,99,116,111,114,45,62,108,105,115,116,32,115,116,97,114,116,41,41,41,13,10,32,32,32,32,40,105,102,32,40,
+  118,101,99,116,111,114,63,32,105,100,41,32,40,115,101,116,33,32,105,100,32,40,118,101,99,116,111,114,45,62,108,105,115,116,32,105,100,41,41,41,
+  13,10,32,32,32,32,59,59,32,109,97,107,101,32,115,117,114,101,32,97,108,108,32,115,116,97,114,116,115,32,97,114,101,32,118,97,108,105,100,32,
+  115,116,97,114,116,32,116,105,109,101,115,46,46,46,13,10,32,32,32,32,40,105,102,32,40,112,114,111,99,101,100,117,114,101,63,32,115,116,97,114,
+  116,41,13,10,32,32,32,32,32,32,32,32,40,98,101,103,105,110,13,10,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,115,116,97,114,
+  116,66,101,97,116,32,40,99,97,114,32,40,115,116,97,114,116,41,41,41,13,10,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,109,101,
+  116,114,111,32,40,99,97,100,114,32,40,115,116,97,114,116,41,41,41,13,10,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,115,116,97,
+  114,116,32,48,41,41,41,13,10,32,32,32,32,40,111,114,32,40,97,110,100,32,40,110,117,109,98,101,114,63,32,115,116,97,114,116,41,32,40,62,
+  61,32,115,116,97,114,116,32,48,41,41,13,10,9,40,97,110,100,32,40,112,97,105,114,63,32,115,116,97,114,116,41,13,10,9,32,32,32,32,32,
+  40,100,111,32,40,40,116,97,105,108,32,115,116,97,114,116,32,40,99,100,114,32,116,97,105,108,41,41,41,13,10,9,9,32,40,40,110,117,108,108,
+  63,32,116,97,105,108,41,32,35,116,41,13,10,9,32,32,32,32,32,32,32,40,105,102,32,40,111,114,32,40,110,111,116,32,40,110,117,109,98,101,
+  114,63,32,40,99,97,114,32,116,97,105,108,41,41,41,13,10,9,9,32,32,32,32,32,32,32,40,60,32,40,99,97,114,32,116,97,105,108,41,32,
+  48,41,41,13,10,9,9,32,32,32,40,101,114,114,111,114,32,34,126,83,32,105,115,32,110,111,116,32,97,32,112,114,111,99,101,115,115,32,115,116,
+  97,114,116,32,116,105,109,101,32,102,111,114,32,115,112,114,111,117,116,34,13,10,9,9,9,32,32,40,99,97,114,32,116,97,105,108,41,41,41,41,
+  41,13,10,9,40,101,114,114,111,114,32,34,126,83,32,105,115,32,110,111,116,32,97,32,112,114,111,99,101,115,115,32,115,116,97,114,116,32,116,105,
+  109,101,32,102,111,114,32,115,112,114,111,117,116,34,32,115,116,97,114,116,41,41,13,10,32,32,32,32,59,59,32,109,97,107,101,32,115,117,114,101,
+  32,97,108,108,32,105,100,115,32,97,114,101,32,105,110,116,101,103,101,114,115,13,10,32,32,32,32,40,111,114,32,40,111,114,32,40,105,110,116,101,
+  103,101,114,63,32,105,100,41,32,40,115,116,114,105,110,103,63,32,105,100,41,41,13,10,9,40,97,110,100,32,40,112,97,105,114,63,32,105,100,41,
+  13,10,9,32,32,32,32,32,40,100,111,32,40,40,116,97,105,108,32,105,100,32,40,99,100,114,32,116,97,105,108,41,41,41,13,10,9,9,32,40,
+  40,110,117,108,108,63,32,116,97,105,108,41,32,35,116,41,13,10,9,32,32,32,32,32,32,32,40,105,102,32,40,110,111,116,32,40,111,114,32,40,
+  105,110,116,101,103,101,114,63,32,40,99,97,114,32,116,97,105,108,41,41,32,40,115,116,114,105,110,103,63,32,40,99,97,114,32,116,97,105,108,41,
+  41,41,41,13,10,9,9,32,32,32,40,101,114,114,111,114,32,34,126,83,32,105,115,32,110,111,116,32,97,32,112,114,111,99,101,115,115,32,105,100,
+  32,102,111,114,32,115,112,114,111,117,116,34,13,10,9,9,9,32,32,40,99,97,114,32,116,97,105,108,41,41,41,41,41,13,10,9,40,101,114,114,
+  111,114,32,34,126,83,32,105,115,32,110,111,116,32,97,32,112,114,111,99,101,115,115,32,105,100,34,32,105,100,41,41,13,10,32,32,32,32,59,59,
+  109,97,107,101,32,115,117,114,101,32,109,101,116,114,111,32,105,115,32,97,32,118,97,108,105,100,32,109,101,116,114,111,110,111,109,101,13,10,32,32,
+  32,32,40,105,102,32,40,110,111,116,32,40,109,101,116,114,111,63,32,109,101,116,114,111,41,41,13,10,32,32,32,32,32,32,32,32,40,101,114,114,
+  111,114,32,34,109,101,116,114,111,32,126,83,32,105,115,32,110,111,116,32,97,32,118,97,108,105,100,32,109,101,116,114,111,110,111,109,101,46,34,32,
+  109,101,116,114,111,41,41,13,10,32,32,32,32,59,59,109,97,107,101,32,115,117,114,101,32,115,116,97,114,116,66,101,97,116,32,105,115,32,97,32,
+  112,111,115,105,116,105,118,101,32,110,117,109,98,101,114,13,10,32,32,32,32,40,105,102,32,40,110,111,116,32,40,111,114,32,40,110,117,109,98,101,
+  114,63,32,115,116,97,114,116,66,101,97,116,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,62,61,32,48,32,115,116,
+  97,114,116,66,101,97,116,41,41,41,13,10,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,126,83,32,105,115,32,110,111,116,32,97,32,
+  118,97,108,105,100,32,115,116,97,114,116,32,98,101,97,116,34,32,115,116,97,114,116,66,101,97,116,41,41,13,10,32,32,32,32,59,59,32,111,112,
+  101,110,32,111,117,116,112,117,116,32,102,105,108,101,32,111,114,32,115,105,103,110,97,108,32,101,114,114,111,114,13,10,32,32,32,32,40,105,102,32,
+  102,105,108,101,32,40,97,112,112,108,121,32,111,112,101,110,45,102,105,108,101,32,102,105,108,101,32,97,114,103,115,41,41,13,10,32,32,32,32,40,
+  105,102,32,42,115,112,114,111,117,116,45,104,111,111,107,42,32,40,42,115,112,114,111,117,116,45,104,111,111,107,42,32,102,105,108,101,41,41,13,10,
+  32,32,32,32,59,59,32,101,118,101,114,121,116,104,105,110,103,32,111,107,44,32,100,111,32,112,114,111,99,101,115,115,32,115,112,114,111,117,116,105,
+  110,103,33,32,97,32,108,105,115,116,32,111,102,32,112,114,111,99,115,32,105,115,13,10,32,32,32,32,59,59,32,115,112,114,111,117,116,101,100,32,
+  105,110,32,111,110,101,32,98,97,116,99,104,44,32,115,104,111,114,116,32,115,116,97,114,116,32,97,110,100,32,105,100,32,108,105,115,116,115,32,114,
+  101,112,101,97,116,32,116,104,101,105,114,13,10,32,32,32,32,59,59,32,108,97,115,116,32,118,97,108,117,101,46,13,10,32,32,32,32,40,105,102,
+  32,40,112,97,105,114,63,32,112,114,111,99,41,13,10,32,32,32,32,32,32,32,32,40,102,102,105,95,115,99,104,101,100,95,115,112,114,111,117,116,
+  95,108,105,115,116,32,112,114,111,99,32,115,116,97,114,116,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+  32,32,32,32,32,32,32,32,32,40,105,102,32,40,112,97,105,114,63,32,105,100,41,32,40,109,97,112,32,115,116,114,105,110,103,45,104,97,115,104,
+  32,105,100,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+  32,40,115,116,114,105,110,103,45,104,97,115,104,32,105,100,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+  32,32,32,32,32,32,32,32,32,32,32,109,101,116,114,111,32,115,116,97,114,116,66,101,97,116,41,13,10,32,32,32,32,32,32,32,32,40,102,102,
+  105,95,115,99,104,101,100,95,115,112,114,111,117,116,32,112,114,111,99,32,40,105,102,32,40,112,97,105,114,63,32,115,116,97,114,116,41,32,40,99,
+  97,114,32,115,116,97,114,116,41,32,115,116,97,114,116,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+  32,32,32,32,40,115,116,114,105,110,103,45,104,97,115,104,32,40,105,102,32,40,112,97,105,114,63,32,105,100,41,32,40,99,97,114,32,105,100,41,
+  32,105,100,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,109,101,116,114,111,32,115,
+  116,97,114,116,66,101,97,116,41,41,13,10,32,32,32,32,40,118,111,105,100,41,41,41,13,10,13,10,40,100,101,102,105,110,101,32,40,110,111,119,
+  41,13,10,32,32,40,102,102,105,95,110,111,119,41,41,13,10,13,10,59,40,100,101,102,105,110,101,32,40,115,99,111,114,101,45,116,105,109,101,41,
+  13,10,59,32,32,40,102,102,105,95,115,99,111,114,101,95,116,105,109,101,32,41,41,13,10,59,13,10,59,40,100,101,102,105,110,101,32,40,115,99,
+  111,114,101,45,109,111,100,101,63,32,41,13,10,59,32,32,40,102,102,105,95,115,99,111,114,101,95,109,111,100,101,95,112,41,41,13,10,13,10,40,
+  100,101,102,105,110,101,32,40,112,97,117,115,101,32,41,13,10,32,32,40,102,102,105,95,115,99,104,101,100,95,112,97,117,115,101,32,41,41,13,10,
+  13,10,40,100,101,102,105,110,101,32,40,112,97,117,115,101,100,63,32,41,13,10,32,32,40,102,102,105,95,115,99,104,101,100,95,112,97,117,115,101,
+  100,95,112,41,41,13,10,13,10,40,100,101,102,105,110,101,32,40,99,111,110,116,105,110,117,101,32,41,13,10,32,32,40,102,102,105,95,115,99,104,
+  101,100,95,99,111,110,116,105,110,117,101,32,41,41,13,10,13,10,59,40,100,101,102,105,110,101,32,40,115,116,111,112,32,46,32,112,114,111,99,105,
+  100,41,13,10,59,32,32,40,108,101,116,32,40,40,105,100,32,45,49,41,41,13,10,59,32,32,40,105,102,32,40,110,117,108,108,63,32,112,114,111,
+  99,105,100,41,13,10,59,32,32,32,32,32,32,40,102,102,105,95,115,99,104,101,100,95,115,116,111,112,32,105,100,41,13,10,59,32,32,32,32,32,
+  32,40,100,111,32,40,40,116,97,105,108,32,112,114,111,99,105,100,32,40,99,100,114,32,116,97,105,108,41,41,41,13,10,59,32,32,32,32,32,32,
+  32,9,32,32,40,40,110,117,108,108,63,32,116,97,105,108,41,32,35,102,41,13,10,59,32,32,32,32,32,32,32,32,40,115,101,116,33,32,105,100,
+  32,40,99,97,114,32,116,97,105,108,41,41,13,10,59,32,32,32,32,32,32,32,9,40,105,102,32,40,102,105,120,110,117,109,63,32,105,100,41,13,
+  10,59,32,32,32,32,32,9,32,32,32,32,40,102,102,105,95,115,99,104,101,100,95,115,116,111,112,32,105,100,41,13,10,59,32,32,32,32,32,9,
+  32,32,32,32,40,101,114,114,111,114,32,34,126,83,32,105,115,32,110,111,116,32,97,32,112,114,111,99,101,115,115,32,105,100,34,32,105,100,41,41,
+  41,41,13,10,59,32,32,40,118,111,105,100,41,41,41,13,10,13,10,59,105,102,32,121,111,117,32,99,97,108,108,32,115,116,111,112,40,41,44,32,
+  105,116,32,119,105,108,108,32,115,116,111,112,32,101,118,101,114,121,116,104,105,110,103,13,10,59,105,102,32,121,111,117,32,99,97,108,108,32,115,116,
+  111,112,40,41,32,119,105,116,104,32,97,32,117,115,101,114,32,73,68,44,32,105,116,32,119,105,108,108,32,115,116,111,112,32,116,104,97,116,32,105,
+  100,32,112,114,111,99,13,10,59,105,102,32,121,111,117,32,99,97,108,108,32,115,116,111,112,40,41,32,119,105,116,104,32,48,32,97,115,32,116,104,
+  101,32,73,68,44,32,105,116,32,119,105,108,108,32,115,116,111,112,32,97,108,108,32,100,101,102,97,117,108,116,32,112,114,111,99,101,115,115,101,115,
+  13,10,13,10,40,100,101,102,105,110,101,42,32,40,115,116,111,112,32,46,32,112,114,111,99,105,100,41,13,10,32,32,40,108,101,116,32,40,40,105,
+  100,32,48,41,41,32,32,13,10,32,32,32,32,40,105,102,32,40,110,117,108,108,63,32,112,114,111,99,105,100,41,13,10,32,32,32,32,32,32,32,
+  32,40,102,102,105,95,115,99,104,101,100,95,115,116,111,112,95,97,108,108,41,13,10,32,32,32,32,32,32,32,32,40,100,111,32,40,40,116,97,105,
+  108,32,112,114,111,99,105,100,32,40,99,100,114,32,116,97,105,108,41,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,40,40,110,117,108,
+  108,63,32,116,97,105,108,41,32,35,102,41,13,10,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,105,100,32,40,99,97,114,32,116,97,
+  105,108,41,41,13,10,32,32,32,32,32,32,32,32,32,32,40,105,102,32,40,111,114,32,40,102,105,120,110,117,109,63,32,105,100,41,32,40,115,116,
+  114,105,110,103,63,32,105,100,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,102,102,105,95,115,99,104,101,100,95,115,116,111,
+  112,32,40,115,116,114,105,110,103,45,104,97,115,104,32,105,100,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,101,114,114,111,
+  114,32,34,126,83,32,105,115,32,110,111,116,32,97,32,112,114,111,99,101,115,115,32,105,100,34,32,105,100,41,41,41,41,13,10,32,32,32,32,40,
+  118,111,105,100,41,41,41,13,10,32,13,10,59,40,100,101,102,105,110,101,32,40,104,117,115,104,32,41,13,10,59,32,32,40,102,102,105,95,115,99,
+  104,101,100,95,104,117,115,104,41,41,13,10,13,10,40,100,101,102,105,110,101,32,40,98,117,115,121,63,32,41,13,10,32,32,40,102,102,105,95,115,
+  99,104,101,100,95,98,117,115,121,95,112,41,41,13,10,13,10,59,59,32,115,99,104,101,100,117,108,101,114,45,115,116,97,116,115,32,114,101,116,117,
+  114,110,115,32,116,105,109,105,110,103,32,115,116,97,116,105,115,116,105,99,115,32,102,111,114,32,116,104,101,32,115,99,104,101,100,117,108,101,114,32,
+  97,110,100,13,10,59,59,32,109,105,100,105,32,111,117,116,112,117,116,32,116,104,114,101,97,100,115,58,32,40,40,115,99,104,101,109,101,32,40,100,
+  105,115,112,97,116,99,104,101,100,32,46,32,110,41,32,46,46,46,41,32,40,109,105,100,105,45,111,117,116,32,46,46,46,41,13,10,59,59,32,40,
+  115,99,104,101,109,101,45,110,111,100,101,115,32,46,46,46,41,32,40,109,105,100,105,45,110,111,100,101,115,32,46,46,46,41,41,46,32,101,118,101,
+  114,121,32,109,105,100,105,32,111,117,116,112,117,116,32,112,111,114,116,32,116,104,97,116,13,10,59,59,32,104,97,115,32,98,101,101,110,32,111,112,
+  101,110,101,100,32,104,97,115,32,105,116,115,32,111,119,110,32,101,110,116,114,121,32,97,102,116,101,114,32,109,105,100,105,45,111,117,116,58,32,109,
+  105,100,105,45,111,117,116,45,49,44,13,10,59,59,32,109,105,100,105,45,111,117,116,45,50,32,97,110,100,32,115,111,32,111,110,46,32,108,97,116,
+  101,110,101,115,115,44,32,106,105,116,116,101,114,32,97,110,100,32,99,97,108,108,98,97,99,107,13,10,59,59,32,116,105,109,101,115,32,97,114,101,
+  32,105,110,32,109,105,108,108,105,115,101,99,111,110,100,115,44,32,114,97,116,101,32,105,115,32,101,118,101,110,116,115,32,100,105,115,112,97,116,99,
+  104,101,100,32,112,101,114,32,115,101,99,111,110,100,44,13,10,59,59,32,113,117,101,117,101,45,100,101,112,116,104,32,105,115,32,116,104,101,32,110,
+  117,109,98,101,114,32,111,102,32,101,118,101,110,116,115,32,119,97,105,116,105,110,103,32,97,110,100,32,108,111,97,100,32,105,115,32,116,104,101,13,
+  10,59,59,32,112,101,114,99,101,110,116,97,103,101,32,111,102,32,116,105,109,101,32,116,104,101,32,116,104,114,101,97,100,32,119,97,115,32,97,119,
+  97,107,101,46,32,116,104,101,32,104,105,115,116,111,103,114,97,109,115,32,97,114,101,32,108,105,115,116,115,13,10,59,59,32,111,102,32,40,98,111,
+  117,110,100,32,46,32,99,111,117,110,116,41,32,119,104,101,114,101,32,98,111,117,110,100,32,105,115,32,116,104,101,32,98,117,99,107,101,116,39,115,
+  32,117,112,112,101,114,32,108,105,109,105,116,32,105,110,13,10,59,59,32,109,105,108,108,105,115,101,99,111,110,100,115,32,97,110,100,32,35,116,32,
+  109,97,114,107,115,32,116,104,101,32,108,97,115,116,44,32,111,112,101,110,32,101,110,100,101,100,32,98,117,99,107,101,116,46,32,102,111,114,32,116,
+  104,101,13,10,59,59,32,115,99,104,101,109,101,32,116,104,114,101,97,100,32,99,97,108,108,98,97,99,107,32,116,105,109,101,115,32,97,114,101,32,
+  102,111,114,32,112,114,111,99,101,115,115,101,115,32,97,110,100,32,109,105,100,105,32,97,110,100,32,111,115,99,13,10,59,59,32,104,111,111,107,115,
+  44,32,102,111,114,32,109,105,100,105,45,111,117,116,32,116,104,101,121,32,97,114,101,32,116,104,101,32,116,105,109,101,32,115,112,101,110,116,32,115,
+  101,110,100,105,110,103,32,116,111,32,116,104,101,32,100,101,118,105,99,101,46,13,10,59,59,32,116,104,101,32,110,111,100,101,32,112,111,111,108,32,
+  101,110,116,114,105,101,115,32,103,105,118,101,32,116,104,101,32,112,111,111,108,39,115,32,99,97,112,97,99,105,116,121,44,32,110,111,100,101,115,32,
+  105,110,32,117,115,101,44,13,10,59,59,32,104,105,103,104,45,119,97,116,101,114,32,109,97,114,107,32,97,110,100,32,110,117,109,98,101,114,32,111,
+  102,32,97,108,108,111,99,97,116,105,111,110,115,32,116,104,97,116,32,111,118,101,114,102,108,111,119,101,100,32,116,111,32,116,104,101,13,10,59,59,
+  32,104,101,97,112,46,32,105,102,32,114,101,115,101,116,32,105,115,32,116,114,117,101,32,116,104,101,32,116,105,109,105,110,103,32,115,116,97,116,105,
+  115,116,105,99,115,32,97,114,101,32,99,108,101,97,114,101,100,32,97,102,116,101,114,13,10,59,59,32,116,104,101,121,32,97,114,101,32,114,101,116,
+  117,114,110,101,100,46,13,10,13,10,40,100,101,102,105,110,101,42,32,40,115,99,104,101,100,117,108,101,114,45,115,116,97,116,115,32,40,114,101,115,
+  101,116,32,35,102,41,41,13,10,32,32,40,102,102,105,95,115,99,104,101,100,95,115,116,97,116,115,32,114,101,115,101,116,41,41,13,10,13,10,59,
+  59,32,115,99,104,101,100,117,108,101,114,45,115,112,105,110,32,115,101,116,115,32,116,104,101,32,110,117,109,98,101,114,32,111,102,32,109,105,108,108,
+  105,115,101,99,111,110,100,115,32,116,104,101,32,115,99,104,101,100,117,108,101,114,32,97,110,100,13,10,59,59,32,109,105,100,105,32,111,117,116,112,
+  117,116,32,116,104,114,101,97,100,115,32,98,117,115,121,45,119,97,105,116,32,98,101,102,111,114,101,32,101,97,99,104,32,100,101,97,100,108,105,110,
+  101,32,105,110,115,116,101,97,100,32,111,102,13,10,59,59,32,115,108,101,101,112,105,110,103,46,32,48,32,40,116,104,101,32,100,101,102,97,117,108,
+  116,41,32,100,105,115,97,98,108,101,115,32,115,112,105,110,110,105,110,103,46,13,10,13,10,40,100,101,102,105,110,101,32,40,115,99,104,101,100,117,
+  108,101,114,45,115,112,105,110,32,109,115,41,13,10,32,32,40,105,102,32,40,111,114,32,40,110,111,116,32,40,114,101,97,108,63,32,109,115,41,41,
+  32,40,60,32,109,115,32,48,41,41,13,10,32,32,32,32,32,32,40,101,114,114,111,114,32,34,115,112,105,110,32,116,105,109,101,32,126,83,32,105,
+  115,32,110,111,116,32,97,32,110,117,109,98,101,114,32,62,61,32,48,46,34,32,109,115,41,41,13,10,32,32,40,102,102,105,95,115,99,104,101,100,
+  95,115,101,116,95,115,112,105,110,32,109,115,41,13,10,32,32,40,118,111,105,100,41,41,13,10,13,10,59,59,59,13,10,59,59,59,32,109,101,116,
+  114,111,110,111,109,101,32,102,117,110,99,116,105,111,110,115,13,10,59,59,59,13,10,13,10,40,100,101,102,105,110,101,32,42,109,101,116,114,111,42,
+  32,48,41,32,59,59,32,116,104,101,32,100,101,102,97,117,108,116,32,109,101,116,114,111,44,32,105,110,105,116,105,97,108,108,121,32,115,101,116,32,
+  116,111,32,116,104,101,32,115,121,115,116,101,109,32,109,101,116,114,111,13,10,13,10,40,100,101,102,105,110,101,32,40,109,101,116,114,111,63,32,105,
+  100,41,13,10,32,32,40,97,110,100,32,40,105,110,116,101,103,101,114,63,32,105,100,41,32,40,102,102,105,95,115,99,104,101,100,95,109,101,116,114,
+  111,95,105,100,95,118,97,108,105,100,32,105,100,41,41,41,13,10,13,10,40,100,101,102,105,110,101,42,32,40,100,101,108,101,116,101,45,109,101,116,
+  114,111,32,109,101,116,114,111,41,13,10,32,32,40,105,102,32,40,110,111,116,32,40,109,101,116,114,111,63,32,109,101,116,114,111,41,41,13,10,32,
+  32,32,32,32,32,40,101,114,114,111,114,32,34,109,101,116,114,111,32,126,83,32,105,115,32,110,111,116,32,97,32,118,97,108,105,100,32,109,101,116,
+  114,111,110,111,109,101,46,34,32,109,101,116,114,111,41,13,10,32,32,32,32,32,32,40,105,102,32,40,101,113,118,63,32,109,101,116,114,111,32,48,
+  41,13,10,32,32,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,100,101,102,97,117,108,116,32,109,101,116,114,111,110,111,109,101,32,40,
+  48,41,32,99,97,110,110,111,116,32,98,101,32,100,101,108,101,116,101,100,46,34,41,41,41,13,10,32,32,40,102,102,105,95,115,99,104,101,100,95,
+  100,101,108,101,116,101,95,109,101,116,114,111,32,109,101,116,114,111,41,41,13,10,13,10,40,100,101,102,105,110,101,42,32,40,109,97,107,101,45,109,
+  101,116,114,111,32,116,101,109,112,111,41,13,10,32,32,40,105,102,32,40,111,114,32,40,110,111,116,32,40,110,117,109,98,101,114,63,32,116,101,109,
   112,111,41,41,32,40,60,61,32,116,101,109,112,111,32,48,41,41,13,10,32,32,32,32,32,32,40,101,114,114,111,114,32,34,116,101,109,112,111,32,
   126,83,32,105,115,32,110,111,116,32,97,32,110,117,109,98,101,114,32,103,114,101,97,116,101,114,32,116,104,97,110,32,48,46,34,32,116,101,109,112,
-  111,41,41,32,13,10,32,32,40,119,105,116,104,45,111,112,116,107,101,121,115,32,40,97,114,103,115,32,40,115,101,99,115,32,48,41,32,40,109,101,
-  116,114,111,32,42,109,101,116,114,111,42,41,32,40,98,101,97,116,115,32,35,102,41,41,13,10,32,32,32,32,40,108,101,116,32,40,40,105,115,115,
-  101,99,115,32,35,116,41,41,13,10,59,32,32,32,32,32,32,40,105,102,32,40,62,32,115,101,99,115,32,49,48,48,48,41,13,10,59,32,32,32,
-  32,40,112,114,105,110,116,32,34,87,97,114,110,105,110,103,58,32,121,111,117,114,32,116,101,109,112,111,32,99,104,97,110,103,101,32,119,105,108,108,
-  32,111,99,99,117,114,32,111,118,101,114,32,116,104,111,117,115,97,110,100,115,32,111,102,32,115,101,99,111,110,100,115,46,13,10,59,32,32,80,101,
-  114,104,97,112,115,32,121,111,117,32,102,111,114,103,111,116,32,116,104,101,32,109,101,116,114,111,58,32,107,101,121,119,111,114,100,32,119,104,101,110,
-  32,105,110,100,105,99,97,116,105,110,103,32,121,111,117,114,32,109,101,116,114,111,63,34,41,41,13,10,32,32,32,32,32,32,40,105,102,32,98,101,
-  97,116,115,13,10,32,32,32,32,32,32,32,32,32,32,40,98,101,103,105,110,13,10,32,32,32,32,32,32,32,32,32,32,32,32,40,105,102,32,40,
-  111,114,32,40,110,111,116,32,40,110,117,109,98,101,114,63,32,98,101,97,116,115,41,41,32,40,60,32,98,101,97,116,115,32,48,41,41,13,10,32,
-  32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,98,101,97,116,115,32,126,83,32,105,115,32,110,111,116,32,97,
-  32,110,111,110,45,110,101,103,97,116,105,118,101,32,110,117,109,98,101,114,32,111,102,32,115,101,99,111,110,100,115,46,34,32,98,101,97,116,115,41,
-  41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,115,101,99,115,32,98,101,97,116,115,41,13,10,32,32,32,32,32,32,
-  32,32,32,32,32,32,40,115,101,116,33,32,105,115,115,101,99,115,32,35,102,41,41,13,10,32,32,32,32,32,32,32,32,32,32,40,105,102,32,40,
-  111,114,32,40,110,111,116,32,40,110,117,109,98,101,114,63,32,115,101,99,115,41,41,32,40,60,32,115,101,99,115,32,48,41,41,13,10,32,32,32,
-  32,32,32,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,115,101,99,115,32,126,83,32,105,115,32,110,111,116,32,97,32,110,111,110,45,
-  110,101,103,97,116,105,118,101,32,110,117,109,98,101,114,32,111,102,32,115,101,99,111,110,100,115,46,34,32,115,101,99,115,41,41,41,13,10,32,32,
-  32,32,32,32,40,105,102,32,40,110,111,116,32,40,109,101,116,114,111,63,32,109,101,116,114,111,41,41,13,10,32,32,32,32,32,32,32,32,32,32,
-  40,101,114,114,111,114,32,34,109,101,116,114,111,32,126,83,32,105,115,32,110,111,116,32,97,32,118,97,108,105,100,32,109,101,116,114,111,110,111,109,
-  101,46,34,32,109,101,116,114,111,41,41,32,32,32,13,10,32,32,32,32,32,32,40,102,102,105,95,115,99,104,101,100,95,115,101,116,95,116,101,109,
-  112,111,32,116,101,109,112,111,32,115,101,99,115,32,105,115,115,101,99,115,32,109,101,116,114,111,41,41,41,41,13,10,13,10,13,10,40,100,101,102,
-  105,110,101,42,32,40,109,101,116,114,111,45,100,117,114,32,98,101,97,116,115,32,40,109,101,116,114,111,32,42,109,101,116,114,111,42,41,41,13,10,
-  32,32,40,105,102,32,40,110,111,116,32,40,109,101,116,114,111,63,32,109,101,116,114,111,41,41,13,10,32,32,32,32,40,101,114,114,111,114,32,34,
-  109,101,116,114,111,32,126,83,32,105,115,32,110,111,116,32,97,32,118,97,108,105,100,32,109,101,116,114,111,110,111,109,101,46,34,32,109,101,116,114,
-  111,41,41,13,10,32,32,40,102,102,105,95,115,99,104,101,100,95,109,101,116,114,111,95,100,117,114,32,98,101,97,116,115,32,109,101,116,114,111,41,
-  41,13,10,13,10,40,100,101,102,105,110,101,42,32,40,109,101,116,114,111,45,98,101,97,116,32,40,109,101,116,114,111,32,42,109,101,116,114,111,42,
-  41,41,13,10,32,32,40,105,102,32,40,110,111,116,32,40,109,101,116,114,111,63,32,109,101,116,114,111,41,41,13,10,32,32,32,32,32,32,40,101,
-  114,114,111,114,32,34,109,101,116,114,111,32,126,83,32,105,115,32,110,111,116,32,97,32,118,97,108,105,100,32,109,101,116,114,111,110,111,109,101,46,
-  34,32,109,101,116,114,111,41,41,13,10,32,32,40,102,102,105,95,115,99,104,101,100,95,103,101,116,95,109,101,116,114,111,95,98,101,97,116,32,109,
-  101,116,114,111,41,41,13,10,13,10,59,59,32,116,104,105,115,32,102,117,110,99,116,105,111,110,32,119,97,115,32,111,114,105,103,105,110,97,108,108,
-  121,32,99,97,108,108,101,100,32,110,111,119,45,116,101,109,112,111,13,10,13,10,40,100,101,102,105,110,101,42,32,40,109,101,116,114,111,45,116,101,
-  109,112,111,32,40,109,101,116,114,111,32,42,109,101,116,114,111,42,41,41,13,10,32,32,40,105,102,32,40,110,111,116,32,40,109,101,116,114,111,63,
+  111,41,41,13,10,32,32,40,102,102,105,95,115,99,104,101,100,95,109,97,107,101,95,109,101,116,114,111,32,116,101,109,112,111,41,41,13,10,13,10,
+  40,100,101,102,105,110,101,42,32,40,109,101,116,114,111,32,116,101,109,112,111,32,46,32,97,114,103,115,41,13,10,32,32,40,105,102,32,40,111,114,
+  32,40,110,111,116,32,40,110,117,109,98,101,114,63,32,116,101,109,112,111,41,41,32,40,60,61,32,116,101,109,112,111,32,48,41,41,13,10,32,32,
+  32,32,32,32,40,101,114,114,111,114,32,34,116,101,109,112,111,32,126,83,32,105,115,32,110,111,116,32,97,32,110,117,109,98,101,114,32,103,114,101,
+  97,116,101,114,32,116,104,97,110,32,48,46,34,32,116,101,109,112,111,41,41,32,13,10,32,32,40,119,105,116,104,45,111,112,116,107,101,121,115,32,
+  40,97,114,103,115,32,40,115,101,99,115,32,48,41,32,40,109,101,116,114,111,32,42,109,101,116,114,111,42,41,32,40,98,101,97,116,115,32,35,102,
+  41,41,13,10,32,32,32,32,40,108,101,116,32,40,40,105,115,115,101,99,115,32,35,116,41,41,13,10,59,32,32,32,32,32,32,40,105,102,32,40,
+  62,32,115,101,99,115,32,49,48,48,48,41,13,10,59,32,32,32,32,40,112,114,105,110,116,32,34,87,97,114,110,105,110,103,58,32,121,111,117,114,
+  32,116,101,109,112,111,32,99,104,97,110,103,101,32,119,105,108,108,32,111,99,99,117,114,32,111,118,101,114,32,116,104,111,117,115,97,110,100,115,32,
+  111,102,32,115,101,99,111,110,100,115,46,13,10,59,32,32,80,101,114,104,97,112,115,32,121,111,117,32,102,111,114,103,111,116,32,116,104,101,32,109,
+  101,116,114,111,58,32,107,101,121,119,111,114,100,32,119,104,101,110,32,105,110,100,105,99,97,116,105,110,103,32,121,111,117,114,32,109,101,116,114,111,
+  63,34,41,41,13,10,32,32,32,32,32,32,40,105,102,32,98,101,97,116,115,13,10,32,32,32,32,32,32,32,32,32,32,40,98,101,103,105,110,13,
+  10,32,32,32,32,32,32,32,32,32,32,32,32,40,105,102,32,40,111,114,32,40,110,111,116,32,40,110,117,109,98,101,114,63,32,98,101,97,116,115,
+  41,41,32,40,60,32,98,101,97,116,115,32,48,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,
+  34,98,101,97,116,115,32,126,83,32,105,115,32,110,111,116,32,97,32,110,111,110,45,110,101,103,97,116,105,118,101,32,110,117,109,98,101,114,32,111,
+  102,32,115,101,99,111,110,100,115,46,34,32,98,101,97,116,115,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,115,
+  101,99,115,32,98,101,97,116,115,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,105,115,115,101,99,115,32,35,102,41,
+  41,13,10,32,32,32,32,32,32,32,32,32,32,40,105,102,32,40,111,114,32,40,110,111,116,32,40,110,117,109,98,101,114,63,32,115,101,99,115,41,
+  41,32,40,60,32,115,101,99,115,32,48,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,115,101,99,
+  115,32,126,83,32,105,115,32,110,111,116,32,97,32,110,111,110,45,110,101,103,97,116,105,118,101,32,110,117,109,98,101,114,32,111,102,32,115,101,99,
+  111,110,100,115,46,34,32,115,101,99,115,41,41,41,13,10,32,32,32,32,32,32,40,105,102,32,40,110,111,116,32,40,109,101,116,114,111,63,32,109,
+  101,116,114,111,41,41,13,10,32,32,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,109,101,116,114,111,32,126,83,32,105,115,32,110,111,
+  116,32,97,32,118,97,108,105,100,32,109,101,116,114,111,110,111,109,101,46,34,32,109,101,116,114,111,41,41,32,32,32,13,10,32,32,32,32,32,32,
+  40,102,102,105,95,115,99,104,101,100,95,115,101,116,95,116,101,109,112,111,32,116,101,109,112,111,32,115,101,99,115,32,105,115,115,101,99,115,32,109,
+  101,116,114,111,41,41,41,41,13,10,13,10,13,10,40,100,101,102,105,110,101,42,32,40,109,101,116,114,111,45,100,117,114,32,98,101,97,116,115,32,
+  40,109,101,116,114,111,32,42,109,101,116,114,111,42,41,41,13,10,32,32,40,105,102,32,40,110,111,116,32,40,109,101,116,114,111,63,32,109,101,116,
+  114,111,41,41,13,10,32,32,32,32,40,101,114,114,111,114,32,34,109,101,116,114,111,32,126,83,32,105,115,32,110,111,116,32,97,32,118,97,108,105,
+  100,32,109,101,116,114,111,110,111,109,101,46,34,32,109,101,116,114,111,41,41,13,10,32,32,40,102,102,105,95,115,99,104,101,100,95,109,101,116,114,
+  111,95,100,117,114,32,98,101,97,116,115,32,109,101,116,114,111,41,41,13,10,13,10,40,100,101,102,105,110,101,42,32,40,109,101,116,114,111,45,98,
+  101,97,116,32,40,109,101,116,114,111,32,42,109,101,116,114,111,42,41,41,13,10,32,32,40,105,102,32,40,110,111,116,32,40,109,101,116,114,111,63,
   32,109,101,116,114,111,41,41,13,10,32,32,32,32,32,32,40,101,114,114,111,114,32,34,109,101,116,114,111,32,126,83,32,105,115,32,110,111,116,32,
   97,32,118,97,108,105,100,32,109,101,116,114,111,110,111,109,101,46,34,32,109,101,116,114,111,41,41,13,10,32,32,40,102,102,105,95,115,99,104,101,
-  100,95,103,101,116,95,109,101,116,114,111,95,116,101,109,112,111,32,109,101,116,114,111,41,41,13,10,13,10,40,100,101,102,105,110,101,42,32,40,115,
-  121,110,99,32,40,97,104,101,97,100,32,49,41,32,40,109,101,116,114,111,32,42,109,101,116,114,111,42,41,41,13,10,32,32,40,105,102,32,40,60,
-  61,32,97,104,101,97,100,32,48,41,13,10,32,32,32,32,40,101,114,114,111,114,32,34,97,104,101,97,100,32,126,83,32,109,117,115,116,32,98,101,
-  32,97,32,110,117,109,98,101,114,32,103,114,101,97,116,101,114,32,116,104,97,110,32,48,46,34,32,97,104,101,97,100,41,41,13,10,32,32,40,105,
-  102,32,40,62,32,97,104,101,97,100,32,49,48,48,48,41,13,10,32,32,32,32,40,112,114,105,110,116,32,34,87,97,114,110,105,110,103,58,32,121,
-  111,117,114,32,112,114,111,99,101,115,115,32,119,105,108,108,32,115,116,97,114,116,32,102,97,114,32,105,110,116,111,32,116,104,101,32,102,117,116,117,
-  114,101,46,13,10,32,32,80,101,114,104,97,112,115,32,121,111,117,32,102,111,114,103,111,116,32,116,104,101,32,109,101,116,114,111,58,32,107,101,121,
-  119,111,114,100,32,119,104,101,110,32,105,110,100,105,99,97,116,105,110,103,32,121,111,117,114,32,109,101,116,114,111,63,34,41,41,13,10,32,32,40,
-  108,101,116,42,32,40,40,119,104,111,108,101,32,40,102,108,111,111,114,32,97,104,101,97,100,41,41,13,10,32,32,32,32,32,32,32,32,32,40,102,
-  114,97,99,116,32,40,45,32,97,104,101,97,100,32,119,104,111,108,101,41,41,41,13,10,32,32,32,32,40,108,97,109,98,100,97,40,41,13,10,32,
-  32,32,32,32,32,40,108,101,116,32,40,40,115,116,97,114,116,45,98,101,97,116,32,48,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,40,
-  99,117,114,98,101,97,116,32,40,109,101,116,114,111,45,98,101,97,116,32,109,101,116,114,111,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,
-  32,40,98,97,115,101,32,40,43,32,40,102,108,111,111,114,32,40,109,101,116,114,111,45,98,101,97,116,32,109,101,116,114,111,41,41,32,102,114,97,
-  99,116,41,41,41,13,10,32,32,32,32,32,32,32,32,40,105,102,32,40,101,113,118,63,32,48,32,119,104,111,108,101,41,32,13,10,32,32,32,32,
-  32,32,32,32,32,32,32,32,40,105,102,32,40,60,32,99,117,114,98,101,97,116,32,98,97,115,101,41,13,10,32,32,32,32,32,32,32,32,32,32,
-  32,32,32,32,40,115,101,116,33,32,115,116,97,114,116,45,98,101,97,116,32,40,102,108,111,111,114,32,99,117,114,98,101,97,116,41,41,13,10,32,
-  32,32,32,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,115,116,97,114,116,45,98,101,97,116,32,40,99,101,105,108,105,110,103,32,99,
-  117,114,98,101,97,116,41,41,41,13,10,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,115,116,97,114,116,45,98,101,97,116,32,40,42,
-  32,40,99,101,105,108,105,110,103,32,40,47,32,99,117,114,98,101,97,116,32,119,104,111,108,101,41,41,32,119,104,111,108,101,41,41,41,13,10,32,
-  32,32,32,32,32,32,32,40,108,105,115,116,32,40,43,32,115,116,97,114,116,45,98,101,97,116,32,102,114,97,99,116,41,32,109,101,116,114,111,41,
-  41,41,41,41,13,10,13,10,13,10,40,100,101,102,105,110,101,42,32,40,109,101,116,114,111,45,115,121,110,99,32,109,101,116,114,111,32,46,32,97,
-  114,103,115,41,13,10,32,32,40,119,105,116,104,45,111,112,116,107,101,121,115,32,40,97,114,103,115,32,40,98,101,97,116,115,32,49,41,32,40,116,
-  101,109,112,111,32,48,41,32,40,109,97,115,116,101,114,45,109,101,116,114,111,32,45,49,41,32,40,109,111,100,101,32,48,41,32,40,115,101,99,115,
-  32,35,102,41,41,13,10,32,32,32,32,32,40,105,102,32,40,101,113,118,63,32,48,32,40,108,97,115,116,32,40,102,102,105,95,115,99,104,101,100,
-  95,103,101,116,95,109,101,116,114,111,115,32,35,102,41,41,41,13,10,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,109,111,114,101,32,116,
-  104,97,110,32,111,110,101,32,109,101,116,114,111,110,111,109,101,32,109,117,115,116,32,101,120,105,115,116,32,105,110,32,111,114,100,101,114,32,116,111,
-  32,115,121,110,99,32,116,119,111,32,109,101,116,114,111,110,111,109,101,115,46,34,41,41,13,10,32,32,32,32,32,40,105,102,32,40,97,110,100,32,
-  40,101,113,118,63,32,109,101,116,114,111,32,42,109,101,116,114,111,42,41,32,40,101,113,118,63,32,109,97,115,116,101,114,45,109,101,116,114,111,32,
-  45,49,41,41,13,10,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,109,97,115,116,101,114,45,109,101,116,114,111,32,40,102,105,114,115,116,
-  32,40,102,102,105,95,115,99,104,101,100,95,103,101,116,95,109,101,116,114,111,115,32,35,116,41,41,41,41,13,10,32,32,32,32,32,40,105,102,32,
-  40,101,113,118,63,32,109,97,115,116,101,114,45,109,101,116,114,111,32,45,49,41,13,10,32,32,32,32,32,32,32,40,115,101,116,33,32,109,97,115,
-  116,101,114,45,109,101,116,114,111,32,42,109,101,116,114,111,42,41,41,13,10,32,32,32,32,32,40,99,111,110,100,32,40,40,60,61,32,98,101,97,
-  116,115,32,48,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,98,101,97,116,115,32,126,83,32,105,115,32,110,
-  111,116,32,97,32,110,117,109,98,101,114,32,103,114,101,97,116,101,114,32,116,104,97,110,32,48,46,34,32,98,101,97,116,115,41,41,13,10,32,32,
-  32,32,32,32,32,32,32,32,32,40,40,97,110,100,32,115,101,99,115,32,40,60,61,32,115,101,99,115,32,48,41,41,13,10,32,32,32,32,32,32,
-  32,32,32,32,32,32,40,101,114,114,111,114,32,34,115,101,99,115,32,126,83,32,109,117,115,116,32,98,101,32,97,32,112,111,115,105,116,105,118,101,
-  32,110,111,110,45,122,101,114,111,32,110,117,109,98,101,114,34,32,98,101,97,116,115,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,40,40,
-  110,111,116,32,40,109,101,116,114,111,63,32,109,101,116,114,111,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,
-  34,109,101,116,114,111,32,126,83,32,105,115,32,110,111,116,32,97,32,118,97,108,105,100,32,109,101,116,114,111,110,111,109,101,46,34,32,109,101,116,
-  114,111,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,40,40,110,111,116,32,40,109,101,116,114,111,63,32,109,97,115,116,101,114,45,109,101,
-  116,114,111,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,109,101,116,114,111,32,126,83,32,105,115,32,110,
-  111,116,32,97,32,118,97,108,105,100,32,109,101,116,114,111,110,111,109,101,46,34,32,109,97,115,116,101,114,45,109,101,116,114,111,41,41,13,10,32,
-  32,32,32,32,32,32,32,32,32,32,40,40,110,111,116,32,40,111,114,32,40,101,113,118,63,32,109,111,100,101,32,48,41,32,40,101,113,118,63,32,
-  109,111,100,101,32,49,41,32,40,101,113,118,63,32,109,111,100,101,32,45,49,41,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,40,101,
-  114,114,111,114,32,34,109,111,100,101,32,126,83,32,105,115,32,110,111,116,32,45,49,44,32,48,44,32,111,114,32,49,46,34,32,109,111,100,101,41,
-  41,13,10,32,32,32,32,32,32,32,32,32,32,32,40,40,101,113,118,63,32,109,101,116,114,111,32,109,97,115,116,101,114,45,109,101,116,114,111,41,
-  13,10,32,32,32,32,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,109,101,116,114,111,32,97,110,100,32,109,97,115,116,101,114,45,109,
-  101,116,114,111,32,114,101,102,101,114,32,116,111,32,116,104,101,32,115,97,109,101,32,109,101,116,114,111,110,111,109,101,46,34,41,41,41,13,10,32,
-  32,32,32,32,40,108,101,116,32,40,40,105,115,98,101,97,116,115,32,35,116,41,41,13,10,32,32,32,32,32,32,32,40,119,104,101,110,32,115,101,
-  99,115,13,10,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,98,101,97,116,115,32,115,101,99,115,41,13,10,32,32,32,32,32,32,32,
-  32,32,32,40,115,101,116,33,32,105,115,98,101,97,116,115,32,35,102,41,41,13,10,32,32,32,32,32,32,32,40,102,102,105,95,115,99,104,101,100,
-  95,115,121,110,99,95,109,101,116,114,111,115,32,109,101,116,114,111,32,98,101,97,116,115,32,109,97,115,116,101,114,45,109,101,116,114,111,32,116,101,
-  109,112,111,32,105,115,98,101,97,116,115,32,109,111,100,101,41,41,41,41,13,10,13,10,40,100,101,102,105,110,101,32,40,109,101,116,114,111,45,112,
-  104,97,115,101,32,102,105,116,98,101,97,116,115,32,98,101,97,116,115,112,97,99,101,32,46,32,97,114,103,115,41,13,10,32,32,40,119,105,116,104,
-  45,111,112,116,107,101,121,115,32,40,97,114,103,115,32,40,109,101,116,114,111,32,42,109,101,116,114,111,42,41,41,13,10,32,32,32,32,40,105,102,
-  32,40,110,111,116,32,40,109,101,116,114,111,63,32,109,101,116,114,111,41,41,13,10,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,109,
-  101,116,114,111,32,126,83,32,105,115,32,110,111,116,32,97,32,118,97,108,105,100,32,109,101,116,114,111,110,111,109,101,46,34,32,109,101,116,114,111,
-  41,41,13,10,32,32,32,32,40,105,102,32,40,111,114,32,40,110,111,116,32,40,110,117,109,98,101,114,63,32,102,105,116,98,101,97,116,115,41,41,
-  32,40,60,61,32,102,105,116,98,101,97,116,115,32,48,41,41,13,10,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,102,105,116,98,101,
-  97,116,115,32,126,83,32,105,115,32,110,111,116,32,97,32,110,117,109,98,101,114,32,103,114,101,97,116,101,114,32,116,104,97,110,32,48,46,34,32,
-  102,105,116,98,101,97,116,115,41,41,13,10,32,32,32,32,40,105,102,32,40,111,114,32,40,110,111,116,32,40,110,117,109,98,101,114,63,32,98,101,
-  97,116,115,112,97,99,101,41,41,32,40,60,61,32,98,101,97,116,115,112,97,99,101,32,48,41,32,41,13,10,32,32,32,32,32,32,32,32,40,101,
-  114,114,111,114,32,34,98,101,97,116,115,112,97,99,101,32,126,83,32,105,115,32,110,111,116,32,97,32,110,117,109,98,101,114,32,103,114,101,97,116,
-  101,114,32,116,104,97,110,32,48,46,34,32,98,101,97,116,115,112,97,99,101,41,41,13,10,32,32,32,32,40,102,102,105,95,115,99,104,101,100,95,
-  109,101,116,114,111,95,112,104,97,115,101,32,102,105,116,98,101,97,116,115,32,98,101,97,116,115,112,97,99,101,32,109,101,116,114,111,41,41,41,13,
-  10,13,10,40,100,101,102,105,110,101,42,32,40,109,101,116,114,111,115,32,40,117,115,101,114,32,35,102,41,41,13,10,32,32,40,102,102,105,95,115,
-  99,104,101,100,95,103,101,116,95,109,101,116,114,111,115,32,117,115,101,114,41,41,13,10,13,10,0,0};
+  100,95,103,101,116,95,109,101,116,114,111,95,98,101,97,116,32,109,101,116,114,111,41,41,13,10,13,10,59,59,32,116,104,105,115,32,102,117,110,99,
+  116,105,111,110,32,119,97,115,32,111,114,105,103,105,110,97,108,108,121,32,99,97,108,108,101,100,32,110,111,119,45,116,101,109,112,111,13,10,13,10,
+  40,100,101,102,105,110,101,42,32,40,109,101,116,114,111,45,116,101,109,112,111,32,40,109,101,116,114,111,32,42,109,101,116,114,111,42,41,41,13,10,
+  32,32,40,105,102,32,40,110,111,116,32,40,109,101,116,114,111,63,32,109,101,116,114,111,41,41,13,10,32,32,32,32,32,32,40,101,114,114,111,114,
+  32,34,109,101,116,114,111,32,126,83,32,105,115,32,110,111,116,32,97,32,118,97,108,105,100,32,109,101,116,114,111,110,111,109,101,46,34,32,109,101,
+  116,114,111,41,41,13,10,32,32,40,102,102,105,95,115,99,104,101,100,95,103,101,116,95,109,101,116,114,111,95,116,101,109,112,111,32,109,101,116,114,
+  111,41,41,13,10,13,10,40,100,101,102,105,110,101,42,32,40,115,121,110,99,32,40,97,104,101,97,100,32,49,41,32,40,109,101,116,114,111,32,42,
+  109,101,116,114,111,42,41,41,13,10,32,32,40,105,102,32,40,60,61,32,97,104,101,97,100,32,48,41,13,10,32,32,32,32,40,101,114,114,111,114,
+  32,34,97,104,101,97,100,32,126,83,32,109,117,115,116,32,98,101,32,97,32,110,117,109,98,101,114,32,103,114,101,97,116,101,114,32,116,104,97,110,
+  32,48,46,34,32,97,104,101,97,100,41,41,13,10,32,32,40,105,102,32,40,62,32,97,104,101,97,100,32,49,48,48,48,41,13,10,32,32,32,32,
+  40,112,114,105,110,116,32,34,87,97,114,110,105,110,103,58,32,121,111,117,114,32,112,114,111,99,101,115,115,32,119,105,108,108,32,115,116,97,114,116,
+  32,102,97,114,32,105,110,116,111,32,116,104,101,32,102,117,116,117,114,101,46,13,10,32,32,80,101,114,104,97,112,115,32,121,111,117,32,102,111,114,
+  103,111,116,32,116,104,101,32,109,101,116,114,111,58,32,107,101,121,119,111,114,100,32,119,104,101,110,32,105,110,100,105,99,97,116,105,110,103,32,121,
+  111,117,114,32,109,101,116,114,111,63,34,41,41,13,10,32,32,40,108,101,116,42,32,40,40,119,104,111,108,101,32,40,102,108,111,111,114,32,97,104,
+  101,97,100,41,41,13,10,32,32,32,32,32,32,32,32,32,40,102,114,97,99,116,32,40,45,32,97,104,101,97,100,32,119,104,111,108,101,41,41,41,
+  13,10,32,32,32,32,40,108,97,109,98,100,97,40,41,13,10,32,32,32,32,32,32,40,108,101,116,32,40,40,115,116,97,114,116,45,98,101,97,116,
+  32,48,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,40,99,117,114,98,101,97,116,32,40,109,101,116,114,111,45,98,101,97,116,32,109,101,
+  116,114,111,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,40,98,97,115,101,32,40,43,32,40,102,108,111,111,114,32,40,109,101,116,114,
+  111,45,98,101,97,116,32,109,101,116,114,111,41,41,32,102,114,97,99,116,41,41,41,13,10,32,32,32,32,32,32,32,32,40,105,102,32,40,101,113,
+  118,63,32,48,32,119,104,111,108,101,41,32,13,10,32,32,32,32,32,32,32,32,32,32,32,32,40,105,102,32,40,60,32,99,117,114,98,101,97,116,
+  32,98,97,115,101,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,115,116,97,114,116,45,98,101,97,116,32,40,
+  102,108,111,111,114,32,99,117,114,98,101,97,116,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,115,116,97,
+  114,116,45,98,101,97,116,32,40,99,101,105,108,105,110,103,32,99,117,114,98,101,97,116,41,41,41,13,10,32,32,32,32,32,32,32,32,32,32,40,
+  115,101,116,33,32,115,116,97,114,116,45,98,101,97,116,32,40,42,32,40,99,101,105,108,105,110,103,32,40,47,32,99,117,114,98,101,97,116,32,119,
+  104,111,108,101,41,41,32,119,104,111,108,101,41,41,41,13,10,32,32,32,32,32,32,32,32,40,108,105,115,116,32,40,43,32,115,116,97,114,116,45,
+  98,101,97,116,32,102,114,97,99,116,41,32,109,101,116,114,111,41,41,41,41,41,13,10,13,10,13,10,40,100,101,102,105,110,101,42,32,40,109,101,
+  116,114,111,45,115,121,110,99,32,109,101,116,114,111,32,46,32,97,114,103,115,41,13,10,32,32,40,119,105,116,104,45,111,112,116,107,101,121,115,32,
+  40,97,114,103,115,32,40,98,101,97,116,115,32,49,41,32,40,116,101,109,112,111,32,48,41,32,40,109,97,115,116,101,114,45,109,101,116,114,111,32,
+  45,49,41,32,40,109,111,100,101,32,48,41,32,40,115,101,99,115,32,35,102,41,41,13,10,32,32,32,32,32,40,105,102,32,40,101,113,118,63,32,
+  48,32,40,108,97,115,116,32,40,102,102,105,95,115,99,104,101,100,95,103,101,116,95,109,101,116,114,111,115,32,35,102,41,41,41,13,10,32,32,32,
+  32,32,32,32,40,101,114,114,111,114,32,34,109,111,114,101,32,116,104,97,110,32,111,110,101,32,109,101,116,114,111,110,111,109,101,32,109,117,115,116,
+  32,101,120,105,115,116,32,105,110,32,111,114,100,101,114,32,116,111,32,115,121,110,99,32,116,119,111,32,109,101,116,114,111,110,111,109,101,115,46,34,
+  41,41,13,10,32,32,32,32,32,40,105,102,32,40,97,110,100,32,40,101,113,118,63,32,109,101,116,114,111,32,42,109,101,116,114,111,42,41,32,40,
+  101,113,118,63,32,109,97,115,116,101,114,45,109,101,116,114,111,32,45,49,41,41,13,10,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,109,
+  97,115,116,101,114,45,109,101,116,114,111,32,40,102,105,114,115,116,32,40,102,102,105,95,115,99,104,101,100,95,103,101,116,95,109,101,116,114,111,115,
+  32,35,116,41,41,41,41,13,10,32,32,32,32,32,40,105,102,32,40,101,113,118,63,32,109,97,115,116,101,114,45,109,101,116,114,111,32,45,49,41,
+  13,10,32,32,32,32,32,32,32,40,115,101,116,33,32,109,97,115,116,101,114,45,109,101,116,114,111,32,42,109,101,116,114,111,42,41,41,13,10,32,
+  32,32,32,32,40,99,111,110,100,32,40,40,60,61,32,98,101,97,116,115,32,48,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,40,101,114,
+  114,111,114,32,34,98,101,97,116,115,32,126,83,32,105,115,32,110,111,116,32,97,32,110,117,109,98,101,114,32,103,114,101,97,116,101,114,32,116,104,
+  97,110,32,48,46,34,32,98,101,97,116,115,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,40,40,97,110,100,32,115,101,99,115,32,40,60,
+  61,32,115,101,99,115,32,48,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,115,101,99,115,32,126,83,32,
+  109,117,115,116,32,98,101,32,97,32,112,111,115,105,116,105,118,101,32,110,111,110,45,122,101,114,111,32,110,117,109,98,101,114,34,32,98,101,97,116,
+  115,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,40,40,110,111,116,32,40,109,101,116,114,111,63,32,109,101,116,114,111,41,41,13,10,32,
+  32,32,32,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,109,101,116,114,111,32,126,83,32,105,115,32,110,111,116,32,97,32,118,97,108,
+  105,100,32,109,101,116,114,111,110,111,109,101,46,34,32,109,101,116,114,111,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,40,40,110,111,116,
+  32,40,109,101,116,114,111,63,32,109,97,115,116,101,114,45,109,101,116,114,111,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,40,101,114,
+  114,111,114,32,34,109,101,116,114,111,32,126,83,32,105,115,32,110,111,116,32,97,32,118,97,108,105,100,32,109,101,116,114,111,110,111,109,101,46,34,
+  32,109,97,115,116,101,114,45,109,101,116,114,111,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,40,40,110,111,116,32,40,111,114,32,40,101,
+  113,118,63,32,109,111,100,101,32,48,41,32,40,101,113,118,63,32,109,111,100,101,32,49,41,32,40,101,113,118,63,32,109,111,100,101,32,45,49,41,
+  41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,109,111,100,101,32,126,83,32,105,115,32,110,111,116,32,45,
+  49,44,32,48,44,32,111,114,32,49,46,34,32,109,111,100,101,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,40,40,101,113,118,63,32,109,
+  101,116,114,111,32,109,97,115,116,101,114,45,109,101,116,114,111,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,
+  109,101,116,114,111,32,97,110,100,32,109,97,115,116,101,114,45,109,101,116,114,111,32,114,101,102,101,114,32,116,111,32,116,104,101,32,115,97,109,101,
+  32,109,101,116,114,111,110,111,109,101,46,34,41,41,41,13,10,32,32,32,32,32,40,108,101,116,32,40,40,105,115,98,101,97,116,115,32,35,116,41,
+  41,13,10,32,32,32,32,32,32,32,40,119,104,101,110,32,115,101,99,115,13,10,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,98,101,
+  97,116,115,32,115,101,99,115,41,13,10,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,105,115,98,101,97,116,115,32,35,102,41,41,13,
+  10,32,32,32,32,32,32,32,40,102,102,105,95,115,99,104,101,100,95,115,121,110,99,95,109,101,116,114,111,115,32,109,101,116,114,111,32,98,101,97,
+  116,115,32,109,97,115,116,101,114,45,109,101,116,114,111,32,116,101,109,112,111,32,105,115,98,101,97,116,115,32,109,111,100,101,41,41,41,41,13,10,
+  13,10,40,100,101,102,105,110,101,32,40,109,101,116,114,111,45,112,104,97,115,101,32,102,105,116,98,101,97,116,115,32,98,101,97,116,115,112,97,99,
+  101,32,46,32,97,114,103,115,41,13,10,32,32,40,119,105,116,104,45,111,112,116,107,101,121,115,32,40,97,114,103,115,32,40,109,101,116,114,111,32,
+  42,109,101,116,114,111,42,41,41,13,10,32,32,32,32,40,105,102,32,40,110,111,116,32,40,109,101,116,114,111,63,32,109,101,116,114,111,41,41,13,
+  10,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,109,101,116,114,111,32,126,83,32,105,115,32,110,111,116,32,97,32,118,97,108,105,100,
+  32,109,101,116,114,111,110,111,109,101,46,34,32,109,101,116,114,111,41,41,13,10,32,32,32,32,40,105,102,32,40,111,114,32,40,110,111,116,32,40,
+  110,117,109,98,101,114,63,32,102,105,116,98,101,97,116,115,41,41,32,40,60,61,32,102,105,116,98,101,97,116,115,32,48,41,41,13,10,32,32,32,
+  32,32,32,32,32,40,101,114,114,111,114,32,34,102,105,116,98,101,97,116,115,32,126,83,32,105,115,32,110,111,116,32,97,32,110,117,109,98,101,114,
+  32,103,114,101,97,116,101,114,32,116,104,97,110,32,48,46,34,32,102,105,116,98,101,97,116,115,41,41,13,10,32,32,32,32,40,105,102,32,40,111,
+  114,32,40,110,111,116,32,40,110,117,109,98,101,114,63,32,98,101,97,116,115,112,97,99,101,41,41,32,40,60,61,32,98,101,97,116,115,112,97,99,
+  101,32,48,41,32,41,13,10,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,98,101,97,116,115,112,97,99,101,32,126,83,32,105,115,32,
+  110,111,116,32,97,32,110,117,109,98,101,114,32,103,114,101,97,116,101,114,32,116,104,97,110,32,48,46,34,32,98,101,97,116,115,112,97,99,101,41,
+  41,13,10,32,32,32,32,40,102,102,105,95,115,99,104,101,100,95,109,101,116,114,111,95,112,104,97,115,101,32,102,105,116,98,101,97,116,115,32,98,
+  101,97,116,115,112,97,99,101,32,109,101,116,114,111,41,41,41,13,10,13,10,40,100,101,102,105,110,101,42,32,40,109,101,116,114,111,115,32,40,117,
+  115,101,114,32,35,102,41,41,13,10,32,32,40,102,102,105,95,115,99,104,101,100,95,103,101,116,95,109,101,116,114,111,115,32,117,115,101,114,41,41,
+  13,10,13,10,0,0};
 const char* SchemeSources::processes_scm = (const char*) temp9;
 
 static const unsigned char temp10[] = {59,59,59,32,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
@@ -9436,47 +9571,53 @@ static const unsigned char temp15[] = {59,59,59,32,42,42,42,42,42,42,42,42,42,42
   111,114,116,32,34,102,111,111,46,109,105,100,34,32,49,32,39,40,99,116,114,108,50,41,41,10,59,32,40,109,105,100,105,102,105,108,101,45,105,109,
   112,111,114,116,32,34,102,111,111,46,109,105,100,34,32,49,32,39,40,58,114,104,121,116,104,109,32,58,100,117,114,32,58,118,101,108,41,41,10,59,
   32,40,109,105,100,105,102,105,108,101,45,105,109,112,111,114,116,32,34,102,111,111,46,109,105,100,34,32,49,32,39,40,112,114,111,103,32,34,99,104,
-  97,110,34,41,41,10,10,40,100,101,102,105,110,101,32,109,105,100,105,45,118,97,108,117,101,115,32,32,10,32,32,59,59,32,83,69,69,58,32,32,
-  69,110,117,109,101,114,97,116,105,111,110,115,46,104,10,32,32,39,40,40,34,116,105,109,101,34,32,32,32,49,32,41,32,10,32,32,32,32,40,34,
-  100,101,108,116,97,34,32,32,50,32,41,10,32,32,32,32,40,34,111,112,34,32,32,32,32,32,51,32,41,10,32,32,32,32,40,34,99,104,97,110,
-  34,32,32,32,52,32,41,32,10,32,32,32,32,40,34,114,104,121,116,104,109,34,32,53,32,41,10,32,32,32,32,40,34,100,117,114,34,32,32,32,
-  32,54,32,41,10,32,32,32,32,40,34,107,101,121,34,32,32,32,32,55,32,41,10,32,32,32,32,40,34,97,109,112,34,32,32,32,32,56,32,41,
-  10,32,32,32,32,40,34,118,101,108,34,32,32,32,32,57,32,41,10,32,32,32,32,40,34,116,111,117,99,104,34,32,32,49,48,32,41,10,32,32,
-  32,32,40,34,99,116,114,108,49,34,32,32,49,49,32,41,10,32,32,32,32,40,34,99,116,114,108,50,34,32,32,49,50,32,41,10,32,32,32,32,
-  40,34,112,114,111,103,34,32,32,32,49,51,32,41,10,32,32,32,32,40,34,112,114,101,115,115,34,32,32,49,52,32,41,10,32,32,32,32,40,34,
-  98,101,110,100,34,32,32,32,49,53,32,41,10,32,32,32,32,40,34,115,101,113,110,117,109,34,32,32,32,32,32,49,54,41,10,32,32,32,32,40,
-  34,116,101,120,116,34,32,32,32,32,32,32,32,49,55,41,10,32,32,32,32,40,34,99,104,97,110,112,114,101,34,32,32,32,32,49,56,41,10,32,
-  32,32,32,40,34,116,101,109,112,111,34,32,32,32,32,32,32,49,57,41,10,32,32,32,32,40,34,116,105,109,101,115,105,103,34,32,32,32,32,50,
-  48,41,10,32,32,32,32,40,34,107,101,121,115,105,103,34,32,32,32,32,32,50,49,41,10,32,32,32,32,41,41,10,10,40,100,101,102,105,110,101,
-  32,40,109,105,100,105,102,105,108,101,45,105,109,112,111,114,116,32,102,105,108,101,32,116,114,97,99,107,32,118,97,108,117,101,115,41,10,32,32,40,
-  117,110,108,101,115,115,32,40,102,105,108,101,45,101,120,105,115,116,115,63,32,102,105,108,101,41,10,32,32,32,32,40,101,114,114,111,114,32,34,102,
-  105,108,101,32,100,111,101,115,32,110,111,116,32,101,120,105,115,116,58,32,126,83,34,32,102,105,108,101,41,41,10,32,32,40,100,101,102,105,110,101,
-  32,40,103,101,116,110,97,109,101,32,120,41,10,32,32,32,32,40,99,111,110,100,32,40,40,115,116,114,105,110,103,63,32,120,41,32,120,41,10,32,
-  32,32,32,32,32,32,32,32,32,40,40,107,101,121,119,111,114,100,63,32,120,41,32,40,107,101,121,119,111,114,100,45,62,115,116,114,105,110,103,32,
-  120,41,41,10,32,32,32,32,32,32,32,32,32,32,40,40,115,121,109,98,111,108,63,32,120,41,32,40,115,121,109,98,111,108,45,62,115,116,114,105,
-  110,103,32,120,41,41,10,32,32,32,32,32,32,32,32,32,32,40,101,108,115,101,32,40,101,114,114,111,114,32,34,110,111,116,32,97,32,109,105,100,
-  105,32,118,97,108,117,101,58,32,126,83,34,32,120,41,41,41,41,10,32,32,40,100,101,102,105,110,101,32,40,103,101,116,109,105,100,105,118,97,108,
-  117,101,32,120,32,108,41,10,32,32,32,32,40,108,101,116,32,40,40,101,32,40,111,114,32,40,97,115,115,111,99,32,40,103,101,116,110,97,109,101,
-  32,120,41,32,108,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,110,111,116,32,97,32,109,105,
-  100,105,32,118,97,108,117,101,58,32,126,83,34,32,120,41,41,41,41,10,32,32,32,32,32,32,40,115,101,99,111,110,100,32,101,41,41,41,10,32,
-  32,40,117,110,108,101,115,115,32,40,97,110,100,32,40,105,110,116,101,103,101,114,63,32,116,114,97,99,107,41,32,40,62,61,32,116,114,97,99,107,
-  32,48,41,41,10,32,32,32,32,40,101,114,114,111,114,32,34,110,111,116,32,97,32,116,114,97,99,107,32,110,117,109,98,101,114,58,32,126,83,34,
-  32,116,114,97,99,107,41,41,10,32,32,40,105,102,32,40,112,97,105,114,63,32,118,97,108,117,101,115,41,10,32,32,32,32,32,32,40,105,102,32,
-  40,112,97,105,114,63,32,40,99,97,114,32,118,97,108,117,101,115,41,41,10,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,118,97,108,
-  117,101,115,32,40,109,97,112,32,40,108,97,109,98,100,97,32,40,121,41,32,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-  32,32,32,32,32,32,32,32,32,32,32,32,40,111,114,32,40,112,97,105,114,63,32,121,41,32,40,101,114,114,111,114,32,34,110,111,116,32,97,32,
-  108,105,115,116,32,111,102,32,109,105,100,105,32,118,97,108,117,101,115,58,32,126,83,34,32,121,41,41,10,32,32,32,32,32,32,32,32,32,32,32,
-  32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,109,97,112,32,40,108,97,109,98,100,97,32,40,120,41,32,40,103,101,116,
-  109,105,100,105,118,97,108,117,101,32,120,32,109,105,100,105,45,118,97,108,117,101,115,41,41,32,121,41,41,10,32,32,32,32,32,32,32,32,32,32,
-  32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,118,97,108,117,101,115,41,41,10,32,32,32,32,32,32,32,32,32,32,40,115,101,
-  116,33,32,118,97,108,117,101,115,32,40,109,97,112,32,40,108,97,109,98,100,97,32,40,120,41,32,40,103,101,116,109,105,100,105,118,97,108,117,101,
-  32,120,32,109,105,100,105,45,118,97,108,117,101,115,41,41,32,118,97,108,117,101,115,41,41,41,10,32,32,32,32,32,32,40,115,101,116,33,32,118,
-  97,108,117,101,115,32,40,108,105,115,116,32,40,103,101,116,109,105,100,105,118,97,108,117,101,32,118,97,108,117,101,115,32,109,105,100,105,45,118,97,
-  108,117,101,115,41,41,41,41,10,32,32,40,102,102,105,95,109,105,100,105,102,105,108,101,95,105,109,112,111,114,116,32,102,105,108,101,32,116,114,97,
-  99,107,32,118,97,108,117,101,115,41,10,32,32,41,10,10,59,32,40,109,105,100,105,102,105,108,101,45,105,109,112,111,114,116,32,34,47,85,115,101,
-  114,115,47,104,107,116,47,105,110,99,108,105,110,101,47,122,105,110,99,108,105,110,101,45,49,46,109,105,100,34,32,48,32,34,111,112,34,41,10,10,
-  40,100,101,102,105,110,101,32,40,109,105,100,105,102,105,108,101,45,104,101,97,100,101,114,32,102,105,108,101,41,10,32,32,40,102,102,105,95,109,105,
-  100,105,102,105,108,101,95,104,101,97,100,101,114,32,102,105,108,101,32,35,102,41,41,10,10,0,0};
+  97,110,34,41,41,10,59,32,40,109,105,100,105,102,105,108,101,45,105,109,112,111,114,116,32,34,102,111,111,46,109,105,100,34,32,49,32,39,40,116,
+  105,109,101,32,107,101,121,32,100,117,114,41,32,58,99,111,108,117,109,110,115,32,35,116,41,10,10,40,100,101,102,105,110,101,32,109,105,100,105,45,
+  118,97,108,117,101,115,32,32,10,32,32,59,59,32,83,69,69,58,32,32,69,110,117,109,101,114,97,116,105,111,110,115,46,104,10,32,32,39,40,40,
+  34,116,105,109,101,34,32,32,32,49,32,41,32,10,32,32,32,32,40,34,100,101,108,116,97,34,32,32,50,32,41,10,32,32,32,32,40,34,111,112,
+  34,32,32,32,32,32,51,32,41,10,32,32,32,32,40,34,99,104,97,110,34,32,32,32,52,32,41,32,10,32,32,32,32,40,34,114,104,121,116,104,
+  109,34,32,53,32,41,10,32,32,32,32,40,34,100,117,114,34,32,32,32,32,54,32,41,10,32,32,32,32,40,34,107,101,121,34,32,32,32,32,55,
+  32,41,10,32,32,32,32,40,34,97,109,112,34,32,32,32,32,56,32,41,10,32,32,32,32,40,34,118,101,108,34,32,32,32,32,57,32,41,10,32,
+  32,32,32,40,34,116,111,117,99,104,34,32,32,49,48,32,41,10,32,32,32,32,40,34,99,116,114,108,49,34,32,32,49,49,32,41,10,32,32,32,
+  32,40,34,99,116,114,108,50,34,32,32,49,50,32,41,10,32,32,32,32,40,34,112,114,111,103,34,32,32,32,49,51,32,41,10,32,32,32,32,40,
+  34,112,114,101,115,115,34,32,32,49,52,32,41,10,32,32,32,32,40,34,98,101,110,100,34,32,32,32,49,53,32,41,10,32,32,32,32,40,34,115,
+  101,113,110,117,109,34,32,32,32,32,32,49,54,41,10,32,32,32,32,40,34,116,101,120,116,34,32,32,32,32,32,32,32,49,55,41,10,32,32,32,
+  32,40,34,99,104,97,110,112,114,101,34,32,32,32,32,49,56,41,10,32,32,32,32,40,34,116,101,109,112,111,34,32,32,32,32,32,32,49,57,41,
+  10,32,32,32,32,40,34,116,105,109,101,115,105,103,34,32,32,32,32,50,48,41,10,32,32,32,32,40,34,107,101,121,115,105,103,34,32,32,32,32,
+  32,50,49,41,10,32,32,32,32,41,41,10,10,59,59,32,119,105,116,104,32,58,99,111,108,117,109,110,115,32,35,116,32,116,104,101,32,114,101,115,
+  117,108,116,32,105,115,32,97,32,108,105,115,116,32,111,102,32,118,101,99,116,111,114,115,44,32,111,110,101,32,102,111,114,32,101,97,99,104,10,59,
+  59,32,118,97,108,117,101,44,32,105,110,115,116,101,97,100,32,111,102,32,97,32,108,105,115,116,32,111,102,32,118,97,108,117,101,115,32,102,111,114,
+  32,101,97,99,104,32,109,101,115,115,97,103,101,46,10,10,40,100,101,102,105,110,101,32,40,109,105,100,105,102,105,108,101,45,105,109,112,111,114,116,
+  32,102,105,108,101,32,116,114,97,99,107,32,118,97,108,117,101,115,32,46,32,97,114,103,115,41,10,32,32,40,117,110,108,101,115,115,32,40,102,105,
+  108,101,45,101,120,105,115,116,115,63,32,102,105,108,101,41,10,32,32,32,32,40,101,114,114,111,114,32,34,102,105,108,101,32,100,111,101,115,32,110,
+  111,116,32,101,120,105,115,116,58,32,126,83,34,32,102,105,108,101,41,41,10,32,32,40,100,101,102,105,110,101,32,40,103,101,116,110,97,109,101,32,
+  120,41,10,32,32,32,32,40,99,111,110,100,32,40,40,115,116,114,105,110,103,63,32,120,41,32,120,41,10,32,32,32,32,32,32,32,32,32,32,40,
+  40,107,101,121,119,111,114,100,63,32,120,41,32,40,107,101,121,119,111,114,100,45,62,115,116,114,105,110,103,32,120,41,41,10,32,32,32,32,32,32,
+  32,32,32,32,40,40,115,121,109,98,111,108,63,32,120,41,32,40,115,121,109,98,111,108,45,62,115,116,114,105,110,103,32,120,41,41,10,32,32,32,
+  32,32,32,32,32,32,32,40,101,108,115,101,32,40,101,114,114,111,114,32,34,110,111,116,32,97,32,109,105,100,105,32,118,97,108,117,101,58,32,126,
+  83,34,32,120,41,41,41,41,10,32,32,40,100,101,102,105,110,101,32,40,103,101,116,109,105,100,105,118,97,108,117,101,32,120,32,108,41,10,32,32,
+  32,32,40,108,101,116,32,40,40,101,32,40,111,114,32,40,97,115,115,111,99,32,40,103,101,116,110,97,109,101,32,120,41,32,108,41,10,32,32,32,
+  32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,101,114,114,111,114,32,34,110,111,116,32,97,32,109,105,100,105,32,118,97,108,117,101,58,32,
+  126,83,34,32,120,41,41,41,41,10,32,32,32,32,32,32,40,115,101,99,111,110,100,32,101,41,41,41,10,32,32,40,117,110,108,101,115,115,32,40,
+  97,110,100,32,40,105,110,116,101,103,101,114,63,32,116,114,97,99,107,41,32,40,62,61,32,116,114,97,99,107,32,48,41,41,10,32,32,32,32,40,
+  101,114,114,111,114,32,34,110,111,116,32,97,32,116,114,97,99,107,32,110,117,109,98,101,114,58,32,126,83,34,32,116,114,97,99,107,41,41,10,32,
+  32,40,105,102,32,40,112,97,105,114,63,32,118,97,108,117,101,115,41,10,32,32,32,32,32,32,40,105,102,32,40,112,97,105,114,63,32,40,99,97,
+  114,32,118,97,108,117,101,115,41,41,10,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,118,97,108,117,101,115,32,40,109,97,112,32,40,
+  108,97,109,98,100,97,32,40,121,41,32,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+  32,32,40,111,114,32,40,112,97,105,114,63,32,121,41,32,40,101,114,114,111,114,32,34,110,111,116,32,97,32,108,105,115,116,32,111,102,32,109,105,
+  100,105,32,118,97,108,117,101,115,58,32,126,83,34,32,121,41,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+  32,32,32,32,32,32,32,32,32,40,109,97,112,32,40,108,97,109,98,100,97,32,40,120,41,32,40,103,101,116,109,105,100,105,118,97,108,117,101,32,
+  120,32,109,105,100,105,45,118,97,108,117,101,115,41,41,32,121,41,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+  32,32,32,32,32,32,32,32,118,97,108,117,101,115,41,41,10,32,32,32,32,32,32,32,32,32,32,40,115,101,116,33,32,118,97,108,117,101,115,32,
+  40,109,97,112,32,40,108,97,109,98,100,97,32,40,120,41,32,40,103,101,116,109,105,100,105,118,97,108,117,101,32,120,32,109,105,100,105,45,118,97,
+  108,117,101,115,41,41,32,118,97,108,117,101,115,41,41,41,10,32,32,32,32,32,32,40,115,101,116,33,32,118,97,108,117,101,115,32,40,108,105,115,
+  116,32,40,103,101,116,109,105,100,105,118,97,108,117,101,32,118,97,108,117,101,115,32,109,105,100,105,45,118,97,108,117,101,115,41,41,41,41,10,32,
+  32,40,119,105,116,104,45,111,112,116,107,101,121,115,32,40,97,114,103,115,32,40,99,111,108,117,109,110,115,32,35,102,41,41,10,32,32,32,32,40,
+  102,102,105,95,109,105,100,105,102,105,108,101,95,105,109,112,111,114,116,32,102,105,108,101,32,116,114,97,99,107,32,118,97,108,117,101,115,32,40,105,
+  102,32,99,111,108,117,109,110,115,32,35,116,32,35,102,41,41,41,10,32,32,41,10,10,59,32,40,109,105,100,105,102,105,108,101,45,105,109,112,111,
+  114,116,32,34,47,85,115,101,114,115,47,104,107,116,47,105,110,99,108,105,110,101,47,122,105,110,99,108,105,110,101,45,49,46,109,105,100,34,32,48,
+  32,34,111,112,34,41,10,10,40,100,101,102,105,110,101,32,40,109,105,100,105,102,105,108,101,45,104,101,97,100,101,114,32,102,105,108,101,41,10,32,
+  32,40,102,102,105,95,109,105,100,105,102,105,108,101,95,104,101,97,100,101,114,32,102,105,108,101,32,35,102,41,41,10,10,0,0};
 const char* SchemeSources::toolbox_scm = (const char*) temp15;
 
 static const unsigned char temp16[] = {59,59,59,32,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
@@ -27,10 +27,10 @@ namespace SchemeSources
     const int           plot_scmSize = 13332;
 
     extern const char*  ports_scm;
-    const int           ports_scmSize = 20101;
+    const int           ports_scmSize = 23876;
 
     extern const char*  processes_scm;
-    const int           processes_scmSize = 14786;
+    const int           processes_scmSize = 16404;
 
     extern const char*  s7_scm;
     const int           s7_scmSize = 5809;
@@ -48,7 +48,7 @@ namespace SchemeSources
     const int           spectral_scmSize = 34833;
 
     extern const char*  toolbox_scm;
-    const int           toolbox_scmSize = 42865;
+    const int           toolbox_scmSize = 43113;
 
     extern const char*  utilities_scm;
     const int           utilities_scmSize = 16009;
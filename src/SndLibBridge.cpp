@@ -587,6 +587,35 @@ s7_pointer ffi_sched_sprout (s7_scheme *s7, s7_pointer args)
   return s7_UNSPECIFIED(s7);
 }
 
+s7_pointer ffi_sched_sprout_list (s7_scheme *s7, s7_pointer args)
+{
+  double f0;
+  int i0;
+  s7_pointer p0, p1, p2;
+  if (!(s7_car(args)))
+    return(s7_wrong_type_arg_error(s7, "ffi_sched_sprout_list", 1, s7_car(args), "a s7_pointer"));
+  p0=s7_car(args);
+  args=s7_cdr(args);
+  if (!(s7_car(args)))
+    return(s7_wrong_type_arg_error(s7, "ffi_sched_sprout_list", 2, s7_car(args), "a s7_pointer"));
+  p1=s7_car(args);
+  args=s7_cdr(args);
+  if (!(s7_car(args)))
+    return(s7_wrong_type_arg_error(s7, "ffi_sched_sprout_list", 3, s7_car(args), "a s7_pointer"));
+  p2=s7_car(args);
+  args=s7_cdr(args);
+  if (!s7_is_integer(s7_car(args)))
+    return(s7_wrong_type_arg_error(s7, "ffi_sched_sprout_list", 4, s7_car(args), "a int"));
+  i0=(int)s7_integer(s7_car(args));
+  args=s7_cdr(args);
+  if (!s7_is_real(s7_car(args)))
+    return(s7_wrong_type_arg_error(s7, "ffi_sched_sprout_list", 5, s7_car(args), "a double"));
+  f0=s7_number_to_real(s7_car(args));
+  args=s7_cdr(args);
+  cm_sched_sprout_list(p0, p1, p2, i0, f0);
+  return s7_UNSPECIFIED(s7);
+}
+
 s7_pointer ffi_sched_paused_p (s7_scheme *s7, s7_pointer args)
 {
   bool b0;
@@ -662,6 +691,29 @@ s7_pointer ffi_sched_score_time (s7_scheme *s7, s7_pointer args)
   return s7_make_real(s7, f0);
 }
 
+s7_pointer ffi_sched_stats (s7_scheme *s7, s7_pointer args)
+{
+  bool b0;
+  s7_pointer p0;
+  if (!s7_is_boolean(s7_car(args)))
+    return(s7_wrong_type_arg_error(s7, "ffi_sched_stats", 1, s7_car(args), "a bool"));
+  b0=s7_boolean(s7, s7_car(args));
+  args=s7_cdr(args);
+  p0=cm_sched_stats(b0);
+  return (s7, p0);
+}
+
+s7_pointer ffi_sched_set_spin (s7_scheme *s7, s7_pointer args)
+{
+  double f0;
+  if (!s7_is_real(s7_car(args)))
+    return(s7_wrong_type_arg_error(s7, "ffi_sched_set_spin", 1, s7_car(args), "a double"));
+  f0=s7_number_to_real(s7_car(args));
+  args=s7_cdr(args);
+  cm_sched_set_spin(f0);
+  return s7_UNSPECIFIED(s7);
+}
+
 s7_pointer ffi_sched_metro_id_valid (s7_scheme *s7, s7_pointer args)
 {
   int i0;
@@ -1001,6 +1053,7 @@ s7_pointer ffi_string_hash (s7_scheme *s7, s7_pointer args)
 s7_pointer ffi_midifile_import (s7_scheme *s7, s7_pointer args)
 {
   int i0;
+  bool b0;
   char* s0;
   s7_pointer p0, p1;
   if (!s7_is_string(s7_car(args)))
@@ -1015,7 +1068,11 @@ s7_pointer ffi_midifile_import (s7_scheme *s7, s7_pointer args)
     return(s7_wrong_type_arg_error(s7, "ffi_midifile_import", 3, s7_car(args), "a s7_pointer"));
   p1=s7_car(args);
   args=s7_cdr(args);
-  p0=cm_midifile_import(s0, i0, p1);
+  if (!s7_is_boolean(s7_car(args)))
+    return(s7_wrong_type_arg_error(s7, "ffi_midifile_import", 4, s7_car(args), "a bool"));
+  b0=s7_boolean(s7, s7_car(args));
+  args=s7_cdr(args);
+  p0=cm_midifile_import(s0, i0, p1, b0);
   return (s7, p0);
 }
 
@@ -1186,13 +1243,17 @@ s7_pointer ffi_port_info (s7_scheme *s7, s7_pointer args)
 
 s7_pointer ffi_mp_open_output (s7_scheme *s7, s7_pointer args)
 {
-  int i0;
+  int i0, i1;
   bool b0;
   if (!s7_is_integer(s7_car(args)))
     return(s7_wrong_type_arg_error(s7, "ffi_mp_open_output", 1, s7_car(args), "a int"));
   i0=(int)s7_integer(s7_car(args));
   args=s7_cdr(args);
-  b0=mp_open_output(i0);
+  if (!s7_is_integer(s7_car(args)))
+    return(s7_wrong_type_arg_error(s7, "ffi_mp_open_output", 2, s7_car(args), "a int"));
+  i1=(int)s7_integer(s7_car(args));
+  args=s7_cdr(args);
+  b0=mp_open_output(i0, i1);
   return make_s7_boolean(s7, b0);
 }
 
@@ -1254,7 +1315,7 @@ s7_pointer ffi_mp_close_score (s7_scheme *s7, s7_pointer args)
 
 s7_pointer ffi_mp_send_note (s7_scheme *s7, s7_pointer args)
 {
-  s7_pointer p0, p1, p2, p3, p4;
+  s7_pointer p0, p1, p2, p3, p4, p5;
   if (!(s7_car(args)))
     return(s7_wrong_type_arg_error(s7, "ffi_mp_send_note", 1, s7_car(args), "a s7_pointer"));
   p0=s7_car(args);
@@ -1275,14 +1336,18 @@ s7_pointer ffi_mp_send_note (s7_scheme *s7, s7_pointer args)
     return(s7_wrong_type_arg_error(s7, "ffi_mp_send_note", 5, s7_car(args), "a s7_pointer"));
   p4=s7_car(args);
   args=s7_cdr(args);
-  mp_send_note(p0, p1, p2, p3, p4);
+  if (!(s7_car(args)))
+    return(s7_wrong_type_arg_error(s7, "ffi_mp_send_note", 6, s7_car(args), "a s7_pointer"));
+  p5=s7_car(args);
+  args=s7_cdr(args);
+  mp_send_note(p0, p1, p2, p3, p4, p5);
   return s7_UNSPECIFIED(s7);
 }
 
 s7_pointer ffi_mp_send_data (s7_scheme *s7, s7_pointer args)
 {
   double f0, f1, f2, f3;
-  int i0;
+  int i0, i1;
   if (!s7_is_integer(s7_car(args)))
     return(s7_wrong_type_arg_error(s7, "ffi_mp_send_data", 1, s7_car(args), "a int"));
   i0=(int)s7_integer(s7_car(args));
@@ -1303,7 +1368,11 @@ s7_pointer ffi_mp_send_data (s7_scheme *s7, s7_pointer args)
     return(s7_wrong_type_arg_error(s7, "ffi_mp_send_data", 5, s7_car(args), "a double"));
   f3=s7_number_to_real(s7_car(args));
   args=s7_cdr(args);
-  mp_send_data(i0, f0, f1, f2, f3);
+  if (!s7_is_integer(s7_car(args)))
+    return(s7_wrong_type_arg_error(s7, "ffi_mp_send_data", 6, s7_car(args), "a int"));
+  i1=(int)s7_integer(s7_car(args));
+  args=s7_cdr(args);
+  mp_send_data(i0, f0, f1, f2, f3, i1);
   return s7_UNSPECIFIED(s7);
 }
 
@@ -1340,6 +1409,89 @@ s7_pointer ffi_mp_set_tuning (s7_scheme *s7, s7_pointer args)
   return s7_UNSPECIFIED(s7);
 }
 
+s7_pointer ffi_mp_set_lookahead (s7_scheme *s7, s7_pointer args)
+{
+  double f0;
+  if (!s7_is_real(s7_car(args)))
+    return(s7_wrong_type_arg_error(s7, "ffi_mp_set_lookahead", 1, s7_car(args), "a double"));
+  f0=s7_number_to_real(s7_car(args));
+  args=s7_cdr(args);
+  mp_set_lookahead(f0);
+  return s7_UNSPECIFIED(s7);
+}
+
+s7_pointer ffi_mp_set_retrigger (s7_scheme *s7, s7_pointer args)
+{
+  bool b0;
+  if (!s7_is_boolean(s7_car(args)))
+    return(s7_wrong_type_arg_error(s7, "ffi_mp_set_retrigger", 1, s7_car(args), "a bool"));
+  b0=s7_boolean(s7, s7_car(args));
+  args=s7_cdr(args);
+  mp_set_retrigger(b0);
+  return s7_UNSPECIFIED(s7);
+}
+
+s7_pointer ffi_mp_set_extend (s7_scheme *s7, s7_pointer args)
+{
+  bool b0;
+  if (!s7_is_boolean(s7_car(args)))
+    return(s7_wrong_type_arg_error(s7, "ffi_mp_set_extend", 1, s7_car(args), "a bool"));
+  b0=s7_boolean(s7, s7_car(args));
+  args=s7_cdr(args);
+  mp_set_extend(b0);
+  return s7_UNSPECIFIED(s7);
+}
+
+s7_pointer ffi_mp_set_tuning_offsets (s7_scheme *s7, s7_pointer args)
+{
+  s7_pointer p0;
+  bool b0;
+  if (!(s7_car(args)))
+    return(s7_wrong_type_arg_error(s7, "ffi_mp_set_tuning_offsets", 1, s7_car(args), "a s7_pointer"));
+  p0=s7_car(args);
+  args=s7_cdr(args);
+  b0=mp_set_tuning_offsets(p0);
+  return make_s7_boolean(s7, b0);
+}
+
+s7_pointer ffi_mp_set_note_bends (s7_scheme *s7, s7_pointer args)
+{
+  bool b0;
+  if (!s7_is_boolean(s7_car(args)))
+    return(s7_wrong_type_arg_error(s7, "ffi_mp_set_note_bends", 1, s7_car(args), "a bool"));
+  b0=s7_boolean(s7, s7_car(args));
+  args=s7_cdr(args);
+  mp_set_note_bends(b0);
+  return s7_UNSPECIFIED(s7);
+}
+
+s7_pointer ffi_mp_set_channel_ports (s7_scheme *s7, s7_pointer args)
+{
+  s7_pointer p0;
+  if (!(s7_car(args)))
+    return(s7_wrong_type_arg_error(s7, "ffi_mp_set_channel_ports", 1, s7_car(args), "a s7_pointer"));
+  p0=s7_car(args);
+  args=s7_cdr(args);
+  mp_set_channel_ports(p0);
+  return s7_UNSPECIFIED(s7);
+}
+
+s7_pointer ffi_mp_set_output_latency (s7_scheme *s7, s7_pointer args)
+{
+  int i0;
+  double f0;
+  if (!s7_is_integer(s7_car(args)))
+    return(s7_wrong_type_arg_error(s7, "ffi_mp_set_output_latency", 1, s7_car(args), "a int"));
+  i0=(int)s7_integer(s7_car(args));
+  args=s7_cdr(args);
+  if (!s7_is_real(s7_car(args)))
+    return(s7_wrong_type_arg_error(s7, "ffi_mp_set_output_latency", 2, s7_car(args), "a double"));
+  f0=s7_number_to_real(s7_car(args));
+  args=s7_cdr(args);
+  mp_set_output_latency(i0, f0);
+  return s7_UNSPECIFIED(s7);
+}
+
 s7_pointer ffi_mp_set_instruments (s7_scheme *s7, s7_pointer args)
 {
   s7_pointer p0;
@@ -1398,6 +1550,22 @@ s7_pointer ffi_mp_set_midi_hook (s7_scheme *s7, s7_pointer args)
   return make_s7_boolean(s7, b0);
 }
 
+s7_pointer ffi_mp_set_midi_batch_hook (s7_scheme *s7, s7_pointer args)
+{
+  s7_pointer p0;
+  bool b0, b1;
+  if (!(s7_car(args)))
+    return(s7_wrong_type_arg_error(s7, "ffi_mp_set_midi_batch_hook", 1, s7_car(args), "a s7_pointer"));
+  p0=s7_car(args);
+  args=s7_cdr(args);
+  if (!s7_is_boolean(s7_car(args)))
+    return(s7_wrong_type_arg_error(s7, "ffi_mp_set_midi_batch_hook", 2, s7_car(args), "a bool"));
+  b0=s7_boolean(s7, s7_car(args));
+  args=s7_cdr(args);
+  b1=mp_set_midi_batch_hook(p0, b0);
+  return make_s7_boolean(s7, b1);
+}
+
 s7_pointer ffi_mp_is_midi_hook (s7_scheme *s7, s7_pointer args)
 {
   int i0;
@@ -3399,6 +3567,7 @@ void cm_init(s7_scheme *s7)
   s7_define_function(s7, "ffi_log_two", ffi_log_two, 1, 0, false, "ffi function");
   s7_define_function(s7, "ffi_now", ffi_now, 0, 0, false, "ffi function");
   s7_define_function(s7, "ffi_sched_sprout", ffi_sched_sprout, 5, 0, false, "ffi function");
+  s7_define_function(s7, "ffi_sched_sprout_list", ffi_sched_sprout_list, 5, 0, false, "ffi function");
   s7_define_function(s7, "ffi_sched_paused_p", ffi_sched_paused_p, 0, 0, false, "ffi function");
   s7_define_function(s7, "ffi_sched_pause", ffi_sched_pause, 0, 0, false, "ffi function");
   s7_define_function(s7, "ffi_sched_continue", ffi_sched_continue, 0, 0, false, "ffi function");
@@ -3409,6 +3578,8 @@ void cm_init(s7_scheme *s7)
   s7_define_function(s7, "ffi_sched_get_score_mode", ffi_sched_get_score_mode, 0, 0, false, "ffi function");
   s7_define_function(s7, "ffi_sched_set_score_mode", ffi_sched_set_score_mode, 1, 0, false, "ffi function");
   s7_define_function(s7, "ffi_sched_score_time", ffi_sched_score_time, 0, 0, false, "ffi function");
+  s7_define_function(s7, "ffi_sched_stats", ffi_sched_stats, 1, 0, false, "ffi function");
+  s7_define_function(s7, "ffi_sched_set_spin", ffi_sched_set_spin, 1, 0, false, "ffi function");
   s7_define_function(s7, "ffi_sched_metro_id_valid", ffi_sched_metro_id_valid, 1, 0, false, "ffi function");
   s7_define_function(s7, "ffi_sched_make_metro", ffi_sched_make_metro, 1, 0, false, "ffi function");
   s7_define_function(s7, "ffi_sched_delete_metro", ffi_sched_delete_metro, 1, 0, false, "ffi function");
@@ -3434,7 +3605,7 @@ void cm_init(s7_scheme *s7)
   s7_define_function(s7, "ffi_pathname_to_key", ffi_pathname_to_key, 1, 0, false, "ffi function");
   s7_define_function(s7, "ffi_insure_new_file_version", ffi_insure_new_file_version, 2, 0, false, "ffi function");
   s7_define_function(s7, "ffi_string_hash", ffi_string_hash, 1, 0, false, "ffi function");
-  s7_define_function(s7, "ffi_midifile_import", ffi_midifile_import, 3, 0, false, "ffi function");
+  s7_define_function(s7, "ffi_midifile_import", ffi_midifile_import, 4, 0, false, "ffi function");
   s7_define_function(s7, "ffi_midifile_header", ffi_midifile_header, 2, 0, false, "ffi function");
   s7_define_function(s7, "ffi_sal_allocate_tokens", ffi_sal_allocate_tokens, 0, 0, false, "ffi function");
   s7_define_function(s7, "ffi_sal_free_tokens", ffi_sal_free_tokens, 1, 0, false, "ffi function");
@@ -3447,17 +3618,24 @@ void cm_init(s7_scheme *s7)
   s7_define_function(s7, "ffi_mouse_y", ffi_mouse_y, 3, 0, false, "ffi function");
   s7_define_function(s7, "ffi_mouse_button", ffi_mouse_button, 2, 0, false, "ffi function");
   s7_define_function(s7, "ffi_port_info", ffi_port_info, 0, 0, false, "ffi function");
-  s7_define_function(s7, "ffi_mp_open_output", ffi_mp_open_output, 1, 0, false, "ffi function");
+  s7_define_function(s7, "ffi_mp_open_output", ffi_mp_open_output, 2, 0, false, "ffi function");
   s7_define_function(s7, "ffi_mp_open_input", ffi_mp_open_input, 1, 0, false, "ffi function");
   s7_define_function(s7, "ffi_mp_close_output", ffi_mp_close_output, 1, 0, false, "ffi function");
   s7_define_function(s7, "ffi_mp_close_input", ffi_mp_close_input, 1, 0, false, "ffi function");
   s7_define_function(s7, "ffi_mp_open_score", ffi_mp_open_score, 2, 0, false, "ffi function");
   s7_define_function(s7, "ffi_mp_close_score", ffi_mp_close_score, 0, 0, false, "ffi function");
-  s7_define_function(s7, "ffi_mp_send_note", ffi_mp_send_note, 5, 0, false, "ffi function");
-  s7_define_function(s7, "ffi_mp_send_data", ffi_mp_send_data, 5, 0, false, "ffi function");
+  s7_define_function(s7, "ffi_mp_send_note", ffi_mp_send_note, 6, 0, false, "ffi function");
+  s7_define_function(s7, "ffi_mp_send_data", ffi_mp_send_data, 6, 0, false, "ffi function");
   s7_define_function(s7, "ffi_mp_set_channel_mask", ffi_mp_set_channel_mask, 1, 0, false, "ffi function");
   s7_define_function(s7, "ffi_mp_set_message_mask", ffi_mp_set_message_mask, 1, 0, false, "ffi function");
   s7_define_function(s7, "ffi_mp_set_tuning", ffi_mp_set_tuning, 1, 0, false, "ffi function");
+  s7_define_function(s7, "ffi_mp_set_lookahead", ffi_mp_set_lookahead, 1, 0, false, "ffi function");
+  s7_define_function(s7, "ffi_mp_set_retrigger", ffi_mp_set_retrigger, 1, 0, false, "ffi function");
+  s7_define_function(s7, "ffi_mp_set_extend", ffi_mp_set_extend, 1, 0, false, "ffi function");
+  s7_define_function(s7, "ffi_mp_set_tuning_offsets", ffi_mp_set_tuning_offsets, 1, 0, false, "ffi function");
+  s7_define_function(s7, "ffi_mp_set_note_bends", ffi_mp_set_note_bends, 1, 0, false, "ffi function");
+  s7_define_function(s7, "ffi_mp_set_channel_ports", ffi_mp_set_channel_ports, 1, 0, false, "ffi function");
+  s7_define_function(s7, "ffi_mp_set_output_latency", ffi_mp_set_output_latency, 2, 0, false, "ffi function");
   s7_define_function(s7, "ffi_mp_set_instruments", ffi_mp_set_instruments, 1, 0, false, "ffi function");
   s7_define_function(s7, "ffi_mp_play_seq", ffi_mp_play_seq, 0, 0, false, "ffi function");
   s7_define_function(s7, "ffi_mp_save_seq", ffi_mp_save_seq, 0, 0, false, "ffi function");
@@ -3466,6 +3644,7 @@ void cm_init(s7_scheme *s7)
   s7_define_function(s7, "ffi_mp_clear_seq", ffi_mp_clear_seq, 0, 0, false, "ffi function");
   s7_define_function(s7, "ffi_mp_set_midi_hook", ffi_mp_set_midi_hook, 2, 0, false, "ffi function");
   s7_define_function(s7, "ffi_mp_is_midi_hook", ffi_mp_is_midi_hook, 1, 0, false, "ffi function");
+  s7_define_function(s7, "ffi_mp_set_midi_batch_hook", ffi_mp_set_midi_batch_hook, 2, 0, false, "ffi function");
   s7_define_function(s7, "ffi_cs_open_score", ffi_cs_open_score, 1, 0, false, "ffi function");
   s7_define_function(s7, "ffi_cs_close_score", ffi_cs_close_score, 0, 0, false, "ffi function");
   s7_define_function(s7, "ffi_cs_send_score", ffi_cs_send_score, 4, 0, false, "ffi function");
@@ -0,0 +1,242 @@
+/*=======================================================================*
+  Copyright (C) 2012 Rick Taube.
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the Lisp Lesser Gnu Public License. The text of
+  this agreement is available at http://www.cliki.net/LLGPL
+ *=======================================================================*/
+
+/** Measures how late midi output is sent directly from the output
+    thread, the way MidiOutDevice::run() sends when the lookahead is 0,
+    and handed over ahead of time the way MidiOutDevice::sendBlock()
+    does. First the messages go to a MidiOutput whose sendMessageNow()
+    records the time instead of writing to a port. In lookahead mode it
+    is called from juce's own background thread, so the times are taken
+    where that thread would write each message. Then, where a virtual
+    midi input can be created (linux), the messages are sent to it
+    through a real device and through the ALSA sequencer queue
+    (src/MidiSequencerQueue.cpp) and timed when they arrive. Build and
+    run from the top directory with the juce library built by premake:
+
+    g++ -O2 -DNDEBUG -Isrc tests/MidiOutLatenessBench.cpp \
+      src/SchedulerClock.cpp src/MidiSequencerQueue.cpp \
+      -Lobj/juce -ljuce -lpthread -lrt -lX11 -lfreetype -lasound
+    ./a.out
+
+    The program prints the lateness of each mode in milliseconds and
+    exits with 1 if a mode loses messages. **/
+
+#include "SchedulerClock.h"
+#include "MidiSequencerQueue.h"
+
+static const int NumEvents=2000;
+
+/** The lateness of each message that arrives. Message i is a
+    controller event whose controller and value hold i, so messages
+    are timed against their own due times even if they arrive out of
+    order. **/
+
+class LatenessLog
+{
+ public:
+  LatenessLog() : due (NULL) {}
+
+  void reset(const double* times)
+  {
+    due=times;
+    numlogged.set(0);
+  }
+
+  void record(const MidiMessage& msg)
+  {
+    double now=Time::getMillisecondCounterHiRes();
+    int i=numlogged.get();
+    if (due==NULL || i>=NumEvents || !msg.isController())
+      return;
+    int index=(msg.getControllerNumber()<<7)+msg.getControllerValue();
+    if (index>=NumEvents)
+      return;
+    lateness[i]=now-due[index];
+    numlogged.set(i+1);
+  }
+
+  const double* due;
+  double lateness[NumEvents];
+  Atomic<int> numlogged;
+};
+
+/** A device that logs each message instead of sending it. **/
+
+class SendRecorder : public MidiOutput
+{
+ public:
+  SendRecorder(LatenessLog& lateness) : log (lateness) {}
+  ~SendRecorder() {}
+  void sendMessageNow(const MidiMessage& msg) {log.record(msg);}
+ private:
+  LatenessLog& log;
+};
+
+/** Logs each message that arrives at the virtual input. **/
+
+class LoopbackReceiver : public MidiInputCallback
+{
+ public:
+  LoopbackReceiver(LatenessLog& lateness) : log (lateness) {}
+  ~LoopbackReceiver() {}
+  void handleIncomingMidiMessage(MidiInput* source, const MidiMessage& msg)
+  {
+    log.record(msg);
+  }
+ private:
+  LatenessLog& log;
+};
+
+/** Sends a message at each due time, from its own thread or ahead of
+    time through the sequencer queue or the device's background
+    thread. **/
+
+class BenchSender : public Thread
+{
+ public:
+  BenchSender(MidiOutput* out, MidiSequencerQueue* seq, const double* due,
+              double ahead, double spin)
+    : Thread (T("bench-sender")),
+      device (out),
+      sequencer (seq),
+      times (due),
+      lookahead (ahead),
+      clock (T("bench-sender"))
+  {
+    clock.setSpinTime(spin);
+  }
+
+  ~BenchSender() {}
+
+  void run()
+  {
+    int next=0;
+    while (next<NumEvents && !threadShouldExit())
+      {
+        if (!clock.waitUntil(this, times[next]-lookahead))
+          continue;
+        if (lookahead==0.0)
+          {
+            device->sendMessageNow(message(next));
+            next++;
+            continue;
+          }
+        // collect everything due within the window, block positions
+        // are microseconds from now
+        double now=Time::getMillisecondCounterHiRes();
+        block.clear();
+        while (next<NumEvents && times[next]<=now+lookahead)
+          {
+            int pos=(int)((times[next]-now)*1000.0);
+            block.addEvent(message(next), jmax(0, pos));
+            next++;
+          }
+        if (sequencer != NULL)
+          sequencer->sendBlock(block, now);
+        else
+          device->sendBlockOfMessages(block, now, 1000000.0);
+      }
+  }
+
+ private:
+  MidiOutput* device;
+  MidiSequencerQueue* sequencer;
+  const double* times;
+  double lookahead;
+  SchedulerClock clock;
+  MidiBuffer block;
+
+  static MidiMessage message(int i)
+  {
+    return MidiMessage::controllerEvent(1, i>>7, i & 127);
+  }
+};
+
+static bool measure(const char* name, LatenessLog& log, MidiOutput* device,
+                    MidiSequencerQueue* sequencer, double ahead, double spin)
+{
+  // one message every 5 ms at a random fraction of a millisecond, the
+  // way scheduled times fall
+  double due[NumEvents];
+  double start=Time::getMillisecondCounterHiRes()+100.0;
+  for (int i=0; i<NumEvents; i++)
+    due[i]=start+(i*5.0)+((rand() % 1000)/1000.0);
+  log.reset(due);
+
+  bool background=(ahead>0.0 && sequencer==NULL);
+  if (background)
+    device->startBackgroundThread();
+  BenchSender sender(device, sequencer, due, ahead, spin);
+  sender.startThread(9);
+  // wait for the last message, juce drops messages that are very late
+  while (log.numlogged.get()<NumEvents &&
+         Time::getMillisecondCounterHiRes()<due[NumEvents-1]+1000.0)
+    Thread::sleep(10);
+  sender.stopThread(1000);
+  if (background)
+    device->stopBackgroundThread();
+  // stragglers are not counted
+  log.due=NULL;
+
+  int num=log.numlogged.get();
+  double sum=0.0, sumsq=0.0, low=0.0, high=0.0;
+  int over=0;
+  for (int i=0; i<num; i++)
+    {
+      double late=log.lateness[i];
+      sum+=late;
+      sumsq+=late*late;
+      low=(i==0) ? late : jmin(low, late);
+      high=(i==0) ? late : jmax(high, late);
+      if (fabs(late)>=1.0)
+        over++;
+    }
+  double mean=(num>0) ? sum/num : 0.0;
+  double jitter=(num>0) ? sqrt(jmax(0.0, (sumsq/num)-(mean*mean))) : 0.0;
+  printf("%-18s sent %d/%d mean %.3f jitter %.3f min %.3f max %.3f, %d off by 1 ms or more\n",
+         name, num, NumEvents, mean, jitter, low, high, over);
+  return num==NumEvents;
+}
+
+int main()
+{
+  srand(1);
+  bool ok=true;
+
+  LatenessLog sendlog;
+  SendRecorder recorder(sendlog);
+  printf("send side lateness of %d messages in ms\n", NumEvents);
+  ok=measure("direct", sendlog, &recorder, NULL, 0.0, 0.0) && ok;
+  ok=measure("direct, 1 ms spin", sendlog, &recorder, NULL, 0.0, 1.0) && ok;
+  ok=measure("lookahead 20 ms", sendlog, &recorder, NULL, 20.0, 0.0) && ok;
+
+  // the loopback's arrival times include the sequencer's delivery
+  // time, which is the same for every mode
+  LatenessLog receivelog;
+  LoopbackReceiver receiver(receivelog);
+  ScopedPointer<MidiInput> input (MidiInput::createNewDevice(T("Lateness Bench"), &receiver));
+  int id=(input != NULL) ? MidiOutput::getDevices().indexOf(T("Lateness Bench")) : -1;
+  ScopedPointer<MidiOutput> output ((id<0) ? NULL : MidiOutput::openDevice(id));
+  if (output == NULL)
+    printf("no virtual midi input, the receive side is not measured\n");
+  else
+    {
+      input->start();
+      printf("receive side lateness of %d messages in ms\n", NumEvents);
+      ok=measure("direct", receivelog, output, NULL, 0.0, 0.0) && ok;
+      ok=measure("direct, 1 ms spin", receivelog, output, NULL, 0.0, 1.0) && ok;
+      ok=measure("lookahead 20 ms", receivelog, output, NULL, 20.0, 0.0) && ok;
+      MidiSequencerQueue sequencer;
+      if (sequencer.open(id))
+        ok=measure("alsa queue 20 ms", receivelog, output, &sequencer, 20.0, 0.0) && ok;
+      else
+        printf("the sequencer queue could not be opened\n");
+      input->stop();
+    }
+  printf(ok ? "ok\n" : "FAIL messages were lost\n");
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,303 @@
+/*=======================================================================*
+  Copyright (C) 2012 Rick Taube.
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the Lisp Lesser Gnu Public License. The text of
+  this agreement is available at http://www.cliki.net/LLGPL
+ *=======================================================================*/
+
+/** Tests the osc receiver table (src/OscHookTable.cpp) and times its
+    lookups with thousands of receivers. The matcher is checked against
+    fixed cases and against a separate reference matcher on random
+    patterns and paths. Lookups through the trie are checked against a
+    linear scan of every hook. Build and run from the top directory
+    with the juce library built by premake and s7.h from sndlib:
+
+    g++ -O2 -DNDEBUG -DWITH_SNDLIB=1 -Isrc -I<sndlib> \
+      tests/OscHookTableTest.cpp src/OscHookTable.cpp \
+      -Lobj/juce -ljuce -lpthread -lrt -lX11 -lfreetype -lasound
+    ./a.out
+
+    The program prints the timings and exits with 1 if a check
+    fails. **/
+
+#include "OscHookTable.h"
+#include <ctime>
+
+static int failures=0;
+
+static void check(bool ok, const char* what, const std::string& a,
+                  const std::string& b)
+{
+  if (ok)
+    return;
+  printf("FAIL %s: %s %s\n", what, a.c_str(), b.c_str());
+  failures++;
+}
+
+/*=======================================================================*
+                              Reference Matcher
+ *=======================================================================*/
+
+/** Matches one pattern element against one path element, both
+    without slashes, by trying each way the pattern's first item can
+    consume the path. **/
+
+static bool referenceElement(const std::string& pat, const std::string& str)
+{
+  if (pat.empty())
+    return str.empty();
+  char c=pat[0];
+  if (c=='*')
+    {
+      for (size_t i=0; i<=str.size(); i++)
+        if (referenceElement(pat.substr(1), str.substr(i)))
+          return true;
+      return false;
+    }
+  if (c=='?')
+    return !str.empty() && referenceElement(pat.substr(1), str.substr(1));
+  if (c=='[')
+    {
+      size_t close=pat.find(']');
+      if (close==std::string::npos || str.empty())
+        return false;
+      std::string set=pat.substr(1, close-1);
+      bool negate=(!set.empty() && set[0]=='!');
+      if (negate)
+        set=set.substr(1);
+      bool found=false;
+      for (size_t i=0; i<set.size(); i++)
+        if (i+2<set.size() && set[i+1]=='-')
+          {
+            if (str[0]>=set[i] && str[0]<=set[i+2])
+              found=true;
+            i+=2;
+          }
+        else if (str[0]==set[i])
+          found=true;
+      return (found != negate) &&
+        referenceElement(pat.substr(close+1), str.substr(1));
+    }
+  if (c=='{')
+    {
+      size_t close=pat.find('}');
+      if (close==std::string::npos)
+        return false;
+      std::string alts=pat.substr(1, close-1)+",";
+      std::string rest=pat.substr(close+1);
+      for (size_t start=0, comma; (comma=alts.find(',', start))!=std::string::npos; start=comma+1)
+        if (referenceElement(alts.substr(start, comma-start)+rest, str))
+          return true;
+      return false;
+    }
+  return !str.empty() && str[0]==c &&
+    referenceElement(pat.substr(1), str.substr(1));
+}
+
+static void split(const std::string& path, std::vector<std::string>& elts)
+{
+  size_t start=(!path.empty() && path[0]=='/') ? 1 : 0;
+  while (true)
+    {
+      size_t slash=path.find('/', start);
+      elts.push_back(path.substr(start, slash-start));
+      if (slash==std::string::npos)
+        break;
+      start=slash+1;
+    }
+}
+
+static bool referenceMatch(const std::string& pat, const std::string& path)
+{
+  std::vector<std::string> p, s;
+  split(pat, p);
+  split(path, s);
+  if (p.size() != s.size())
+    return false;
+  for (size_t i=0; i<p.size(); i++)
+    if (!referenceElement(p[i], s[i]))
+      return false;
+  return true;
+}
+
+/*=======================================================================*
+                                   Tests
+ *=======================================================================*/
+
+static void testFixedCases()
+{
+  struct {const char* pattern; const char* path; bool match;} cases[]=
+    {
+      {"/a/b", "/a/b", true}, {"/a/b", "/a/bc", false},
+      {"/a/*", "/a/xyz", true}, {"/a/*", "/a/x/y", false},
+      {"/*/b", "/foo/b", true}, {"/a?c", "/abc", true},
+      {"/a?c", "/a/c", false}, {"/[abc]x", "/bx", true},
+      {"/[!abc]x", "/bx", false}, {"/[!abc]x", "/dx", true},
+      {"/[a-c]x", "/cx", true}, {"/[a-c]x", "/dx", false},
+      {"/{foo,bar}/x", "/bar/x", true}, {"/{foo,bar}/x", "/baz/x", false},
+      {"/f*o", "/fo", true}, {"/f*o", "/fooo", true},
+      {"/*", "/", true}, {"/{a,ab}c", "/abc", true},
+      {"/*/*", "/a/b", true}, {"/*", "/a/b", false},
+      {"/synth/*/freq", "/synth/12/freq", true},
+      {"/synth/[0-9]/freq", "/synth/12/freq", false}
+    };
+  for (unsigned i=0; i<sizeof(cases)/sizeof(cases[0]); i++)
+    check(OscHookTable::matches(cases[i].pattern, cases[i].path)==cases[i].match,
+          "fixed case", cases[i].pattern, cases[i].path);
+}
+
+static std::string pick(const char** items, int num)
+{
+  return items[rand() % num];
+}
+
+static const char* literals[]={"a", "b", "ab", "abc", "synth", "freq", "1", "2", "x1", "x12"};
+static const int numliterals=10;
+static const char* patterns[]={"*", "?", "[ab]", "[!a]*", "{a,synth}", "x[0-9]",
+                               "a*c", "[a-c]?c", "*1*", "{ab,a}?", "x?*", "[0-9]"};
+static const int numpatterns=12;
+
+static std::string randomPath(bool withPatterns)
+{
+  std::string path;
+  int depth=1+(rand() % 3);
+  for (int i=0; i<depth; i++)
+    {
+      path+="/";
+      path+=(withPatterns && (rand() % 3)==0) ? pick(patterns, numpatterns)
+        : pick(literals, numliterals);
+    }
+  return path;
+}
+
+static void testRandomMatches()
+{
+  for (int i=0; i<200000; i++)
+    {
+      std::string pat=randomPath(true);
+      std::string path=randomPath(false);
+      check(OscHookTable::matches(pat.c_str(), path.c_str())==referenceMatch(pat, path),
+            "matcher", pat, path);
+    }
+}
+
+static void testRandomTables()
+{
+  for (int round=0; round<500; round++)
+    {
+      OscHookTable table;
+      OwnedArray<OscHook> hooks;
+      OscHook def(String::empty, NULL);
+      table.add(&def);
+      int num=1+(rand() % 40);
+      for (int i=0; i<num; i++)
+        {
+          std::string path=randomPath(true);
+          bool dup=false;
+          for (int j=0; j<hooks.size() && !dup; j++)
+            dup=(path==hooks.getUnchecked(j)->path.toUTF8().getAddress());
+          if (dup)
+            continue;
+          OscHook* hook=new OscHook(String(path.c_str()), NULL);
+          hooks.add(hook);
+          table.add(hook);
+        }
+      // removing prunes the trie, the rest must still be found
+      for (int j=hooks.size()-1; j>=0; j--)
+        if ((rand() % 4)==0)
+          {
+            table.remove(hooks.getUnchecked(j));
+            hooks.remove(j);
+          }
+      for (int q=0; q<300; q++)
+        {
+          std::string path=randomPath(false);
+          OscHook* found=table.find(path.c_str());
+          bool any=false;
+          OscHook* exact=NULL;
+          for (int j=0; j<hooks.size(); j++)
+            {
+              OscHook* hook=hooks.getUnchecked(j);
+              std::string hp=hook->path.toUTF8().getAddress();
+              if (referenceMatch(hp, path))
+                any=true;
+              if (hp==path)
+                exact=hook;
+            }
+          if (found==&def)
+            check(!any, "missed a hook", path, "");
+          else
+            check(referenceMatch(found->path.toUTF8().getAddress(), path),
+                  "wrong hook", path, found->path.toUTF8().getAddress());
+          // a hook for the exact path always wins
+          if (exact != NULL)
+            check(found==exact, "literal lost", path, "");
+        }
+      for (int j=0; j<hooks.size(); j++)
+        table.remove(hooks.getUnchecked(j));
+    }
+}
+
+static void testIncomingPatterns()
+{
+  OscHookTable table;
+  OscHook freq(T("/synth/1/freq"), NULL);
+  OscHook amp(T("/synth/2/amp"), NULL);
+  table.add(&freq);
+  table.add(&amp);
+  check(table.find("/synth/*/freq")==&freq, "incoming pattern", "/synth/*/freq", "");
+  check(table.find("/synth/{1,2}/amp")==&amp, "incoming pattern", "/synth/{1,2}/amp", "");
+  check(table.find("/synth/*/x")==NULL, "incoming pattern", "/synth/*/x", "");
+}
+
+/*=======================================================================*
+                                 Benchmark
+ *=======================================================================*/
+
+static void benchmarkLookups()
+{
+  const int numhooks=20000;
+  const int numfinds=1000000;
+  OscHookTable table;
+  OwnedArray<OscHook> hooks;
+  char buf[64];
+  for (int i=0; i<numhooks; i++)
+    {
+      sprintf(buf, "/synth/%d/param%d", i, i % 7);
+      hooks.add(new OscHook(String(buf), NULL));
+      table.add(hooks.getLast());
+    }
+  OscHook freq(T("/synth/*/freq"), NULL);
+  table.add(&freq);
+  // the paths are built before timing so only the lookups are timed
+  std::vector<std::string> paths;
+  for (int i=0; i<numhooks; i++)
+    {
+      sprintf(buf, "/synth/%d/param%d", i, i % 7);
+      paths.push_back(buf);
+      sprintf(buf, "/synth/%d/freq", i);
+      paths.push_back(buf);
+    }
+  int found=0;
+  clock_t start=clock();
+  for (int i=0; i<numfinds; i++)
+    found+=(table.find(paths[i % paths.size()].c_str()) != NULL);
+  double secs=(double)(clock()-start)/CLOCKS_PER_SEC;
+  check(found==numfinds, "benchmark lookups", "", "");
+  printf("%d receivers: %d lookups in %.3f s (%.0f ns per lookup)\n",
+         numhooks+1, numfinds, secs, (secs*1e9)/numfinds);
+  for (int i=0; i<hooks.size(); i++)
+    table.remove(hooks.getUnchecked(i));
+}
+
+int main()
+{
+  srand(1);
+  testFixedCases();
+  testRandomMatches();
+  testRandomTables();
+  testIncomingPatterns();
+  benchmarkLookups();
+  printf((failures==0) ? "ok\n" : "%d failures\n", failures);
+  return (failures==0) ? 0 : 1;
+}
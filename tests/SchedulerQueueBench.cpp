@@ -0,0 +1,144 @@
+/*=======================================================================*
+  Copyright (C) 2012 Rick Taube.
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the Lisp Lesser Gnu Public License. The text of
+  this agreement is available at http://www.cliki.net/LLGPL
+ *=======================================================================*/
+
+/** Sprouts 10,000 periodic processes and runs them for 1,000,000
+    events, first in a sorted array the way the scheduler's OwnedArray
+    used to (addSorted() to queue a node, remove(0) to take the first)
+    and then in the BinaryHeap that XSchemeQueue uses. Both queues must
+    run the nodes in the same order: by time, and at the same time in
+    the order they were added. Build and run from the top directory with the
+    juce library built by premake:
+
+    g++ -O2 -DNDEBUG -Isrc tests/SchedulerQueueBench.cpp \
+      -Lobj/juce -ljuce -lpthread -lrt -lX11 -lfreetype -lasound
+    ./a.out
+
+    The program exits with 1 if the two orders differ. **/
+
+#include "BinaryHeap.h"
+#include <ctime>
+
+/** A process that reschedules itself every period seconds. **/
+
+struct BenchNode
+{
+  double time;
+  int nodeid;
+  int qindex;
+  double period;
+};
+
+/** The same order as XSchemeNodeComparator. **/
+
+class BenchComparator
+{
+ public:
+  static int compareElements(BenchNode* e1, BenchNode* e2)
+  {
+    if (e1->time < e2->time)
+      return -1;
+    else if (e2->time < e1->time)
+      return 1;
+    // else both at same time, return node that was added first
+    else if (e1->nodeid<e2->nodeid)
+      return -1;
+    else
+      return 1;
+  }
+};
+
+class BenchIndex
+{
+ public:
+  static void setIndex(BenchNode* node, int index) {node->qindex=index;}
+};
+
+static const int NumProcesses=10000;
+static const int NumEvents=1000000;
+
+static void makeNodes(OwnedArray<BenchNode>& nodes)
+{
+  srand(1);
+  for (int i=0; i<NumProcesses; i++)
+    {
+      BenchNode* node=new BenchNode();
+      // everything starts together and periods are multiples of an
+      // eighth so many nodes are due at the same time
+      node->time=0.0;
+      node->nodeid=i+1;
+      node->qindex=-1;
+      node->period=0.125*(1+(rand() % 16));
+      nodes.add(node);
+    }
+}
+
+static double elapsed(clock_t start)
+{
+  return (double)(clock()-start)/CLOCKS_PER_SEC;
+}
+
+static void report(const char* name, double sprout, double run)
+{
+  printf("%-12s sprout %d: %.3f s, run %d events: %.3f s (%.0f ns per event)\n",
+         name, NumProcesses, sprout, NumEvents, run, (run*1e9)/NumEvents);
+}
+
+int main()
+{
+  BenchComparator comparator;
+  std::vector<int> sortedorder, heaporder;
+  sortedorder.reserve(NumEvents);
+  heaporder.reserve(NumEvents);
+
+  {
+    OwnedArray<BenchNode> nodes;
+    makeNodes(nodes);
+    // the queue doesn't own the nodes, nodes does
+    Array<BenchNode*, CriticalSection> queue;
+    clock_t start=clock();
+    for (int i=0; i<NumProcesses; i++)
+      queue.addSorted(comparator, nodes.getUnchecked(i));
+    double sprout=elapsed(start);
+    start=clock();
+    for (int i=0; i<NumEvents; i++)
+      {
+        BenchNode* node=queue.getFirst();
+        queue.remove(0);
+        sortedorder.push_back(node->nodeid);
+        node->time+=node->period;
+        queue.addSorted(comparator, node);
+      }
+    report("sorted array", sprout, elapsed(start));
+  }
+
+  {
+    OwnedArray<BenchNode> nodes;
+    makeNodes(nodes);
+    BinaryHeap<BenchNode*, BenchComparator, BenchIndex> queue;
+    clock_t start=clock();
+    for (int i=0; i<NumProcesses; i++)
+      queue.add(nodes.getUnchecked(i));
+    double sprout=elapsed(start);
+    start=clock();
+    for (int i=0; i<NumEvents; i++)
+      {
+        BenchNode* node=queue.removeFirst();
+        heaporder.push_back(node->nodeid);
+        node->time+=node->period;
+        queue.add(node);
+      }
+    report("binary heap", sprout, elapsed(start));
+  }
+
+  if (sortedorder != heaporder)
+    {
+      printf("FAIL the queues ran the nodes in different orders\n");
+      return 1;
+    }
+  printf("ok\n");
+  return 0;
+}
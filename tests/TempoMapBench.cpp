@@ -0,0 +1,66 @@
+/*=======================================================================*
+  Copyright (C) 2012 Rick Taube.
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the Lisp Lesser Gnu Public License. The text of
+  this agreement is available at http://www.cliki.net/LLGPL
+ *=======================================================================*/
+
+/** Times metronome beat and time conversions (src/Metronome.cpp) over
+    a 1,000 point accelerando: 100,000 getTimeAtBeat() calls and
+    100,000 getBeatAtTime() calls at random places in the tempo map.
+    Build and run from the top directory with the juce library built
+    by premake:
+
+    g++ -O2 -DNDEBUG -Isrc tests/TempoMapBench.cpp src/Metronome.cpp \
+      -Lobj/juce -ljuce -lpthread -lrt -lX11 -lfreetype -lasound
+    ./a.out
+
+    Each beat is converted to a time and back, the program exits with 1
+    if the round trip is off by more than a microsecond. **/
+
+#include "Metronome.h"
+#include <ctime>
+
+int main()
+{
+  const int numpoints=1000;
+  const int numconversions=100000;
+  const double span=600.0;  // seconds of accelerando
+  Metronome metro(60.0);
+  // the accelerando runs from 60 to 240 bpm over the next ten minutes
+  double start=metro.getNowTime()+1.0;
+  for (int i=1; i<=numpoints; i++)
+    metro.addPoint(start+((span*i)/numpoints), 60.0+((180.0*i)/numpoints));
+  double lastbeat=metro.getBeatAtTime(start+span);
+
+  srand(1);
+  std::vector<double> beats;
+  for (int i=0; i<numconversions; i++)
+    beats.push_back((lastbeat*rand())/RAND_MAX);
+
+  std::vector<double> times(numconversions);
+  clock_t begin=clock();
+  for (int i=0; i<numconversions; i++)
+    times[i]=metro.getTimeAtBeat(beats[i]);
+  double tosecs=(double)(clock()-begin)/CLOCKS_PER_SEC;
+
+  double error=0.0;
+  begin=clock();
+  for (int i=0; i<numconversions; i++)
+    error=jmax(error, fabs(metro.getBeatAtTime(times[i])-beats[i]));
+  double frsecs=(double)(clock()-begin)/CLOCKS_PER_SEC;
+
+  printf("%d point tempo map, %d beats\n", numpoints+1, (int)lastbeat);
+  printf("getTimeAtBeat: %d calls in %.3f s (%.0f ns per call)\n",
+         numconversions, tosecs, (tosecs*1e9)/numconversions);
+  printf("getBeatAtTime: %d calls in %.3f s (%.0f ns per call)\n",
+         numconversions, frsecs, (frsecs*1e9)/numconversions);
+  // a beat is at least a quarter second, so a microsecond is 4e-6 beats
+  if (error > 4e-6)
+    {
+      printf("FAIL round trip error %g beats\n", error);
+      return 1;
+    }
+  printf("ok\n");
+  return 0;
+}